@@ -0,0 +1,468 @@
+/**
+ * @file bench_main.cpp
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief Benchmark suite of the real-time hot path of cable robot app.
+ *
+ * Usage:
+ * @code{.sh}
+ * CableRobotBench [--config FILE] [--actuators N1,N2,...] [--baseline FILE]
+ *                 [--update-baseline] [--tolerance REL] [--min-time SEC]
+ * @endcode
+ * The robot is always run on the simulated EtherCAT network, with the first actuator of
+ * the given configuration file replicated N times. When a baseline is given, the exit
+ * code is the number of benchmarks which fail against it, i.e. which are slower or
+ * allocate more than in the baseline, or which have no timing in it at all.
+ */
+
+#include <QCoreApplication>
+
+#include <iostream>
+#include <sstream>
+
+#include "easylogging++.h"
+#include "robotconfigjsonparser.h"
+
+#include "ctrl/controller_multidrive.h"
+#include "ctrl/controller_singledrive.h"
+#include "ctrl/poly5_trajectory.h"
+#include "microbench.h"
+#include "robot/actuators_core.h"
+#include "robot/cablerobot.h"
+#include "robot/forward_kinematics.h"
+#include "robot/inverse_kinematics.h"
+#include "utils/msgs.h"
+
+INITIALIZE_EASYLOGGINGPP
+
+/**
+ * @brief Grants benchmarks access to private hot-path functions and members.
+ */
+class BenchAccess
+{
+ public:
+  static void ControlStep(CableRobot* robot) { robot->ControlStep(0.0); }
+  static void UpdateActuatorsStatus(CableRobot* robot) { robot->UpdateActuatorsStatus(); }
+  static void LockRobot(CableRobot* robot) { pthread_mutex_lock(&robot->mutex_); }
+  static void UnlockRobot(CableRobot* robot) { pthread_mutex_unlock(&robot->mutex_); }
+  static Actuator* GetActiveActuator(CableRobot* robot, const size_t i)
+  {
+    return robot->active_actuators_ptrs_[i];
+  }
+  static const vect<Actuator*>& GetActiveActuators(CableRobot* robot)
+  {
+    return robot->active_actuators_ptrs_;
+  }
+
+  static int32_t CalcPoly5Waypoint(ControllerSingleDrive* controller, const int32_t q,
+                                   const int32_t q_final, const int32_t max_dq)
+  {
+    return controller->CalcPoly5Waypoint(q, q_final, max_dq);
+  }
+};
+
+/**
+ * @brief A controller holding each targeted cable at its current length, so that the
+ * control step dispatches one action per actuator without moving anything.
+ */
+class HoldLengthController: public ControllerBase
+{
+ public:
+  explicit HoldLengthController(const vect<id_t>& motors_id) : ControllerBase(motors_id)
+  {
+    SetMode(CABLE_LENGTH);
+  }
+
+  void CalcCtrlActions(const grabcdpr::Vars&, const ActuatorsState& actuators_state,
+                       ControlActions* ctrl_actions) override
+  {
+    for (size_t i = 0; i < actuators_state.Size(); i++)
+    {
+      ControlAction action;
+      action.motor_id     = actuators_state.GetIDs()[i];
+      action.ctrl_mode    = CABLE_LENGTH;
+      action.cable_length = actuators_state.GetCableLengths()[i];
+      ctrl_actions->Push(action);
+    }
+  }
+
+  bool TargetReached() const override { return true; }
+};
+
+namespace {
+
+struct BenchOptions
+{
+  std::string config_filename = SRCDIR "config/default.json";
+  vect<size_t> actuators_num  = {1, 3, 4, 6, 8};
+  std::string baseline_filename;
+  bool update_baseline = false;
+  double tolerance     = 0.2;
+  double min_time_sec  = 0.1;
+};
+
+bool ParseOptions(int argc, char* argv[], BenchOptions* options)
+{
+  for (int i = 1; i < argc; i++)
+  {
+    const std::string arg = argv[i];
+    if (arg == "--update-baseline")
+      options->update_baseline = true;
+    else if (i + 1 >= argc)
+      return false;
+    else if (arg == "--config")
+      options->config_filename = argv[++i];
+    else if (arg == "--baseline")
+      options->baseline_filename = argv[++i];
+    else if (arg == "--tolerance")
+      options->tolerance = std::stod(argv[++i]);
+    else if (arg == "--min-time")
+      options->min_time_sec = std::stod(argv[++i]);
+    else if (arg == "--actuators")
+    {
+      options->actuators_num.clear();
+      std::stringstream list(argv[++i]);
+      std::string item;
+      while (std::getline(list, item, ','))
+        options->actuators_num.push_back(std::stoul(item));
+    }
+    else
+      return false;
+  }
+  return !options->actuators_num.empty() &&
+         (!options->update_baseline || !options->baseline_filename.empty());
+}
+
+grabcdpr::Params MakeSyntheticConfig(const grabcdpr::Params& config,
+                                     const size_t actuators_num)
+{
+  grabcdpr::Params synthetic = config;
+  synthetic.actuators.assign(actuators_num, config.actuators.front());
+  for (auto& actuator_params : synthetic.actuators)
+    actuator_params.active = true;
+  return synthetic;
+}
+
+void BenchRobot(MicroBench& bench, const grabcdpr::Params& config,
+                const size_t actuators_num)
+{
+  AppSettings settings;
+  settings.ethercat_backend = ETHERCAT_SIMULATED;
+  CableRobot robot(NULL, MakeSyntheticConfig(config, actuators_num), settings);
+  robot.StartNetwork();
+  robot.EnableMotors();
+  if (!robot.MotorsEnabled())
+    std::cerr << "[WARNING] Not all simulated motors could be enabled: control actions "
+                 "will be partially skipped"
+              << std::endl;
+
+  HoldLengthController controller(robot.GetActiveMotorsID());
+  robot.SetController(&controller);
+
+  // Hold robot mutex, so that the simulated RT thread is paused while measuring.
+  const std::string suffix = "/" + std::to_string(actuators_num);
+  BenchAccess::LockRobot(&robot);
+  bench.Run("CableRobot::ControlStep" + suffix,
+            [&robot]() { BenchAccess::ControlStep(&robot); });
+  bench.Run("CableRobot::UpdateActuatorsStatus" + suffix,
+            [&robot]() { BenchAccess::UpdateActuatorsStatus(&robot); });
+  // Same cycle work, with and without specialization on actuators number
+  ActuatorsState actuators_state;
+  actuators_state.Setup(robot.GetActiveMotorsID());
+  ActuatorsCoreDynamic dynamic_core(BenchAccess::GetActiveActuators(&robot));
+  std::unique_ptr<ActuatorsCoreBase> core(
+    MakeActuatorsCore(BenchAccess::GetActiveActuators(&robot)));
+  bench.Run("ActuatorsCore::UpdateState/dynamic" + suffix,
+            [&dynamic_core, &actuators_state]() {
+              dynamic_core.UpdateState(&actuators_state);
+            });
+  bench.Run("ActuatorsCore::UpdateState/specialized" + suffix,
+            [&core, &actuators_state]() { core->UpdateState(&actuators_state); });
+  // Same control actions as the control step
+  ControlActions ctrl_actions;
+  ctrl_actions.SetCapacity(actuators_num);
+  controller.CalcCtrlActions(grabcdpr::Vars(), actuators_state, &ctrl_actions);
+  const IdIndexMap index_map(robot.GetActiveMotorsID());
+  vect<ControlAction> applied_ctrl_actions(actuators_num);
+  bench.Run("ActuatorsCore::ApplyCtrlActions" + suffix, [&]() {
+    core->ApplyCtrlActions(ctrl_actions, index_map, &applied_ctrl_actions);
+  });
+  if (actuators_num == 1)
+  {
+    Actuator* actuator = BenchAccess::GetActiveActuator(&robot, 0);
+    bench.Run("Actuator::GetStatus", [actuator]() {
+      ActuatorStatus status = actuator->GetStatus();
+      DoNotOptimize(status);
+    });
+    bench.Run("Winch::GetStatus", [actuator]() {
+      WinchStatus status = actuator->GetWinch().GetStatus();
+      DoNotOptimize(status);
+    });
+  }
+  BenchAccess::UnlockRobot(&robot);
+
+  robot.SetController(NULL);
+  robot.DisableMotors();
+}
+
+void BenchInverseKinematics(MicroBench& bench, const grabcdpr::Params& config,
+                            const size_t actuators_num)
+{
+  InverseKinematics ik(MakeSyntheticConfig(config, actuators_num));
+  grabcdpr::PlatformVars platform(grabcdpr::TILT_TORSION);
+  grabcdpr::Vars robot_status;
+  robot_status.platform = &platform;
+  robot_status.cables.resize(actuators_num);
+
+  // Slowly moving pose, so that nothing can be cached between calls
+  InverseKinematics::Pose pose             = {{0.0, 0.0, 0.0, 0.0, 0.0, 0.0}};
+  const InverseKinematics::Pose pose_deriv = {{0.1, -0.1, 0.05, 0.02, -0.02, 0.01}};
+  const std::string suffix                 = "/" + std::to_string(actuators_num);
+  bench.Run("InverseKinematics::UpdateZeroOrd" + suffix, [&ik, &pose]() {
+    pose[0] += 1e-9;
+    DoNotOptimize(ik.UpdateZeroOrd(pose));
+  });
+  bench.Run("InverseKinematics::UpdateFirstOrd" + suffix, [&ik, &pose_deriv]() {
+    ik.UpdateFirstOrd(pose_deriv);
+    DoNotOptimize(ik.GetCable(0));
+  });
+  bench.Run("InverseKinematics::WriteTo" + suffix, [&ik, &robot_status]() {
+    ik.WriteTo(&robot_status);
+    DoNotOptimize(robot_status.cables[0]);
+  });
+}
+
+void BenchForwardKinematics(MicroBench& bench, const grabcdpr::Params& config,
+                            const size_t actuators_num)
+{
+  ForwardKinematics fk(MakeSyntheticConfig(config, actuators_num));
+  if (!fk.IsObservable())
+    return;
+
+  // Measurements consistent with the first guess, then slightly jittered at every call,
+  // so that the estimate is always warm started yet never already converged
+  ActuatorsState actuators_state;
+  actuators_state.Setup(vect<id_t>(actuators_num, 0));
+  for (size_t i = 0; i < actuators_num; i++)
+  {
+    const CableKinematics& cable = fk.GetInverseKinematics().GetCable(i);
+    actuators_state.SetCalibration(i, 1e-6, 0.0); // 1 count = 1 um
+    actuators_state.SetHomeConfig(i, 0, cable.length, 0, cable.swivel_ang);
+  }
+  int32_t jitter           = 1; // [counts]
+  const std::string suffix = "/" + std::to_string(actuators_num);
+  bench.Run("ForwardKinematics::Update" + suffix, [&fk, &actuators_state, &jitter]() {
+    jitter = 1 - jitter;
+    actuators_state.SetCounts(0, 0, 0, jitter, 0, 0, 0);
+    actuators_state.ConvertCounts();
+    DoNotOptimize(fk.Update(actuators_state));
+  });
+}
+
+void BenchControllerSingleDrive(MicroBench& bench, const uint32_t period_nsec)
+{
+  grabcdpr::Vars robot_status;
+  ActuatorsState actuators_state;
+  actuators_state.Setup(vect<id_t>(1, 0));
+  actuators_state.SetCounts(0, 0, 0, 0, 0, 100, 0);
+  ControlActions ctrl_actions;
+  ctrl_actions.SetCapacity(1);
+
+  ControllerSingleDrive controller(0, period_nsec);
+  const auto calc_ctrl_actions = [&]() {
+    ctrl_actions.Clear();
+    controller.CalcCtrlActions(robot_status, actuators_state, &ctrl_actions);
+    DoNotOptimize(ctrl_actions[0]);
+  };
+
+  controller.SetMode(CABLE_LENGTH);
+  controller.SetCableLenTarget(1.0);
+  controller.CableLenIncrement(true);
+  bench.Run("ControllerSingleDrive::CalcCtrlActions/CABLE_LENGTH", calc_ctrl_actions);
+
+  // Very long trajectory, so that target is never reached while measuring
+  controller.SetMode(MOTOR_POSITION);
+  controller.SetMotorPosTarget(1000000, true, 1.0e6);
+  bench.Run("ControllerSingleDrive::CalcCtrlActions/MOTOR_POSITION", calc_ctrl_actions);
+
+  controller.SetMode(MOTOR_SPEED);
+  controller.SetMotorSpeedTarget(100000);
+  bench.Run("ControllerSingleDrive::CalcCtrlActions/MOTOR_SPEED", calc_ctrl_actions);
+
+  controller.SetMode(MOTOR_TORQUE);
+  controller.SetMotorTorqueTarget(200); // far from measured torque: PID stays active
+  bench.Run("ControllerSingleDrive::CalcCtrlActions/MOTOR_TORQUE", calc_ctrl_actions);
+
+  controller.SetMode(MOTOR_POSITION);
+  controller.SetMotorPosTarget(1000000, true, 1.0e6);
+  bench.Run("ControllerSingleDrive::CalcPoly5Waypoint", [&controller]() {
+    int32_t q = BenchAccess::CalcPoly5Waypoint(&controller, 0, 1000000, 800000);
+    DoNotOptimize(q);
+  });
+
+  // One set point pushed and consumed per cycle, as when streaming a dense trajectory
+  Setpoint setpoint;
+  setpoint.timestamp             = 0.0;
+  setpoint.action.motor_id       = 0;
+  setpoint.action.ctrl_mode      = MOTOR_POSITION;
+  setpoint.action.motor_position = 0;
+  controller.OpenSetpointsStream(1024);
+  bench.Run("ControllerBase::ConsumeSetpoints", [&]() {
+    setpoint.action.motor_position++;
+    controller.PushSetpoint(setpoint);
+    DoNotOptimize(controller.ConsumeSetpoints(1.0));
+  });
+}
+
+void BenchControllerMultiDrive(MicroBench& bench, const uint32_t period_nsec,
+                               const size_t actuators_num)
+{
+  grabcdpr::Vars robot_status;
+  vect<id_t> motors_id(actuators_num);
+  vect<int32_t> targets(actuators_num);
+  for (size_t i = 0; i < actuators_num; i++)
+  {
+    motors_id[i] = static_cast<id_t>(i);
+    targets[i]   = 1000000 * static_cast<int32_t>(i + 1);
+  }
+  ActuatorsState actuators_state;
+  actuators_state.Setup(motors_id);
+  ControlActions ctrl_actions;
+  ctrl_actions.SetCapacity(actuators_num);
+
+  // Very long trajectory, so that target is never reached while measuring
+  ControllerMultiDrive controller(motors_id, period_nsec);
+  controller.SetMode(MOTOR_POSITION);
+  controller.SetMotorsPosTarget(targets, 1.0e6);
+  const std::string suffix = "/" + std::to_string(actuators_num);
+  bench.Run("ControllerMultiDrive::CalcCtrlActions" + suffix, [&]() {
+    ctrl_actions.Clear();
+    controller.CalcCtrlActions(robot_status, actuators_state, &ctrl_actions);
+    DoNotOptimize(ctrl_actions[0]);
+  });
+}
+
+void BenchPoly5Trajectory(MicroBench& bench, const uint32_t period_nsec)
+{
+  const double period_sec = period_nsec * 0.000000001;
+  const double duration   = 10.0;
+  Poly5Trajectory evaluated;
+  evaluated.Plan(duration, period_sec);
+  evaluated.Start(0.0, 1000000.0);
+  Poly5Trajectory precomputed;
+  precomputed.Plan(duration, period_sec, true);
+  precomputed.Start(0.0, 1000000.0);
+
+  // Sweep all cycles of the trajectory, without ever reaching its end
+  uint64_t cycle = 0;
+  bench.Run("Poly5Trajectory::At/evaluated", [&]() {
+    DoNotOptimize(evaluated.At(cycle));
+    cycle = (cycle + 1) % evaluated.CyclesNum();
+  });
+  cycle = 0;
+  bench.Run("Poly5Trajectory::At/precomputed", [&]() {
+    DoNotOptimize(precomputed.At(cycle));
+    cycle = (cycle + 1) % precomputed.CyclesNum();
+  });
+}
+
+void BenchSerialization(MicroBench& bench)
+{
+  ActuatorStatus status;
+  status.id             = 3;
+  status.op_mode        = 8;
+  status.motor_position = 123456;
+  status.motor_speed    = -4321;
+  status.motor_torque   = 250;
+  status.cable_length   = 1.234;
+  status.aux_position   = 98765;
+  status.pulley_angle   = 0.5;
+  const ActuatorStatusMsg msg(1.5, status);
+
+  char buffer[ActuatorStatusMsg::kWireSize];
+  bench.Run("ActuatorStatusMsg::serialize", [&msg, &buffer]() {
+    DoNotOptimize(msg.serialize(buffer));
+    DoNotOptimize(buffer);
+  });
+  bench.Run("ActuatorStatusMsg::serialized", [&msg]() {
+    QByteArray data = msg.serialized();
+    DoNotOptimize(data.constData());
+  });
+  msg.serialize(buffer);
+  ActuatorStatusMsg out_msg;
+  bench.Run("ActuatorStatusMsg::deserialize", [&buffer, &out_msg]() {
+    out_msg.deserialize(buffer, sizeof(buffer));
+    DoNotOptimize(out_msg.body);
+  });
+}
+
+} // end namespace
+
+int main(int argc, char* argv[])
+{
+  START_EASYLOGGINGPP(argc, argv);
+  el::Loggers::configureFromGlobal(SRCDIR "/config/logs.conf");
+  QCoreApplication app(argc, argv);
+
+  BenchOptions options;
+  if (!ParseOptions(argc, argv, &options))
+  {
+    std::cerr << "Usage: " << argv[0]
+              << " [--config FILE] [--actuators N1,N2,...] [--baseline FILE]"
+                 " [--update-baseline] [--tolerance REL] [--min-time SEC]"
+              << std::endl;
+    return -1;
+  }
+
+  QString config_filename = QString::fromStdString(options.config_filename);
+  grabcdpr::Params config;
+  RobotConfigJsonParser parser;
+  if (!parser.ParseFile(config_filename, &config) || config.actuators.empty())
+  {
+    std::cerr << "[ERROR] Invalid configuration file " << options.config_filename
+              << std::endl;
+    return -1;
+  }
+
+  // Allocations are measured on purpose here: count them, do not report nor trap them.
+  RtAllocGuard::SetTrapOnViolation(false);
+  RtAllocGuard::SetReportOnViolation(false);
+
+  MicroBench bench(options.min_time_sec);
+  for (const size_t actuators_num : options.actuators_num)
+    BenchRobot(bench, config, actuators_num);
+  for (const size_t actuators_num : options.actuators_num)
+    BenchInverseKinematics(bench, config, actuators_num);
+  for (const size_t actuators_num : options.actuators_num)
+    BenchForwardKinematics(bench, config, actuators_num);
+  BenchControllerSingleDrive(bench, 1000000);
+  for (const size_t actuators_num : options.actuators_num)
+    BenchControllerMultiDrive(bench, 1000000, actuators_num);
+  BenchPoly5Trajectory(bench, 1000000);
+  BenchSerialization(bench);
+  bench.PrintResults(std::cout);
+
+  if (options.baseline_filename.empty())
+    return 0;
+  if (options.update_baseline)
+  {
+    if (!bench.WriteBaseline(options.baseline_filename))
+    {
+      std::cerr << "[ERROR] Could not write baseline " << options.baseline_filename
+                << std::endl;
+      return -1;
+    }
+    std::cout << "Baseline updated: " << options.baseline_filename << std::endl;
+    return 0;
+  }
+  const int failures_num =
+    bench.CompareWithBaseline(options.baseline_filename, options.tolerance, std::cout);
+  if (failures_num < 0)
+  {
+    std::cerr << "[ERROR] Could not read baseline " << options.baseline_filename
+              << std::endl;
+    return -1;
+  }
+  std::cout << failures_num << " failure(s) against baseline" << std::endl;
+  return failures_num;
+}
@@ -0,0 +1,20 @@
+# Benchmark suite of the real-time hot path of CableRobotApp, built out of the very same
+# sources (see cable_robot.pri). See bench_main.cpp for usage.
+
+include($$PWD/../cable_robot.pri)
+
+# Heap allocations per operation are measured by interposing the allocator
+DEFINES += CABLE_ROBOT_RT_ALLOC_GUARD
+
+HEADERS += \
+    $$PWD/microbench.h
+
+SOURCES += \
+    $$PWD/bench_main.cpp \
+    $$PWD/microbench.cpp
+
+INCLUDEPATH += $$PWD
+
+TEMPLATE = app
+
+TARGET = CableRobotBench
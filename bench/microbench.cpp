@@ -0,0 +1,193 @@
+/**
+ * @file microbench.cpp
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing definitions of functions and class declared in microbench.h.
+ */
+
+#include "microbench.h"
+
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "json.hpp"
+
+using json = nlohmann::json; /**< Alias for json namespace. */
+
+constexpr uint64_t MicroBench::kWarmupIterations_;
+constexpr uint64_t MicroBench::kMaxIterations_;
+
+//------------------------------------------------------------------------------------//
+//--------- PerfCacheMissesCounter class ---------------------------------------------//
+//------------------------------------------------------------------------------------//
+
+PerfCacheMissesCounter::PerfCacheMissesCounter()
+{
+  perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.type           = PERF_TYPE_HARDWARE;
+  attr.size           = sizeof(attr);
+  attr.config         = PERF_COUNT_HW_CACHE_MISSES;
+  attr.disabled       = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv     = 1;
+  // Calling thread only, on any CPU
+  fd_ = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+PerfCacheMissesCounter::~PerfCacheMissesCounter()
+{
+  if (IsValid())
+    close(fd_);
+}
+
+void PerfCacheMissesCounter::Start()
+{
+  if (!IsValid())
+    return;
+  ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+  ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+}
+
+uint64_t PerfCacheMissesCounter::Stop()
+{
+  if (!IsValid())
+    return 0;
+  ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+  uint64_t count = 0;
+  if (read(fd_, &count, sizeof(count)) != sizeof(count))
+    return 0;
+  return count;
+}
+
+//------------------------------------------------------------------------------------//
+//--------- MicroBench class ---------------------------------------------------------//
+//------------------------------------------------------------------------------------//
+
+MicroBench::MicroBench(const double min_batch_time_sec /*= 0.1*/,
+                       const size_t batches_num /*= 5*/)
+  : min_batch_time_sec_(min_batch_time_sec),
+    batches_num_(std::max(batches_num, static_cast<size_t>(1)))
+{}
+
+//--------- Public functions ---------------------------------------------------------//
+
+void MicroBench::PrintResults(std::ostream& os) const
+{
+  const std::ios::fmtflags flags = os.flags();
+  os << std::left << std::setw(48) << "benchmark" << std::right << std::setw(12)
+     << "ns/op" << std::setw(12) << "allocs/op" << std::setw(14) << "misses/op"
+     << std::setw(12) << "iterations" << "\n";
+  os << std::fixed;
+  for (const BenchResult& result : results_)
+  {
+    os << std::left << std::setw(48) << result.name << std::right << std::setw(12)
+       << std::setprecision(1) << result.ns_per_op << std::setw(12);
+    if (result.allocs_per_op < 0.0)
+      os << "n/a";
+    else
+      os << std::setprecision(3) << result.allocs_per_op;
+    os << std::setw(14);
+    if (result.cache_misses_per_op < 0.0)
+      os << "n/a";
+    else
+      os << std::setprecision(3) << result.cache_misses_per_op;
+    os << std::setw(12) << result.iterations << "\n";
+  }
+  os.flags(flags);
+}
+
+bool MicroBench::WriteBaseline(const std::string& filename) const
+{
+  json baseline;
+  for (const BenchResult& result : results_)
+  {
+    json entry;
+    entry["ns_per_op"] = result.ns_per_op;
+    if (result.allocs_per_op < 0.0)
+      entry["allocs_per_op"] = nullptr;
+    else
+      entry["allocs_per_op"] = result.allocs_per_op;
+    baseline["benchmarks"][result.name] = entry;
+  }
+
+  std::ofstream ofile(filename);
+  if (!ofile.is_open())
+    return false;
+  ofile << baseline.dump(2) << std::endl;
+  return ofile.good();
+}
+
+int MicroBench::CompareWithBaseline(const std::string& filename, const double tolerance,
+                                    std::ostream& os) const
+{
+  std::ifstream ifile(filename);
+  if (!ifile.is_open())
+    return -1;
+  json baseline;
+  try
+  {
+    ifile >> baseline;
+  }
+  catch (json::parse_error&)
+  {
+    return -1;
+  }
+  if (baseline.count("benchmarks") == 0)
+    return -1;
+  const json& benchmarks = baseline["benchmarks"];
+
+  int failures_num = 0;
+  for (const BenchResult& result : results_)
+  {
+    if (benchmarks.count(result.name) == 0)
+    {
+      os << "NEW:  " << result.name << " (not in baseline)\n";
+      failures_num++;
+      continue;
+    }
+    const json& entry = benchmarks[result.name];
+    if (entry.count("ns_per_op") == 0 || !entry["ns_per_op"].is_number())
+    {
+      os << "UNSET: " << result.name << " (no timing in baseline)\n";
+      failures_num++;
+    }
+    else
+    {
+      const double ref = entry["ns_per_op"];
+      if (result.ns_per_op > ref * (1.0 + tolerance))
+      {
+        os << "SLOW: " << result.name << ": " << result.ns_per_op << " ns/op vs " << ref
+           << " ns/op in baseline\n";
+        failures_num++;
+      }
+    }
+    if (entry.count("allocs_per_op") > 0 && entry["allocs_per_op"].is_number() &&
+        result.allocs_per_op >= 0.0)
+    {
+      const double ref = entry["allocs_per_op"];
+      if (result.allocs_per_op > ref)
+      {
+        os << "HEAP: " << result.name << ": " << result.allocs_per_op
+           << " allocs/op vs " << ref << " allocs/op in baseline\n";
+        failures_num++;
+      }
+    }
+  }
+  return failures_num;
+}
+
+//--------- Private functions --------------------------------------------------------//
+
+double MicroBench::NowSec()
+{
+  timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec * 1e-9;
+}
@@ -0,0 +1,203 @@
+/**
+ * @file microbench.h
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing a minimal microbenchmark harness for the real-time hot path of
+ * cable robot app, reporting time, heap allocations and cache misses per operation.
+ */
+
+#ifndef CABLE_ROBOT_MICROBENCH_H
+#define CABLE_ROBOT_MICROBENCH_H
+
+#include <algorithm>
+#include <ostream>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "utils/rt_alloc_guard.h"
+
+/**
+ * @brief Prevent the compiler from optimizing away a value computed in a benchmark.
+ * @param[in] value The value to be kept.
+ */
+template <typename T> inline void DoNotOptimize(const T& value)
+{
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * @brief A hardware cache misses counter of the calling thread, based on Linux perf
+ * events.
+ *
+ * If perf events are not available, e.g. because of kernel settings
+ * (`/proc/sys/kernel/perf_event_paranoid`) or virtualization, the counter is simply
+ * invalid and all its methods are no-ops.
+ */
+class PerfCacheMissesCounter
+{
+ public:
+  PerfCacheMissesCounter();
+  ~PerfCacheMissesCounter();
+
+  /**
+   * @brief Check if counter is available.
+   * @return _True_ if counter is available, _false_ otherwise.
+   */
+  bool IsValid() const { return fd_ >= 0; }
+  /**
+   * @brief Reset and start counting.
+   */
+  void Start();
+  /**
+   * @brief Stop counting.
+   * @return The number of cache misses since last Start(), 0 if counter is not valid.
+   */
+  uint64_t Stop();
+
+ private:
+  int fd_;
+};
+
+/**
+ * @brief The result of a single microbenchmark.
+ */
+struct BenchResult
+{
+  std::string name;           /**< Unique name of the benchmark. */
+  uint64_t iterations;        /**< Number of measured operations per batch. */
+  double ns_per_op;           /**< [nsec] Best time per operation among batches. */
+  double allocs_per_op;       /**< Worst heap allocations per op, -1 if unknown. */
+  double cache_misses_per_op; /**< Best cache misses per operation, -1 if unknown. */
+};
+
+/**
+ * @brief A minimal microbenchmark harness.
+ *
+ * Each benchmark is a callable performing exactly one operation. The harness warms it
+ * up, calibrates the number of iterations to fill a minimum batch time and reports the
+ * best time per operation over a few batches, which is the most robust estimate against
+ * preemption and frequency scaling noise.
+ *
+ * Heap allocations are counted by means of RtAllocGuard, hence only if the benchmark is
+ * built with `CABLE_ROBOT_RT_ALLOC_GUARD` defined, while cache misses are counted via
+ * PerfCacheMissesCounter, when available.
+ *
+ * Results can be stored as a JSON baseline and later compared against it, both time and
+ * allocations. Timings are only comparable on the machine the baseline was recorded on.
+ */
+class MicroBench
+{
+ public:
+  /**
+   * @brief MicroBench constructor.
+   * @param[in] min_batch_time_sec _[sec]_ Minimum duration of a measured batch.
+   * @param[in] batches_num Number of measured batches.
+   */
+  MicroBench(const double min_batch_time_sec = 0.1, const size_t batches_num = 5);
+
+  /**
+   * @brief Run a benchmark and store its result.
+   * @param[in] name Unique name of the benchmark.
+   * @param[in] operation A callable performing exactly one operation.
+   * @return The result of the benchmark.
+   */
+  template <typename Operation>
+  const BenchResult& Run(const std::string& name, Operation&& operation);
+
+  /**
+   * @brief Get all results collected so far.
+   * @return All results collected so far.
+   */
+  const std::vector<BenchResult>& GetResults() const { return results_; }
+  /**
+   * @brief Print all results collected so far as a table.
+   * @param[out] os Output stream.
+   */
+  void PrintResults(std::ostream& os) const;
+
+  /**
+   * @brief Write all results collected so far as a JSON baseline file.
+   * @param[in] filename Path of the JSON baseline file.
+   * @return _True_ if file could be written, _false_ otherwise.
+   */
+  bool WriteBaseline(const std::string& filename) const;
+  /**
+   * @brief Compare all results collected so far against a JSON baseline file.
+   *
+   * A result fails if it is slower than the baseline by more than the given relative
+   * tolerance, if it allocates more than the baseline or if it has no timing in the
+   * baseline (_null_ or missing entry), so that an incomplete baseline never passes.
+   * @param[in] filename Path of the JSON baseline file.
+   * @param[in] tolerance Relative time tolerance, e.g. 0.2 for 20%.
+   * @param[out] os Output stream where comparison is reported.
+   * @return The number of failed results, or -1 if baseline file could not be read.
+   */
+  int CompareWithBaseline(const std::string& filename, const double tolerance,
+                          std::ostream& os) const;
+
+ private:
+  static constexpr uint64_t kWarmupIterations_ = 1000;
+  static constexpr uint64_t kMaxIterations_    = 100000000;
+
+  double min_batch_time_sec_;
+  size_t batches_num_;
+  PerfCacheMissesCounter cache_misses_counter_;
+  std::vector<BenchResult> results_;
+
+  static double NowSec();
+};
+
+template <typename Operation>
+const BenchResult& MicroBench::Run(const std::string& name, Operation&& operation)
+{
+  for (uint64_t i = 0; i < kWarmupIterations_; i++)
+    operation();
+
+  // Calibrate iterations number to fill the minimum batch time
+  uint64_t iterations = 1;
+  while (iterations < kMaxIterations_)
+  {
+    const double t0 = NowSec();
+    for (uint64_t i = 0; i < iterations; i++)
+      operation();
+    if (NowSec() - t0 >= min_batch_time_sec_)
+      break;
+    iterations *= 2;
+  }
+
+  BenchResult result;
+  result.name                = name;
+  result.iterations          = iterations;
+  result.ns_per_op           = -1.0;
+  result.allocs_per_op       = RtAllocGuard::Enabled() ? 0.0 : -1.0;
+  result.cache_misses_per_op = -1.0;
+  for (size_t b = 0; b < batches_num_; b++)
+  {
+    const uint64_t allocs0 = RtAllocGuard::ViolationsCount();
+    cache_misses_counter_.Start();
+    RtAllocGuard::Arm();
+    const double t0 = NowSec();
+    for (uint64_t i = 0; i < iterations; i++)
+      operation();
+    const double elapsed = NowSec() - t0;
+    RtAllocGuard::Disarm();
+    const uint64_t cache_misses = cache_misses_counter_.Stop();
+    const uint64_t allocs       = RtAllocGuard::ViolationsCount() - allocs0;
+
+    const double ns_per_op = elapsed * 1e9 / iterations;
+    if (result.ns_per_op < 0.0 || ns_per_op < result.ns_per_op)
+      result.ns_per_op = ns_per_op;
+    if (RtAllocGuard::Enabled())
+      result.allocs_per_op =
+        std::max(result.allocs_per_op, static_cast<double>(allocs) / iterations);
+    const double misses_per_op = static_cast<double>(cache_misses) / iterations;
+    if (cache_misses_counter_.IsValid() &&
+        (result.cache_misses_per_op < 0.0 || misses_per_op < result.cache_misses_per_op))
+      result.cache_misses_per_op = misses_per_op;
+  }
+  results_.push_back(result);
+  return results_.back();
+}
+
+#endif // CABLE_ROBOT_MICROBENCH_H
@@ -8,12 +8,17 @@
 #ifndef CABLE_ROBOT_CONTROLLER_BASE_H
 #define CABLE_ROBOT_CONTROLLER_BASE_H
 
+#include <atomic>
+#include <memory>
 #include <stdint.h>
 #include <vector>
 
 #include "libcdpr/inc/types.h"
 #include "libgrabec/inc/slaves/goldsolowhistledrive.h"
 
+#include "robot/actuators_state.h"
+#include "utils/id_index_map.h"
+#include "utils/spsc_ring.h"
 #include "utils/types.h"
 
 template <typename T> using vect = std::vector<T>;  /**< Shortcut for vector type. */
@@ -51,6 +56,114 @@ struct ControlAction
   ControlMode ctrl_mode = ControlMode::NONE; /**< The control mode for the target motor */
 };
 
+/**
+ * @brief A timestamped set point, streamed to a controller from outside of the real time
+ * thread.
+ *
+ * Timestamps are on the same clock of ActuatorsSnapshot::timestamp, so that producers can
+ * schedule set points ahead of the latest published snapshot. Set points with a
+ * non-positive timestamp are due at once.
+ */
+struct Setpoint
+{
+  double timestamp;     /**< [sec] Due time, on the clock of the real time thread. */
+  ControlAction action; /**< Target motor, control mode and set point value. */
+};
+
+/**
+ * @brief A fixed-capacity buffer of control actions.
+ *
+ * The buffer is owned by the caller of the controller, i.e. the cable robot, which sizes
+ * it once from the number of active actuators. The controller then fills it at every
+ * cycle of the real time thread without any memory allocation.
+ */
+class ControlActions
+{
+ public:
+  /**
+   * @brief ControlActions default constructor, with null capacity.
+   */
+  ControlActions() : size_(0) {}
+  /**
+   * @brief ControlActions constructor.
+   * @param[in] capacity Maximum number of control actions that the buffer can hold.
+   */
+  explicit ControlActions(const size_t capacity) : actions_(capacity), size_(0) {}
+
+  /**
+   * @brief Set the maximum number of control actions that the buffer can hold.
+   * @param[in] capacity Maximum number of control actions.
+   * @note This operation allocates memory and clears the buffer, so do not use it inside
+   * the real time thread.
+   */
+  void SetCapacity(const size_t capacity)
+  {
+    actions_.resize(capacity);
+    size_ = 0;
+  }
+
+  /**
+   * @brief Empty the buffer, without releasing its memory.
+   */
+  void Clear() { size_ = 0; }
+  /**
+   * @brief Append a control action to the buffer.
+   * @param[in] action The control action to be appended.
+   * @return _True_ if the action was appended, _false_ if the buffer is full.
+   */
+  bool Push(const ControlAction& action)
+  {
+    if (size_ >= actions_.size())
+      return false;
+    actions_[size_++] = action;
+    return true;
+  }
+
+  /**
+   * @brief Get the number of control actions in the buffer.
+   * @return The number of control actions in the buffer.
+   */
+  size_t Size() const { return size_; }
+  /**
+   * @brief Get the maximum number of control actions that the buffer can hold.
+   * @return The maximum number of control actions that the buffer can hold.
+   */
+  size_t Capacity() const { return actions_.size(); }
+  /**
+   * @brief Check if buffer is empty.
+   * @return _True_ if buffer is empty, _false_ otherwise.
+   */
+  bool Empty() const { return size_ == 0; }
+
+  /**
+   * @brief Access a control action in the buffer, with no bound check.
+   * @param[in] idx The index of the control action.
+   * @return A reference to the control action.
+   */
+  ControlAction& operator[](const size_t idx) { return actions_[idx]; }
+  /**
+   * @brief Access a control action in the buffer, with no bound check.
+   * @param[in] idx The index of the control action.
+   * @return A const reference to the control action.
+   */
+  const ControlAction& operator[](const size_t idx) const { return actions_[idx]; }
+
+  /**
+   * @brief Iterator to the first control action, to be used in range-based for loops.
+   * @return A pointer to the first control action.
+   */
+  const ControlAction* begin() const { return actions_.data(); }
+  /**
+   * @brief Iterator past the last control action, to be used in range-based for loops.
+   * @return A pointer past the last control action.
+   */
+  const ControlAction* end() const { return actions_.data() + size_; }
+
+ private:
+  vect<ControlAction> actions_;
+  size_t size_;
+};
+
 /**
  * @brief The abstract base class for any cable robot controller.
  *
@@ -61,7 +174,8 @@ struct ControlAction
  * Make sure that the computational time of your new controller stays largely within 1ms
  * to have some margin for other cyclic operations. Because the controller is a shared
  * pointer between threads, be sure to lock the robot mutex when accessing it from
- * outside. Any controller is characterized by a set of targeted motors id and their
+ * outside. The only exception is the set points stream, see OpenSetpointsStream(), which
+ * is lock-free. Any controller is characterized by a set of targeted motors id and their
  * relative control mode at drive level.
  */
 class ControllerBase
@@ -111,6 +225,18 @@ class ControllerBase
    */
   void SetMode(const id_t motor_id, const ControlMode mode);
 
+  /**
+   * @brief Set the index of actuators state, i.e. where to find the slot of each actuator
+   * in the state given at every cycle to CalcCtrlActions().
+   * @param[in] actuators_index Shared map from actuator ID to its slot in actuators
+   * state. If not given, the slot of a motor is looked for by linear search.
+   * @note This is typically handed by the cable robot, see CableRobot::SetController().
+   */
+  void SetActuatorsIndex(const std::shared_ptr<const IdIndexMap>& actuators_index)
+  {
+    actuators_index_ = actuators_index;
+  }
+
   /**
    * @brief Get IDs of currently controlled motors.
    * @return IDs of currently controlled motors.
@@ -128,22 +254,76 @@ class ControllerBase
    */
   vect<ControlMode> GetModes() const { return modes_; }
 
+  /**
+   * @brief Open the set points stream of this controller.
+   *
+   * The stream is a wait-free single-producer/single-consumer queue of timestamped set
+   * points, which lets one non real time thread, e.g. an external planner, push many
+   * set points ahead without locking the robot mutex. The real time thread then applies
+   * them as they are due, see ConsumeSetpoints().
+   * @param[in] capacity Minimum number of set points which can be queued at once.
+   * @note This operation allocates memory and drops any queued set point, so do not use
+   * it inside the real time thread, nor while the controller is in use without locking
+   * the robot mutex.
+   */
+  void OpenSetpointsStream(const size_t capacity);
+  /**
+   * @brief Queue a set point, to be applied once due.
+   * @param[in] setpoint The set point to be queued. Set points must be pushed in
+   * chronological order.
+   * @return _True_ if the set point was queued, _false_ if the stream is not open or
+   * full.
+   * @note Wait-free, to be called by a single producer thread.
+   */
+  bool PushSetpoint(const Setpoint& setpoint);
+  /**
+   * @brief Apply all queued set points which are due, oldest first.
+   * @param[in] timestamp [sec] Current time, on the clock of the real time thread.
+   * @return The number of set points applied.
+   * @note Wait-free, called by the real time thread at every cycle, right before
+   * CalcCtrlActions().
+   */
+  size_t ConsumeSetpoints(const double timestamp);
+  /**
+   * @brief Drop all queued set points which are due, without applying them.
+   * @param[in] timestamp [sec] Current time, on the clock of the real time thread.
+   * @return The number of set points dropped, which are accounted as lost.
+   * @note Wait-free, called by the real time thread instead of ConsumeSetpoints() while
+   * the robot holds its set points, e.g. after too many cycle overruns.
+   */
+  size_t DiscardSetpoints(const double timestamp);
+  /**
+   * @brief Get the number of queued set points.
+   * @return The number of queued set points, approximate if called while the stream is
+   * in use. The next set point, if already popped but not due yet, is not counted.
+   */
+  size_t PendingSetpoints() const;
+  /**
+   * @brief Get the number of set points lost so far, either because the stream was full,
+   * or because the controller could not apply them, or because they were discarded.
+   * @return The number of set points lost so far.
+   */
+  uint64_t DroppedSetpoints() const;
+
   /**
    * @brief Calculate control actions depending on current robot status.
    *
    * This is the main method of this class, which is called at every cycle of the real
    * time thread and needs to be overridden by any derived class.
    * Given current robot configuration, possibly resulting from a state estimator, and
-   * actuators status provided by proprioceptive sensors, control actions for each
+   * actuators state provided by proprioceptive sensors, control actions for each
    * targeted motor are computed.
    * @param[in] robot_status Cable robot status, in terms of platform configuration.
-   * @param[in] actuators_status Actuators status, in terms of drives, winches, pulleys
-   * and cables configuration.
-   * @return Control actions for each targeted motor.
+   * @param[in] actuators_state Actuators state, in terms of drives, winches, pulleys
+   * and cables configuration, one array per field.
+   * @param[out] ctrl_actions Preallocated buffer to be filled with control actions for
+   * each targeted motor. It is cleared by the caller beforehand.
+   * @warning This method lives in the real time thread: it must not allocate any memory,
+   * hence the fixed-capacity output buffer.
    */
-  virtual vect<ControlAction>
-  CalcCtrlActions(const grabcdpr::Vars& robot_status,
-                  const vect<ActuatorStatus>& actuators_status) = 0;
+  virtual void CalcCtrlActions(const grabcdpr::Vars& robot_status,
+                               const ActuatorsState& actuators_state,
+                               ControlActions* ctrl_actions) = 0;
 
   /**
    * @brief Check if control target was reached.
@@ -151,9 +331,53 @@ class ControllerBase
    */
   virtual bool TargetReached() const = 0;
 
+  /**
+   * @brief Notify the controller that whole real time cycles were lost, i.e. that it was
+   * not called for a while.
+   *
+   * Controllers following a time law override this method to move forward by the lost
+   * cycles, so that their trajectory stays consistent with time. By default nothing
+   * happens.
+   * @param[in] cycles_num Number of lost cycles.
+   * @warning This method lives in the real time thread: it must not allocate any memory.
+   */
+  virtual void OnCyclesSkipped(const uint64_t /*cycles_num*/) {}
+
  protected:
   vect<id_t> motors_id_;    /**< IDs of the motors to be controlled. */
   vect<ControlMode> modes_; /**< Control modes of each motor. */
+  IdIndexMap motors_index_; /**< Map from motor ID to its slot in motors_id_. */
+
+  /**
+   * @brief Find the slot of a motor in actuators state.
+   * @param[in] actuators_state Actuators state, as given to CalcCtrlActions().
+   * @param[in] motor_id The ID of the inquired motor.
+   * @return The slot of inquired motor, or IdIndexMap::kNotFound if not found.
+   * @note Lookup is O(1) once the actuators index is set, see SetActuatorsIndex().
+   */
+  size_t FindSlot(const ActuatorsState& actuators_state, const id_t motor_id) const;
+
+  /**
+   * @brief Apply a streamed set point, i.e. turn it into the target of a motor.
+   *
+   * Derived classes supporting set points streaming override this method, which lives
+   * in the real time thread. By default any set point is rejected.
+   * @param[in] setpoint The set point to be applied.
+   * @return _True_ if the set point was applied, _false_ if it was rejected, e.g.
+   * because its motor is not controlled or its control mode does not match.
+   * @warning This method lives in the real time thread: it must not allocate any memory.
+   */
+  virtual bool ApplySetpoint(const ControlAction& setpoint);
+
+ private:
+  std::shared_ptr<const IdIndexMap> actuators_index_;
+
+  std::unique_ptr<SpscRing<Setpoint>> setpoints_;
+  Setpoint next_setpoint_; // popped but not due yet
+  bool next_setpoint_ready_ = false;
+  std::atomic<uint64_t> rejected_setpoints_{0}; // written by real time thread only
+
+  size_t PopDueSetpoints(const double timestamp, const bool apply);
 };
 
 #endif // CABLE_ROBOT_CONTROLLER_BASE_H
@@ -0,0 +1,132 @@
+/**
+ * @file controller_multidrive.h
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing a multi drive controller class for cable robot, moving all
+ * targeted drives at once along synchronized trajectories.
+ */
+
+#ifndef CABLE_ROBOT_CONTROLLER_MULTIDRIVE_H
+#define CABLE_ROBOT_CONTROLLER_MULTIDRIVE_H
+
+#include "ctrl/controller_base.h"
+#include "ctrl/poly5_trajectory.h"
+#include "grabcommon.h"
+
+/**
+ * @brief A multi drive control class for cable robot, moving all targeted drives at once.
+ *
+ * Given a target per motor, either in cable length or motor position, every targeted
+ * motor is moved from its current configuration along a polynomial trajectory of 5th
+ * order with zero initial and final velocity and acceleration. All trajectories share
+ * the same duration and normalized profile, so that all motors start and finish
+ * together, i.e. the robot follows a straight line in joint space, and the control
+ * action of every motor is computed in one single call (see Poly5Trajectory).
+ *
+ * This is used whenever several cables need to be moved to a known configuration, such
+ * as going to home position, instead of moving them one by one with
+ * ControllerSingleDrive.
+ */
+class ControllerMultiDrive: public ControllerBase
+{
+ public:
+  /**
+   * @brief ControllerMultiDrive targetless constructor.
+   * @param[in] period_nsec Controller sample period in nanoseconds.
+   */
+  ControllerMultiDrive(const uint32_t period_nsec);
+  /**
+   * @brief ControllerMultiDrive full constructor.
+   * @param[in] motors_id IDs of the motors to be controlled.
+   * @param[in] period_nsec Controller sample period in nanoseconds.
+   */
+  ControllerMultiDrive(const vect<id_t>& motors_id, const uint32_t period_nsec);
+
+  /**
+   * @brief Set cable lengths target in meters.
+   * @param[in] targets Cable lengths target in meters, one per controlled motor, in the
+   * same order as GetMotorsID().
+   * @param[in] time Time of trajectory execution. If not given, this value is computed
+   * so that no cable exceeds a safe speed.
+   * @note This target is effective only for motors whose control mode is
+   * ControlMode::CABLE_LENGTH. Moreover all previous targets are cleared when calling
+   * this functions.
+   */
+  void SetCableLensTarget(const vect<double>& targets, const double time = -1.0);
+  /**
+   * @brief Set motors position target, in encoder absolute counts.
+   * @param[in] targets Motors position target, in encoder absolute counts, one per
+   * controlled motor, in the same order as GetMotorsID().
+   * @param[in] time Time of trajectory execution. If not given, this value is computed
+   * so that no motor exceeds the maximum delta counts it can safely handle in a single
+   * cycle.
+   * @note This target is effective only for motors whose control mode is
+   * ControlMode::MOTOR_POSITION. Moreover all previous targets are cleared when calling
+   * this functions.
+   */
+  void SetMotorsPosTarget(const vect<int32_t>& targets, const double time = -1.0);
+
+  /**
+   * @brief Get duration of current trajectory.
+   * @return [sec] Duration of current trajectory, or a negative value if it did not
+   * start yet.
+   */
+  double GetTrajectoryTime() const { return new_trajectory_ ? -1.0 : traj_time_; }
+
+  /**
+   * @brief Check if all targets are reached.
+   * @return _True_ if all targets are reached, _false_ otherwise.
+   */
+  bool TargetReached() const override { return modes_.empty() ? false : on_target_; }
+
+  /**
+   * @brief Move current trajectory forward by the lost cycles, so that it stays
+   * consistent with time.
+   * @param[in] cycles_num Number of lost cycles.
+   */
+  void OnCyclesSkipped(const uint64_t cycles_num) override;
+
+  /**
+   * @brief Calculate control actions depending on current robot status.
+   *
+   * This is the main method of this class, which is called at every cycle of the real
+   * time thread.
+   * At the first call after a new target is set, current configuration of all targeted
+   * motors is taken from actuators state as initial point of the trajectory, whose
+   * duration is then fixed. From there on, the next waypoint of every motor is computed
+   * by elapsed cycles, regardless of actuators state.
+   * @param[in] robot_status Cable robot status, in terms of platform configuration.
+   * @param[in] actuators_state Actuators state, in terms of drives, winches, pulleys
+   * and cables configuration, one array per field.
+   * @param[out] ctrl_actions Preallocated buffer where a control action for each targeted
+   * motor is appended.
+   */
+  void CalcCtrlActions(const grabcdpr::Vars& robot_status,
+                       const ActuatorsState& actuators_state,
+                       ControlActions* ctrl_actions) override;
+
+ private:
+  static constexpr double kAbsMaxLengthSpeed_ = 0.02;   // [m/s]
+  static constexpr double kAbsMaxSpeed_       = 800000; // [counts/s]
+  static constexpr double kMinTrajTime_       = 1.0;    // [sec]
+  // Peak speed of a 5th order polynomial with null boundary velocity and acceleration,
+  // over its mean speed
+  static constexpr double kPoly5PeakSpeedRatio_ = 1.875;
+
+  double period_sec_;
+  ControlMode target_mode_; // either CABLE_LENGTH, MOTOR_POSITION or NONE if no target
+  vect<double> targets_;
+  vect<double> initials_;
+
+  Poly5Trajectory profile_; // normalized, from 0 to 1
+  double traj_time_;        /**< [sec] */
+  bool new_trajectory_;
+  bool on_target_;
+
+  void SetTargets(const ControlMode mode, const vect<double>& targets, const double time);
+  void StartTrajectory(const ActuatorsState& actuators_state);
+
+  bool ApplySetpoint(const ControlAction& setpoint) override;
+};
+
+#endif // CABLE_ROBOT_CONTROLLER_MULTIDRIVE_H
@@ -11,6 +11,7 @@
 #include "lib/grab_common/pid/pid.h"
 
 #include "ctrl/controller_base.h"
+#include "ctrl/poly5_trajectory.h"
 #include "grabcommon.h"
 
 /**
@@ -167,6 +168,14 @@ class ControllerSingleDrive: public ControllerBase
    */
   bool TargetReached() const override { return modes_.empty() ? false : on_target_; }
 
+  /**
+   * @brief Move current motor position trajectory forward by the lost cycles, if any, so
+   * that it stays consistent with time.
+   * @param[in] cycles_num Number of lost cycles.
+   * @note Cable length and motor torque increments are not caught up, to avoid steps.
+   */
+  void OnCyclesSkipped(const uint64_t cycles_num) override;
+
   /**
    * @brief Calculate control actions depending on current robot status.
    *
@@ -184,13 +193,14 @@ class ControllerSingleDrive: public ControllerBase
    * - motor torque target is filtered through a PI controller before being assigned to
    * the end drive to avoid aggressive, possibly unfeasible deltas.
    * @param[in] robot_status Cable robot status, in terms of platform configuration.
-   * @param[in] actuators_status Actuators status, in terms of drives, winches, pulleys
-   * and cables configuration.
-   * @return Control actions for each targeted motor.
+   * @param[in] actuators_state Actuators state, in terms of drives, winches, pulleys
+   * and cables configuration, one array per field.
+   * @param[out] ctrl_actions Preallocated buffer where the control action for the single
+   * targeted motor is appended.
    */
-  vect<ControlAction>
-  CalcCtrlActions(const grabcdpr::Vars& robot_status,
-                  const vect<ActuatorStatus>& actuators_status) override;
+  void CalcCtrlActions(const grabcdpr::Vars& robot_status,
+                       const ActuatorsState& actuators_state,
+                       ControlActions* ctrl_actions) override;
 
  private:
   static constexpr double kAbsDeltaLengthMicroPerSec_ = 0.005;     // [m/s]
@@ -241,16 +251,21 @@ class ControllerSingleDrive: public ControllerBase
   const ParamsPID torque_pid_params_ = {0.0263, 15.847,         0.,
                                         0.,     kAbsMaxTorque_, -kAbsMaxTorque_};
 
+  Poly5Trajectory trajectory_;
   double traj_time_; /**< [sec] */
   bool new_trajectory_ = false;
   bool apply_trajectory_;
 
-  int32_t CalcMotorPos(const vect<ActuatorStatus>& actuators_status);
-  int16_t CalcMotorTorque(const vect<ActuatorStatus>& actuators_status);
+  int32_t CalcMotorPos(const ActuatorsState& actuators_state);
+  int16_t CalcMotorTorque(const ActuatorsState& actuators_state);
 
   int32_t CalcPoly5Waypoint(const int32_t q, const int32_t q_final, const int32_t max_dq);
 
+  bool ApplySetpoint(const ControlAction& setpoint) override;
+
   void Clear();
+
+  friend class BenchAccess; // benchmark suite, see bench/bench_main.cpp
 };
 
 #endif // CABLE_ROBOT_CONTROLLER_SINGLEDRIVE_H
@@ -0,0 +1,130 @@
+/**
+ * @file poly5_trajectory.h
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing a rest-to-rest trajectory of 5th order, sampled at every cycle
+ * of the real time thread.
+ */
+
+#ifndef CABLE_ROBOT_POLY5_TRAJECTORY_H
+#define CABLE_ROBOT_POLY5_TRAJECTORY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+/**
+ * @brief A rest-to-rest trajectory of 5th order, sampled at every cycle of the real time
+ * thread.
+ *
+ * The trajectory moves from an initial to a final value with null initial and final
+ * velocity and acceleration, following the normalized profile
+ * @f[ s(\tau) = 10 \tau^3 - 15 \tau^4 + 6 \tau^5, \qquad \tau = t / T @f]
+ * whose position, velocity and acceleration are evaluated by Horner's rule. Time is
+ * given by the index of the cycle since the trajectory started, not by the wall clock,
+ * so that the trajectory is deterministic and every instance is independent.
+ *
+ * Planning and starting are split, so that the normalized profile can be optionally
+ * precomputed for every cycle when duration is known beforehand, e.g. when a target is
+ * set outside of the real time thread, while the actual boundary values are given when
+ * the trajectory starts inside of it. Starting and stepping never allocate memory.
+ */
+class Poly5Trajectory
+{
+ public:
+  /**
+   * @brief A trajectory sample.
+   */
+  struct Waypoint
+  {
+    double position;     /**< Position, in trajectory units. */
+    double velocity;     /**< Velocity, in trajectory units per second. */
+    double acceleration; /**< Acceleration, in trajectory units per second squared. */
+  };
+
+  /**
+   * @brief Poly5Trajectory default constructor, with null duration.
+   */
+  Poly5Trajectory();
+
+  /**
+   * @brief Plan trajectory duration.
+   * @param[in] duration [sec] Trajectory duration. If not positive, the final value is
+   * reached at once.
+   * @param[in] period_sec [sec] Sample period, i.e. real time cycle period.
+   * @param[in] precompute If _true_, the normalized profile is sampled at every cycle
+   * here, so that stepping reduces to a table lookup. This allocates memory, unless the
+   * profile is longer than an upper bound, in which case it is evaluated at every cycle
+   * anyway.
+   * @note Any started trajectory is stopped, see Start().
+   */
+  void Plan(const double duration, const double period_sec,
+            const bool precompute = false);
+  /**
+   * @brief Start the planned trajectory from cycle 0.
+   * @param[in] initial Initial value.
+   * @param[in] final Final value.
+   */
+  void Start(const double initial, const double final);
+
+  /**
+   * @brief Get the sample of current cycle and move to next one.
+   * @return The sample of current cycle, which is the final rest value once the
+   * trajectory is over.
+   */
+  Waypoint Step();
+  /**
+   * @brief Move forward by a number of cycles without sampling them, e.g. when real time
+   * cycles were lost, so that the trajectory stays consistent with time.
+   * @param[in] cycles_num Number of cycles to be skipped.
+   */
+  void Skip(const uint64_t cycles_num);
+  /**
+   * @brief Get the sample of a given cycle.
+   * @param[in] cycle Index of the cycle since the trajectory started.
+   * @return The sample of given cycle, which is the final rest value once the trajectory
+   * is over.
+   */
+  Waypoint At(const uint64_t cycle) const;
+
+  /**
+   * @brief Check if the trajectory is over, i.e. if the final value was reached.
+   * @return _True_ if the trajectory is over, _false_ otherwise.
+   */
+  bool Done() const { return cycle_ >= cycles_num_; }
+  /**
+   * @brief Get trajectory duration.
+   * @return [sec] Trajectory duration.
+   */
+  double Duration() const { return duration_; }
+  /**
+   * @brief Get the number of cycles before reaching the final value.
+   * @return The number of cycles before reaching the final value.
+   */
+  uint64_t CyclesNum() const { return cycles_num_; }
+  /**
+   * @brief Get the index of current cycle.
+   * @return The index of current cycle since the trajectory started.
+   */
+  uint64_t Cycle() const { return cycle_; }
+  /**
+   * @brief Check if the normalized profile is precomputed.
+   * @return _True_ if the normalized profile is precomputed, _false_ otherwise.
+   */
+  bool IsPrecomputed() const { return !profile_.empty(); }
+
+ private:
+  static constexpr uint64_t kMaxPrecomputedCycles_ = 1 << 20; // ~17 min at 1 kHz
+
+  double duration_;
+  double period_sec_;
+  uint64_t cycles_num_;
+  uint64_t cycle_;
+  double initial_;
+  double delta_;
+  std::vector<Waypoint> profile_; // normalized, empty if not precomputed
+
+  Waypoint Normalized(const uint64_t cycle) const;
+};
+
+#endif // CABLE_ROBOT_POLY5_TRAJECTORY_H
@@ -67,7 +67,7 @@ class HomingInterfaceProprioceptive: public HomingInterface
  private slots:
   void appendText2Browser(const QString& text);
   void updateAcquisitionProgress(const int value);
-  void updateOptimizationProgress(const int value);
+  void updateOptimizationProgress(const int value, const double best_residual);
 
   void handleAcquisitionComplete();
   void handleHomingComplete();
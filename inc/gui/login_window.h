@@ -22,6 +22,7 @@
 #include "libcdpr/inc/types.h"
 #include "main_gui.h"
 #include "robotconfigjsonparser.h"
+#include "utils/app_settings.h"
 
 using json = nlohmann::json; /**< Alias for json namespace. */
 
@@ -62,6 +63,7 @@ class LoginWindow: public QMainWindow
 
   QString username_;
   grabcdpr::Params config_;
+  AppSettings app_settings_;
 
   enum RetVal
   {
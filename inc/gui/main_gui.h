@@ -20,6 +20,7 @@
 #include "gui/calib/calibration_dialog.h"
 #include "gui/homing/homing_dialog.h"
 #include "robot/cablerobot.h"
+#include "utils/app_settings.h"
 
 using GSWDOpModes = grabec::GoldSoloWhistleOperationModes; /**< Shortcut for op modes. */
 
@@ -49,13 +50,21 @@ class MainGUI: public QDialog
    * @brief MainGUI constructor.
    * @param[in] parent The parent Qt object.
    * @param[in] config The configuration parameters of the cable robot.
+   * @param[in] settings The application settings, e.g. the EtherCAT network backend.
    */
-  MainGUI(QWidget* parent, const grabcdpr::Params& config);
+  MainGUI(QWidget* parent, const grabcdpr::Params& config,
+          const AppSettings& settings = AppSettings());
   ~MainGUI();
 
  private slots:
   void on_pushButton_reset_clicked();
 
+  void on_pushButton_rtStats_clicked();
+
+  void on_pushButton_resetOverruns_clicked();
+
+  void on_pushButton_record_toggled(bool checked);
+
   void on_pushButton_calib_clicked();
 
   void on_pushButton_homing_clicked();
@@ -107,11 +116,13 @@ class MainGUI: public QDialog
   HomingDialog* homing_dialog_     = NULL;
 
   grabcdpr::Params config_params_;
+  AppSettings app_settings_;
   CableRobot* robot_ptr_ = NULL;
 
   void StartRobot();
   void DeleteRobot();
   bool ExitReadyStateRequest();
+  bool OverrunsCleared();
   void CloseAllApps();
 
  private:
@@ -0,0 +1,94 @@
+/**
+ * @file homing_dataset.h
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing the in-memory dataset of the proprioceptive homing acquisition
+ * phase, with its binary snapshot format.
+ *
+ * A snapshot is made of a file header, listing the IDs of the active actuators, followed
+ * by all measurements in acquisition order, all of them in little-endian byte order and
+ * without any padding:
+ * @code
+ * header:  "CRHOMING" | version (u32) | actuators num (u32) | actuators ID (u32)...
+ *          | samples num (u32) | samples...
+ * sample:  actuator idx (u32) | cable lengths (f64)... | pulley angles (f64)...
+ * @endcode
+ * where cable lengths and pulley angles are as many as the actuators.
+ */
+
+#ifndef CABLE_ROBOT_HOMING_DATASET_H
+#define CABLE_ROBOT_HOMING_DATASET_H
+
+#include <string>
+
+#include "homing/homing_optimizer.h"
+#include "utils/msgs.h"
+
+/**
+ * @brief The measurements collected during the proprioceptive homing acquisition phase.
+ *
+ * Measurements are appended straight from CableRobot::GetMeas() as they are collected,
+ * and handed as they are to HomingOptimizer, so that no file is involved between
+ * acquisition and optimization. Yet, the whole dataset can be saved onto a binary
+ * snapshot and loaded back, to re-run the optimization offline.
+ */
+class HomingDataset
+{
+ public:
+  /**
+   * @brief Discard all measurements and set the actuators they will refer to.
+   * @param[in] actuators_id IDs of the active actuators, in the order of measurements.
+   * @param[in] capacity Expected number of measurements, to allocate memory once.
+   */
+  void Reset(const vect<id_t>& actuators_id, const size_t capacity = 0);
+  /**
+   * @brief Append a measurement.
+   * @param[in] actuator_idx Index of the actuator moved to reach this measurement.
+   * @param[in] meas Collected status of all active actuators, in the same order as
+   * actuators ID.
+   * @return _True_ if the measurement is consistent with the dataset, _false_
+   * otherwise, in which case it is discarded.
+   */
+  bool Add(const size_t actuator_idx, const vect<ActuatorStatusMsg>& meas);
+
+  /**
+   * @brief Get the IDs of the actuators measurements refer to.
+   * @return The IDs of the actuators measurements refer to.
+   */
+  const vect<id_t>& ActuatorsID() const { return actuators_id_; }
+  /**
+   * @brief Get all measurements, in acquisition order.
+   * @return All measurements, in acquisition order.
+   */
+  const vect<HomingSample>& Samples() const { return samples_; }
+  /**
+   * @brief Get the number of measurements.
+   * @return The number of measurements.
+   */
+  size_t Size() const { return samples_.size(); }
+  /**
+   * @brief Check if there is no measurement.
+   * @return _True_ if there is no measurement, _false_ otherwise.
+   */
+  bool Empty() const { return samples_.empty(); }
+
+  /**
+   * @brief Save the dataset onto a binary snapshot.
+   * @param[in] filename Path of the snapshot file, overwritten if existing.
+   * @return _True_ if the whole dataset was saved, _false_ otherwise.
+   */
+  bool Save(const std::string& filename) const;
+  /**
+   * @brief Load the dataset from a binary snapshot.
+   * @param[in] filename Path of the snapshot file.
+   * @return _True_ if a valid snapshot was loaded, _false_ otherwise, in which case the
+   * dataset is left unchanged.
+   */
+  bool Load(const std::string& filename);
+
+ private:
+  vect<id_t> actuators_id_;
+  vect<HomingSample> samples_;
+};
+
+#endif // CABLE_ROBOT_HOMING_DATASET_H
@@ -0,0 +1,239 @@
+/**
+ * @file homing_optimizer.h
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing the native solver of the proprioceptive homing optimization
+ * problem.
+ */
+
+#ifndef CABLE_ROBOT_HOMING_OPTIMIZER_H
+#define CABLE_ROBOT_HOMING_OPTIMIZER_H
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <stddef.h>
+
+#include "grabcommon.h"
+#include "libcdpr/inc/types.h"
+
+#include "homing/homing_optimizer_options.h"
+
+/**
+ * @brief A homing measurement, i.e. the state of all active actuators collected at a
+ * steady configuration during the acquisition phase.
+ *
+ * Both cable lengths and pulley angles are relative to the configuration at the end of
+ * the start up phase, when actuators home is reset.
+ */
+struct HomingSample
+{
+  size_t actuator_idx;        /**< Index of the actuator moved to reach this sample. */
+  vect<double> cable_lengths; /**< [m] Cable lengths, same order as active actuators. */
+  vect<double> pulley_angles; /**< [rad] Pulley angles, same order as active actuators. */
+};
+
+/**
+ * @brief Outcome of the homing optimization.
+ */
+struct HomingOptimizerResult
+{
+  vect<double> init_lengths; /**< [m] Cable lengths at home, same order as actuators. */
+  vect<double> init_angles;  /**< [rad] Pulley angles at home, same order as actuators. */
+
+  vect<double> init_lengths_std;     /**< [m] Standard deviation of init_lengths. */
+  vect<double> init_angles_std;      /**< [rad] Standard deviation of init_angles. */
+  vect<std::array<double, 6>> poses; /**< Platform pose at each measurement. */
+
+  bool converged       = false; /**< _True_ if the final fit met its tolerance. */
+  double residual_norm = 0.0;   /**< Norm of the weighted residuals at solution. */
+  double residual_rms  = 0.0;   /**< RMS of the weighted residuals at solution. */
+  size_t iterations    = 0;     /**< Iterations of the final fit. */
+  size_t start_idx     = 0;     /**< Starting point this outcome comes from. */
+};
+
+/**
+ * @brief Native solver of the proprioceptive homing optimization problem.
+ *
+ * This is the in-process counterpart of _matlab/homing/ExternalHomingScript.m_. Given
+ * the cable lengths and pulley angles collected by HomingProprioceptive at each steady
+ * configuration, relative to the start up one, it finds the cable lengths and pulley
+ * angles at the start up configuration (i.e. the home), in three steps:
+ * 1. a guess of the home pose is found as the static equilibrium with equal cable
+ *    tensions, close to the pulleys centroid;
+ * 2. a guess of each measured pose is found by direct kinematics, i.e. solving cable
+ *    lengths and static equilibrium of the unactuated directions, warm started from the
+ *    previous pose and restarting from home whenever the moving actuator changes;
+ * 3. home lengths and angles and all measured poses are fitted at once in the
+ *    least-squares sense on pulley angles, cable lengths and static equilibrium
+ *    residuals.
+ *
+ * The last step is a Levenberg-Marquardt whose normal equations have a block-arrow
+ * structure (each pose only couples with home values), which is exploited by
+ * eliminating poses with a Schur complement, so that the cost of each iteration is
+ * linear with the number of measurements.
+ *
+ * Platform orientation is parametrized with Tait-Bryan angles (X-Y-Z), which is
+ * singularity-free around the home configuration, and geometry is taken from the
+ * active actuators of the robot configuration.
+ *
+ * Since the fit may get stuck in a poor local minimum, OptimizeMultiStart() repeats it
+ * from many perturbed guesses of the home pose on a pool of threads, keeping the best
+ * outcome and cancelling the remaining starts as soon as one is acceptable.
+ *
+ * While measurements are still being acquired, Refine() updates a previous outcome with
+ * the latest ones, warm starting from it, and IsConfident() tells whether the estimate
+ * is accurate and settled enough to stop the acquisition early.
+ */
+class HomingOptimizer
+{
+ public:
+  /**
+   * @brief A 3D vector.
+   */
+  typedef std::array<double, 3> Vec3;
+  /**
+   * @brief A platform pose, i.e. position followed by Tait-Bryan angles.
+   */
+  typedef std::array<double, 6> Pose;
+  /**
+   * @brief Callback notifying the progress of a multi-start optimization.
+   *
+   * Arguments are the number of completed starts and the best outcome so far. Calls are
+   * serialized, but they come from worker threads.
+   */
+  typedef std::function<void(const size_t, const HomingOptimizerResult&)>
+    ProgressCallback;
+
+  /**
+   * @brief HomingOptimizer constructor.
+   * @param[in] params Robot configuration parameters, only active actuators are used.
+   * @param[in] options Tuning parameters.
+   */
+  HomingOptimizer(const grabcdpr::Params& params,
+                  const HomingOptimizerOptions& options = HomingOptimizerOptions());
+
+  /**
+   * @brief Get the number of active cables.
+   * @return The number of active cables.
+   */
+  size_t CablesNum() const { return cables_.size(); }
+  /**
+   * @brief Get tuning parameters.
+   * @return Tuning parameters.
+   */
+  const HomingOptimizerOptions& GetOptions() const { return options_; }
+
+  /**
+   * @brief Check if an outcome is good enough to stop searching for a better one.
+   * @param[in] result Outcome of an optimization.
+   * @return _True_ if the outcome converged to a small enough residual.
+   */
+  bool IsAcceptable(const HomingOptimizerResult& result) const;
+  /**
+   * @brief Check if an incremental estimate is accurate and settled enough to stop
+   * acquiring further measurements.
+   * @param[in] result Latest outcome of Refine().
+   * @param[in] previous The outcome @a result was refined from.
+   * @return _True_ if home values uncertainty and change since previous outcome are
+   * within HomingOptimizerOptions::confident_length_std and
+   * HomingOptimizerOptions::confident_angle_std.
+   */
+  bool IsConfident(const HomingOptimizerResult& result,
+                   const HomingOptimizerResult& previous) const;
+
+  /**
+   * @brief Solve the homing optimization problem from a single starting point.
+   * @param[in] samples Homing measurements, in acquisition order.
+   * @param[in] start_idx Index of the starting point: 0 is the equilibrium guess of the
+   * home pose, any other index a pseudo-random (yet repeatable) perturbation of it.
+   * @param[in] cancel Optional flag which stops the optimization early when set.
+   * @return The outcome of the optimization.
+   */
+  HomingOptimizerResult Optimize(const vect<HomingSample>& samples,
+                                 const size_t start_idx          = 0,
+                                 const std::atomic<bool>* cancel = NULL) const;
+  /**
+   * @brief Refine a previous outcome with newly acquired measurements.
+   *
+   * Home values and poses of previous outcome are the initial guess of the fit, while
+   * poses of new measurements are guessed by direct kinematics from the latest one. If
+   * there is no valid previous outcome, this is the same as Optimize().
+   * @param[in] samples Homing measurements, in acquisition order, starting with those
+   * @a previous was obtained from.
+   * @param[in] previous Outcome of a previous optimization or refinement.
+   * @param[in] cancel Optional flag which stops the optimization early when set.
+   * @return The refined outcome.
+   */
+  HomingOptimizerResult Refine(const vect<HomingSample>& samples,
+                               const HomingOptimizerResult& previous,
+                               const std::atomic<bool>* cancel = NULL) const;
+  /**
+   * @brief Solve the homing optimization problem from many starting points in parallel.
+   *
+   * Starting points from 0 to HomingOptimizerOptions::starts_num are distributed among
+   * a pool of worker threads. As soon as one of them gives an acceptable outcome, the
+   * others are cancelled.
+   * @param[in] samples Homing measurements, in acquisition order.
+   * @param[in] threads_num Number of worker threads, 0 for one per hardware thread.
+   * @param[in,out] cancel Optional flag which stops the optimization early when set.
+   * It is set here once an acceptable outcome is found.
+   * @param[in] progress_cb Optional callback invoked every time a start is completed.
+   * @return The best outcome among all starts, i.e. the one with minimum residual.
+   */
+  HomingOptimizerResult
+  OptimizeMultiStart(const vect<HomingSample>& samples, const size_t threads_num = 0,
+                     std::atomic<bool>* cancel           = NULL,
+                     const ProgressCallback& progress_cb = ProgressCallback()) const;
+
+ private:
+  friend class TestHomingOptimizer; // generates synthetic measurements
+
+  struct CableGeometry
+  {
+    Vec3 pos_OD_glob;
+    Vec3 vers_i;
+    Vec3 vers_j;
+    Vec3 vers_k;
+    Vec3 pos_PA_loc;
+    double pulley_radius;
+  };
+
+  struct CableState
+  {
+    double length;
+    double swivel_angle;
+    Vec3 pos_PA_glob;
+    Vec3 vers_rho;
+  };
+
+  vect<CableGeometry> cables_;
+  double platform_mass_;
+  Vec3 pos_PG_loc_;
+  Vec3 ext_force_loc_;
+  Vec3 ext_torque_loc_;
+  HomingOptimizerOptions options_;
+
+  size_t StaticResidualsNum() const;
+  bool AreValid(const vect<HomingSample>& samples) const;
+
+  void CalcCables(const Pose& pose, CableState* cables) const;
+  void CalcExtWrench(const Pose& pose, double* wrench) const;
+  bool CalcStaticResiduals(const Pose& pose, const CableState* cables,
+                           double* residuals) const;
+  bool CalcFitResiduals(const Pose& pose, const vect<double>& home_values,
+                        const HomingSample& sample, CableState* cables,
+                        double* residuals) const;
+
+  bool FindHomePose(Pose* pose) const;
+  void PerturbPose(const size_t start_idx, Pose* pose) const;
+  bool FindPose(const vect<double>& lengths, Pose* pose) const;
+  bool GuessPoses(const vect<HomingSample>& samples, const vect<double>& home_values,
+                  const Pose& start_pose, const bool restart,
+                  const std::atomic<bool>* cancel, vect<Pose>* poses) const;
+  void Fit(const vect<HomingSample>& samples, const std::atomic<bool>* cancel,
+           vect<double>* home_values, vect<Pose>* poses,
+           HomingOptimizerResult* result) const;
+};
+
+#endif // CABLE_ROBOT_HOMING_OPTIMIZER_H
@@ -0,0 +1,47 @@
+/**
+ * @file homing_optimizer_options.h
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing the tuning parameters of the homing optimizer, kept apart from
+ * the optimizer itself so that settings can be parsed with no dependency on it.
+ */
+
+#ifndef CABLE_ROBOT_HOMING_OPTIMIZER_OPTIONS_H
+#define CABLE_ROBOT_HOMING_OPTIMIZER_OPTIONS_H
+
+#include <array>
+#include <stddef.h>
+
+/**
+ * @brief Tuning parameters of the homing optimizer.
+ */
+struct HomingOptimizerOptions
+{
+  std::array<double, 3> gravity = {{0.0, 0.0, -9.80665}}; /**< [m/s^2] Global frame. */
+
+  double home_drop      = 1.0;   /**< [m] First guess of home below pulleys centroid. */
+  double home_tension   = 40.0;  /**< [N] Guessed cable tension at home. */
+  double swivel_weight  = 10.0;  /**< Weight of pulley angle residuals. */
+  double length_weight  = 100.0; /**< Weight of cable length residuals. */
+  size_t max_iterations = 200;   /**< Maximum iterations of each solver. */
+  double tolerance      = 1e-12; /**< Relative cost reduction to stop at. */
+
+  // A solver which cannot reduce the cost anymore is at a solution if its least damped
+  // step is negligible, or if residuals are orthogonal to every column of the jacobian
+  // within given tolerance on their cosine, i.e. what is left is unexplained noise.
+  double step_tolerance     = 1e-10; /**< [m, rad] Max step norm at a solution. */
+  double gradient_tolerance = 1e-6;  /**< Max cosine of residuals to jacobian columns. */
+
+  size_t starts_num            = 32;   /**< Starting points of multi-start search. */
+  double start_position_spread = 0.1;  /**< [m] Max home position perturbation. */
+  double start_angle_spread    = 0.15; /**< [rad] Max home orientation perturbation. */
+  double accept_residual_rms   = 0.05; /**< Weighted residuals RMS to stop search at. */
+
+  // Uncertainty reachable with real measurements is bounded by encoders noise, which is
+  // about 0.2 mm on cable lengths and 0.5 mrad on pulley angles: with such noise, home
+  // lengths settle around 2.5 mm after two of three cables and around 1 mm after all.
+  double confident_length_std = 3e-3; /**< [m] Home lengths uncertainty to trust. */
+  double confident_angle_std  = 2e-3; /**< [rad] Home angles uncertainty to trust. */
+};
+
+#endif // CABLE_ROBOT_HOMING_OPTIMIZER_OPTIONS_H
@@ -18,9 +18,12 @@
 #include "easylogging++.h"
 #include "inc/filters.h"
 
+#include "ctrl/controller_multidrive.h"
 #include "ctrl/controller_singledrive.h"
-#include "homing/matlab_thread.h"
+#include "homing/homing_dataset.h"
+#include "homing/optimizer_thread.h"
 #include "robot/cablerobot.h"
+#include "utils/sliding_stats.h"
 #include "utils/types.h"
 
 
@@ -175,6 +178,16 @@ class HomingProprioceptive: public QObject, public StateMachine
    * @return _True_ if parsing was successful, _false_ otherwise
    */
   bool ParseExtFile(const QString& filepath, HomingProprioceptiveHomeData* home_data);
+  /**
+   * @brief Load the measurements of a previous acquisition phase from a binary snapshot,
+   * replacing current ones, so that optimization can be run again on them.
+   * @param[in] filepath The filepath of the snapshot, as saved at the end of the
+   * acquisition phase.
+   * @return _True_ if the snapshot is valid and refers to the active actuators, _false_
+   * otherwise, in which case current measurements are left unchanged.
+   * @see HomingDataset
+   */
+  bool LoadDataset(const QString& filepath);
 
  public:
   //--------- External events -------------------------------------------------------//
@@ -246,6 +259,11 @@ class HomingProprioceptive: public QObject, public StateMachine
    * @brief Signal including an operation progress value, from 0 to 100.
    */
   void progressValue(const int&) const;
+  /**
+   * @brief Signal including optimization progress, from 0 to 100, and the RMS of the
+   * weighted residuals of the best solution found so far.
+   */
+  void optimizationProgress(const int&, const double&) const;
   /**
    * @brief Stop waiting command.
    */
@@ -253,16 +271,20 @@ class HomingProprioceptive: public QObject, public StateMachine
 
  private slots:
   void handleActuatorStatusUpdate(const ActuatorStatus& actuator_status);
-  void handleMatlabResultsReady();
-  void updateOptimizationProgress();
+  void handleOptimizationResultsReady();
+  void handleOptimizationEstimateReady(const HomingOptimizerResult& estimate,
+                                       const bool& confident);
 
  private:
   CableRobot* robot_ptr_ = NULL;
   ControllerSingleDrive controller_;
+  ControllerMultiDrive uncoiling_controller_; // position control of uncoiling phase
 
-  static constexpr size_t kNumMeasMin_     = 1;
-  static constexpr qint16 kTorqueSsErrTol_ = 5;
-  size_t num_meas_                         = kNumMeasMin_;
+  static constexpr size_t kNumMeasMin_       = 1;
+  static constexpr size_t kNumMeasConfident_ = 3; // per cable, once estimate is confident
+  static constexpr qint16 kTorqueSsErrTol_   = 5;
+  size_t num_meas_                           = kNumMeasMin_;
+  size_t cable_num_meas_                     = kNumMeasMin_; // of working cable
   size_t num_tot_meas_;
   size_t working_actuator_idx_;
   size_t meas_step_;
@@ -277,20 +299,25 @@ class HomingProprioceptive: public QObject, public StateMachine
   QMutex qmutex_;
 
   vect<id_t> active_actuators_id_;
+  std::shared_ptr<const IdIndexMap> active_actuators_index_; // shared with robot
   vect<ActuatorStatus> actuators_status_;
 
-  static constexpr int kOptProgressIntervalMsec_ = 150;
-  QTimer optimization_progess_timer_;
-  int optimization_progress_counter_;
+  HomingDataset dataset_; // collected in memory, in acquisition order
+  OptimizerThread optimizer_thread_;
+  bool estimate_confident_ = false; // incremental estimate allows to shorten acquisition
 
   // Tuning params for detecting platform steadyness
-  static constexpr double kBufferingTimeSec_  = 3.0;     // [sec]
-  static constexpr double kCutoffFreq_        = 20.0;    // [Hz]
-  static constexpr double kMaxAngleDeviation_ = 0.00005; // [rad]
+  static constexpr double kBufferingTimeSec_     = 1.5;     // [sec] max window length
+  static constexpr double kMinSteadyTimeSec_     = 0.25;    // [sec] min window length
+  static constexpr double kCutoffFreq_           = 20.0;    // [Hz]
+  static constexpr double kMaxAngleDeviation_    = 0.00005; // [rad] max std and drift
+  static constexpr double kMotionAngleThreshold_ = 0.0005;  // [rad] restarts window
+  static constexpr size_t kSamplesBatchSize_     = 64;
 
   RetVal WaitUntilPlatformSteady();
 
   void DumpMeasAndMoveNext();
+  void SaveDataset();
 
  private:
   //--------- State machine ---------------------------------------------------------//
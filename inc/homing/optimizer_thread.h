@@ -0,0 +1,128 @@
+/**
+ * @file optimizer_thread.h
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief This file includes a Qt thread where to run the homing optimization.
+ */
+
+#ifndef CABLE_ROBOT_OPTIMIZER_THREAD_H
+#define CABLE_ROBOT_OPTIMIZER_THREAD_H
+
+#include <QThread>
+#include <atomic>
+#include <vector>
+
+#include "homing/homing_optimizer.h"
+
+/**
+ * @brief A thread class to run the homing optimization, see HomingOptimizer.
+ *
+ * The optimization is started from many points at once, on a pool of worker threads
+ * spawned by this one, and its progress is streamed as each starting point completes.
+ *
+ * While measurements are still being acquired, the thread can also run in incremental
+ * mode, where each run refines the estimate of the previous one with the latest
+ * measurements.
+ */
+class OptimizerThread: public QThread
+{
+  Q_OBJECT
+ public:
+  /**
+   * @brief OptimizerThread constructor.
+   * @param[in] parent The parent Qt object, from which the new thread is forked.
+   * @param[in] params Robot configuration parameters.
+   * @param[in] options Tuning parameters of the optimizer.
+   */
+  OptimizerThread(QObject* parent, const grabcdpr::Params& params,
+                  const HomingOptimizerOptions& options = HomingOptimizerOptions())
+    : QThread(parent), optimizer_(params, options), incremental_(false), cancel_(false)
+  {}
+
+  /**
+   * @brief Set the homing measurements to be processed by next run.
+   *
+   * This also resets any previous cancellation request.
+   * @param[in] samples Homing measurements, in acquisition order.
+   * @note Do not call while the thread is running.
+   */
+  void SetSamples(const vect<HomingSample>& samples);
+  /**
+   * @brief Set the homing measurements acquired so far, to be processed by next run in
+   * incremental mode.
+   *
+   * This also resets any previous cancellation request.
+   * @param[in] samples Homing measurements, in acquisition order, starting with those
+   * processed by previous incremental run, if any.
+   * @note Do not call while the thread is running.
+   * @see ResetEstimate()
+   */
+  void SetIncrementalSamples(const vect<HomingSample>& samples);
+  /**
+   * @brief Discard the estimate of previous incremental runs.
+   * @note Do not call while the thread is running.
+   */
+  void ResetEstimate();
+  /**
+   * @brief Restrict this thread, and so the pool of worker threads it spawns, to a set
+   * of CPUs.
+   * @param[in] cpus CPUs the thread may run on, the ones inherited from the thread which
+   * starts it if empty.
+   * @note Do not call while the thread is running.
+   */
+  void SetCpus(const std::vector<int>& cpus) { cpus_ = cpus; }
+  /**
+   * @brief Request running optimization to stop as soon as possible.
+   *
+   * The best outcome found so far is still notified with resultsReady().
+   */
+  void Cancel() { cancel_.store(true); }
+  /**
+   * @brief Get the outcome of latest run.
+   * @return The outcome of latest run.
+   * @note Do not call while the thread is running.
+   */
+  const HomingOptimizerResult& GetResult() const { return result_; }
+
+ private:
+  HomingOptimizer optimizer_;
+  vect<HomingSample> samples_;
+  std::vector<int> cpus_;
+  HomingOptimizerResult result_;
+  HomingOptimizerResult estimate_; // latest incremental one
+  bool incremental_;
+  std::atomic<bool> cancel_;
+
+  void RunMultiStart();
+  void RunIncremental();
+
+  void run() override;
+
+ signals:
+  /**
+   * @brief Results ready notice.
+   */
+  void resultsReady() const;
+  /**
+   * @brief Signal including the latest incremental estimate, and whether it is accurate
+   * and settled enough to stop acquiring further measurements.
+   *
+   * Both are sent by value, since the thread may be already refining next estimate by
+   * the time they are received.
+   * @see HomingOptimizer::IsConfident()
+   */
+  void estimateReady(const HomingOptimizerResult&, const bool&) const;
+  /**
+   * @brief Signal including optimization progress, from 0 to 100, and the RMS of the
+   * weighted residuals of the best outcome found so far.
+   */
+  void progressUpdate(const int&, const double&) const;
+  /**
+   * @brief Signal including a message to any QConsole, for instance a QTextBrowser.
+   */
+  void printToQConsole(const QString&) const;
+};
+
+Q_DECLARE_METATYPE(HomingOptimizerResult)
+
+#endif // CABLE_ROBOT_OPTIMIZER_THREAD_H
@@ -0,0 +1,144 @@
+/**
+ * @file actuators_core.h
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing the real time core of cable robot actuators, whose state update
+ * is specialized at compile time on the number of active actuators.
+ */
+
+#ifndef CABLE_ROBOT_ACTUATORS_CORE_H
+#define CABLE_ROBOT_ACTUATORS_CORE_H
+
+#include <array>
+
+#include "ctrl/controller_base.h"
+#include "robot/actuators_state.h"
+#include "robot/components/actuator.h"
+#include "utils/id_index_map.h"
+#include "utils/unroll.h"
+
+/**
+ * @brief The real time core of cable robot actuators, i.e. the per-cycle work over all
+ * active actuators, from drives inputs to actuators state and from control actions to
+ * drives outputs.
+ *
+ * The number of active actuators is only known at run-time, from robot configuration,
+ * but it never changes afterwards and common robots share a handful of values. Hence
+ * state update has one implementation per common number of actuators, with fixed size
+ * storage and fully unrolled loops (see ActuatorsCoreFixed), plus a generic fallback for
+ * any other number (see ActuatorsCoreDynamic). The right one is picked once at startup by
+ * MakeActuatorsCore(), so that the real time thread pays a single virtual call per
+ * cycle. Its gain is small, within run-to-run noise for few actuators.
+ *
+ * Control actions are applied by the same code for any number of actuators instead,
+ * since specializing it turned out to be slower for 6 and 8 actuators (see
+ * _bench/cable_robot_bench.pro_).
+ */
+class ActuatorsCoreBase
+{
+ public:
+  /**
+   * @brief ActuatorsCoreBase constructor.
+   * @param[in] actuators_ptrs Pointers to the actuators, whose order defines their slots
+   * in the state.
+   */
+  explicit ActuatorsCoreBase(const vect<Actuator*>& actuators_ptrs)
+    : actuators_ptrs_(actuators_ptrs)
+  {}
+  virtual ~ActuatorsCoreBase() {}
+
+  /**
+   * @brief Get the number of actuators.
+   * @return The number of actuators.
+   */
+  size_t Size() const { return actuators_ptrs_.size(); }
+
+  /**
+   * @brief Update the state of all actuators, i.e. load their raw state as read from
+   * their drives and convert encoder counts to cable lengths and swivel pulley angles.
+   * @param[out] state The state of all actuators, whose size must match Size().
+   * @note This is meant to be called at every cycle of the real time thread.
+   */
+  virtual void UpdateState(ActuatorsState* state) = 0;
+  /**
+   * @brief Apply control actions to the targeted actuators, skipping those targeting
+   * inactive or disabled ones.
+   * @param[in] ctrl_actions Control actions to be applied, in order.
+   * @param[in] index_map Map from motor ID to actuator slot.
+   * @param[out] applied_ctrl_actions Latest control action applied to each actuator,
+   * whose size must match Size(). Slots of untargeted actuators are left untouched.
+   * @note This is meant to be called at every cycle of the real time thread.
+   */
+  void ApplyCtrlActions(const ControlActions& ctrl_actions, const IdIndexMap& index_map,
+                        vect<ControlAction>* applied_ctrl_actions);
+
+ protected:
+  vect<Actuator*> actuators_ptrs_;
+};
+
+/**
+ * @brief The real time core of cable robot actuators, specialized on a number of
+ * actuators known at compile time.
+ * @tparam N Number of actuators.
+ */
+template <size_t N>
+class ActuatorsCoreFixed: public ActuatorsCoreBase
+{
+ public:
+  /**
+   * @brief ActuatorsCoreFixed constructor.
+   * @param[in] actuators_ptrs Pointers to the actuators, whose order defines their slots
+   * in the state. Their number must be _N_.
+   */
+  explicit ActuatorsCoreFixed(const vect<Actuator*>& actuators_ptrs)
+    : ActuatorsCoreBase(actuators_ptrs)
+  {
+    for (size_t i = 0; i < N; i++)
+      fixed_actuators_ptrs_[i] = actuators_ptrs[i];
+  }
+
+  void UpdateState(ActuatorsState* state) override
+  {
+    Unroll<N>::Run(
+      [this, state](const size_t i) { fixed_actuators_ptrs_[i]->LoadCounts(i, state); });
+    state->ConvertCounts<N>();
+  }
+
+ private:
+  std::array<Actuator*, N> fixed_actuators_ptrs_;
+};
+
+// Instantiated once, see actuators_core.cpp
+extern template class ActuatorsCoreFixed<3>;
+extern template class ActuatorsCoreFixed<4>;
+extern template class ActuatorsCoreFixed<6>;
+extern template class ActuatorsCoreFixed<8>;
+
+/**
+ * @brief The real time core of cable robot actuators, for any number of actuators.
+ */
+class ActuatorsCoreDynamic: public ActuatorsCoreBase
+{
+ public:
+  /**
+   * @brief ActuatorsCoreDynamic constructor.
+   * @param[in] actuators_ptrs Pointers to the actuators, whose order defines their slots
+   * in the state.
+   */
+  explicit ActuatorsCoreDynamic(const vect<Actuator*>& actuators_ptrs)
+    : ActuatorsCoreBase(actuators_ptrs)
+  {}
+
+  void UpdateState(ActuatorsState* state) override;
+};
+
+/**
+ * @brief Make the real time core of a set of actuators, specialized on their number if
+ * common (i.e. 3, 4, 6 or 8), generic otherwise.
+ * @param[in] actuators_ptrs Pointers to the actuators, whose order defines their slots in
+ * the state.
+ * @return A new real time core, owned by the caller.
+ */
+ActuatorsCoreBase* MakeActuatorsCore(const vect<Actuator*>& actuators_ptrs);
+
+#endif // CABLE_ROBOT_ACTUATORS_CORE_H
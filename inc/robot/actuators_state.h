@@ -0,0 +1,204 @@
+/**
+ * @file actuators_state.h
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing the state of all active actuators of cable robot, laid out as a
+ * structure of arrays.
+ */
+
+#ifndef CABLE_ROBOT_ACTUATORS_STATE_H
+#define CABLE_ROBOT_ACTUATORS_STATE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+#include <vector>
+
+#include "utils/types.h"
+#include "utils/unroll.h"
+
+/**
+ * @brief The state of all active actuators of cable robot, laid out as a structure of
+ * arrays.
+ *
+ * Every field of actuators status, such as motor position or cable length, is stored in
+ * its own contiguous array, whose slots follow active actuators order. At every cycle of
+ * the real time thread, raw encoder counts of each actuator are loaded right after
+ * reading drives inputs, see SetCounts(), and then converted to cable lengths and
+ * swivel pulley angles of all actuators at once, see ConvertCounts(). Such conversion is
+ * a plain affine map over contiguous arrays, which the compiler turns into SIMD
+ * instructions.
+ *
+ * Consumers inside the real time thread, such as controllers and forward kinematics,
+ * read the arrays directly, while ActuatorStatus of a single actuator is still available
+ * for everyone else, see GetStatus().
+ *
+ * Memory is allocated once at setup, so that updating the state never allocates.
+ */
+class ActuatorsState
+{
+ public:
+  /**
+   * @brief ActuatorsState default constructor, with no actuators.
+   */
+  ActuatorsState() {}
+
+  /**
+   * @brief Setup the state of a set of actuators.
+   * @param[in] ids IDs of the actuators, whose order defines their slots.
+   * @note This operation allocates memory and resets both state and calibration of all
+   * actuators, so do not use it inside the real time thread.
+   */
+  void Setup(const std::vector<id_t>& ids);
+  /**
+   * @brief Set the conversion factors from encoder counts of an actuator.
+   * @param[in] slot The slot of the actuator.
+   * @param[in] counts_to_length [m/counts] Cable length per motor encoder count.
+   * @param[in] counts_to_angle [rad/counts] Swivel pulley angle per auxiliary encoder
+   * count.
+   */
+  void SetCalibration(const size_t slot, const double counts_to_length,
+                      const double counts_to_angle);
+  /**
+   * @brief Set the home configuration of an actuator, i.e. the reference of conversions
+   * from encoder counts.
+   * @param[in] slot The slot of the actuator.
+   * @param[in] motor_home_pos [counts] Motor encoder position at home.
+   * @param[in] home_length [m] Cable length at home.
+   * @param[in] aux_home_pos [counts] Auxiliary encoder position at home.
+   * @param[in] home_angle [rad] Swivel pulley angle at home.
+   */
+  void SetHomeConfig(const size_t slot, const int32_t motor_home_pos,
+                     const double home_length, const int32_t aux_home_pos,
+                     const double home_angle);
+
+  /**
+   * @brief Load the raw state of an actuator, as read from its drive.
+   * @param[in] slot The slot of the actuator.
+   * @param[in] op_mode Motor operational mode.
+   * @param[in] state Actuator state, see Actuator::States.
+   * @param[in] motor_position [counts] Motor position.
+   * @param[in] motor_speed [counts/s] Motor velocity.
+   * @param[in] motor_torque [‰] Motor torque, in per thousand nominal points.
+   * @param[in] aux_position [counts] Auxiliary encoder position, i.e. swivel pulley one.
+   * @note Cable length and swivel pulley angle are not updated until ConvertCounts() is
+   * called.
+   */
+  void SetCounts(const size_t slot, const int8_t op_mode, const uint8_t state,
+                 const int32_t motor_position, const int32_t motor_speed,
+                 const int16_t motor_torque, const int32_t aux_position)
+  {
+    op_modes_[slot]        = op_mode;
+    states_[slot]          = state;
+    motor_positions_[slot] = motor_position;
+    motor_speeds_[slot]    = motor_speed;
+    motor_torques_[slot]   = motor_torque;
+    aux_positions_[slot]   = aux_position;
+  }
+  /**
+   * @brief Convert encoder counts of all actuators to cable lengths and swivel pulley
+   * angles, in one pass.
+   */
+  void ConvertCounts();
+  /**
+   * @brief Convert encoder counts of all actuators to cable lengths and swivel pulley
+   * angles, with a number of actuators known at compile time.
+   *
+   * Same as ConvertCounts(), but fully unrolled, with no loop counters left.
+   * @tparam N Number of actuators, which must match Size().
+   */
+  template <size_t N>
+  void ConvertCounts()
+  {
+    Unroll<N>::Run([this](const size_t i) { ConvertSlot(i); });
+  }
+
+  /**
+   * @brief Get the number of actuators.
+   * @return The number of actuators.
+   */
+  size_t Size() const { return ids_.size(); }
+  /**
+   * @brief Get the status of an actuator, with no bound check.
+   * @param[in] slot The slot of the actuator.
+   * @return The status of the actuator.
+   */
+  ActuatorStatus GetStatus(const size_t slot) const;
+
+  /**
+   * @brief Get actuators ID.
+   * @return Actuators ID, one per slot.
+   */
+  const std::vector<id_t>& GetIDs() const { return ids_; }
+  /**
+   * @brief Get motors operational mode.
+   * @return Motors operational mode, one per slot.
+   */
+  const std::vector<int8_t>& GetOpModes() const { return op_modes_; }
+  /**
+   * @brief Get actuators state.
+   * @return Actuators state, one per slot, see Actuator::States.
+   */
+  const std::vector<uint8_t>& GetStates() const { return states_; }
+  /**
+   * @brief Get motors position.
+   * @return [counts] Motors position, one per slot.
+   */
+  const std::vector<int32_t>& GetMotorPositions() const { return motor_positions_; }
+  /**
+   * @brief Get motors velocity.
+   * @return [counts/s] Motors velocity, one per slot.
+   */
+  const std::vector<int32_t>& GetMotorSpeeds() const { return motor_speeds_; }
+  /**
+   * @brief Get motors torque.
+   * @return [‰] Motors torque, in per thousand nominal points, one per slot.
+   */
+  const std::vector<int16_t>& GetMotorTorques() const { return motor_torques_; }
+  /**
+   * @brief Get auxiliary encoders position, i.e. swivel pulleys one.
+   * @return [counts] Auxiliary encoders position, one per slot.
+   */
+  const std::vector<int32_t>& GetAuxPositions() const { return aux_positions_; }
+  /**
+   * @brief Get cable lengths.
+   * @return [m] Cable lengths, one per slot.
+   */
+  const std::vector<double>& GetCableLengths() const { return cable_lengths_; }
+  /**
+   * @brief Get swivel pulleys angle.
+   * @return [rad] Swivel pulleys angle, one per slot.
+   */
+  const std::vector<double>& GetPulleyAngles() const { return pulley_angles_; }
+
+ private:
+  // State
+  std::vector<id_t> ids_;
+  std::vector<int8_t> op_modes_;
+  std::vector<uint8_t> states_;
+  std::vector<int32_t> motor_positions_;
+  std::vector<int32_t> motor_speeds_;
+  std::vector<int16_t> motor_torques_;
+  std::vector<int32_t> aux_positions_;
+  std::vector<double> cable_lengths_;
+  std::vector<double> pulley_angles_;
+  // Calibration
+  std::vector<int32_t> motor_home_positions_;
+  std::vector<double> home_lengths_;
+  std::vector<double> counts_to_length_;
+  std::vector<int32_t> aux_home_positions_;
+  std::vector<double> home_angles_;
+  std::vector<double> counts_to_angle_;
+
+  void ConvertSlot(const size_t slot)
+  {
+    cable_lengths_[slot] =
+      home_lengths_[slot] +
+      (motor_positions_[slot] - motor_home_positions_[slot]) * counts_to_length_[slot];
+    pulley_angles_[slot] =
+      home_angles_[slot] +
+      (aux_positions_[slot] - aux_home_positions_[slot]) * counts_to_angle_[slot];
+  }
+};
+
+#endif // CABLE_ROBOT_ACTUATORS_STATE_H
@@ -25,8 +25,22 @@
 
 #include "components/actuator.h"
 #include "ctrl/controller_base.h"
+#include "ctrl/controller_multidrive.h"
 #include "ctrl/controller_singledrive.h"
+#include "robot/actuators_core.h"
+#include "robot/actuators_state.h"
+#include "robot/forward_kinematics.h"
+#include "robot/sim/sim_ethercat_network.h"
+#include "utils/app_settings.h"
 #include "utils/easylog_wrapper.h"
+#include "utils/id_index_map.h"
+#include "utils/overrun_policy.h"
+#include "utils/rt_alloc_guard.h"
+#include "utils/rt_profile.h"
+#include "utils/rt_timing.h"
+#include "utils/seqlock.h"
+#include "utils/spsc_ring.h"
+#include "utils/telemetry_recorder.h"
 
 /**
  * @brief The virtualization of physical GRAB CDPR.
@@ -49,11 +63,24 @@
  * information to the extern at need, such as motors status.
  *
  * It also takes care of exception and error handling, such as real time deadline missed
- * or ethercat network failures.
+ * or ethercat network failures. Real time cycle overruns are tolerated within a budget,
+ * beyond which the robot holds its set points and eventually fails disabling its motors,
+ * see OverrunPolicy.
  *
  * Robot status logging is also implemented here and can be exploited with CollectMeas()
  * and DumpMeas() functions.
  *
+ * The state of all active actuators is published by the real time thread once per cycle
+ * as a versioned snapshot (see SeqLock), so that status readers, like
+ * GetActuatorStatus(), never need to lock the robot mutex nor contend with the real time
+ * thread.
+ *
+ * Depending on application settings, the EtherCAT network is either the physical one or
+ * an in-process simulated one (see SimEthercatNetwork), where each drive is replaced by a
+ * virtual GoldSoloWhistle drive exchanging the very same process data. In the latter
+ * case the whole robot, including its real time thread, runs without any hardware. Use
+ * StartNetwork() and ResetNetwork() to operate on either transparently.
+ *
  * Last important remark regards the controller. The controller is called at every cycle
  * of the real time thread and provides commands to the motors, if present and its output
  * is valid. Any controller is a derived class of ControllerBase which provides the
@@ -77,8 +104,14 @@ class CableRobot: public QObject,
    * @brief CableRobot constructor.
    * @param[in] parent The parent Qt object.
    * @param[in] config Configuration parameters of the cable robot.
-   */
-  CableRobot(QObject* parent, const grabcdpr::Params& config);
+   * @param[in] settings Application settings, e.g. the EtherCAT network backend.
+   * @note Process-wide settings of the real time profile, i.e. memory locking and heap
+   * prefaulting, as well as GUI thread CPUs, are applied here, assuming the calling
+   * thread is the GUI one. The rest is applied by the real time thread itself, at its
+   * first cycle.
+   */
+  CableRobot(QObject* parent, const grabcdpr::Params& config,
+             const AppSettings& settings = AppSettings());
   ~CableRobot() override;
 
   /**
@@ -100,12 +133,77 @@ class CableRobot: public QObject,
   static constexpr double kCycleWaitTimeSec = 0.02; /**< [sec] Cycle time when waiting. */
   static constexpr double kMaxWaitTimeSec   = 25.0; /**< [sec] Maximum waiting time. */
 
+  /**
+   * @brief Start the EtherCAT network and its real time thread.
+   *
+   * Depending on application settings, this either starts the EtherCAT master on the
+   * physical network or the simulated network. Either way, the real time thread applies
+   * the real time profile of application settings to itself at its first cycle.
+   */
+  void StartNetwork();
+  /**
+   * @brief Reset the EtherCAT network and restart its real time thread.
+   */
+  void ResetNetwork();
+  /**
+   * @brief Check if the EtherCAT network is simulated.
+   * @return _True_ if the EtherCAT network is simulated, _false_ otherwise.
+   */
+  bool IsSimulated() const { return sim_network_ != NULL; }
+  /**
+   * @brief Get configuration parameters of the cable robot.
+   * @return Configuration parameters of the cable robot.
+   */
+  const grabcdpr::Params& GetConfig() const { return config_; }
+
   /**
    * @brief Get inquired actuator status.
    * @param[in] motor_id The ID of the inquired actuator.
    * @return The status of the inquired actuator.
+   * @note For active actuators this is read from the latest snapshot published by the
+   * real time thread, without locking.
    */
   const ActuatorStatus GetActuatorStatus(const id_t motor_id);
+  /**
+   * @brief Get a copy of the latest snapshot of all active actuators state.
+   * @param[out] snapshot The latest snapshot published by the real time thread.
+   * @return The version of the snapshot, i.e. the number of publications so far.
+   */
+  uint64_t GetActuatorsSnapshot(ActuatorsSnapshot* snapshot) const;
+  /**
+   * @brief Get a copy of the latest platform pose estimated by forward kinematics.
+   * @param[out] pose The latest estimate published by the real time thread.
+   * @return The version of the estimate, i.e. the number of publications so far.
+   * @note Nothing is published if less than 3 actuators are active.
+   */
+  uint64_t GetPlatformPose(PlatformPose* pose) const;
+  /**
+   * @brief Get timing statistics of the real time cycle.
+   * @return A const reference to the timing statistics of the real time cycle, which can
+   * be inspected at any time without locking.
+   * @see RtTimingStats
+   */
+  const RtTimingStats& GetRtTimingStats() const { return rt_timing_; }
+  /**
+   * @brief Reset timing statistics of the real time cycle.
+   * @note The reset is carried out by the real time thread at the beginning of next
+   * cycle.
+   */
+  void ResetRtTimingStats() { rt_timing_.RequestReset(); }
+  /**
+   * @brief Get the policy handling real time cycle overruns.
+   * @return A const reference to the overrun policy, whose state and counters can be
+   * inspected at any time without locking.
+   * @see OverrunPolicy
+   */
+  const OverrunPolicy& GetOverrunPolicy() const { return overrun_policy_; }
+  /**
+   * @brief Reset the policy handling real time cycle overruns, e.g. to release an
+   * escalated hold once the cause of the overruns was fixed.
+   * @note The reset is carried out by the real time thread at the beginning of next
+   * cycle.
+   */
+  void ResetOverrunPolicy() { overrun_policy_.RequestReset(); }
   /**
    * @brief Update home configuration of all actuators at once.
    *
@@ -113,6 +211,8 @@ class CableRobot: public QObject,
    * angles are assigned for the current motor pose.
    * @param[in] cable_len Cable lengths at homing position.
    * @param[in] pulley_angle Swivel pulleys angles at homing position.
+   * @note This operation locks the robot mutex. The actuators snapshot is published
+   * again before returning, so that it is never referred to the old home configuration.
    */
   void UpdateHomeConfig(const double cable_len, const double pulley_angle);
   /**
@@ -121,6 +221,8 @@ class CableRobot: public QObject,
    * @param[in] cable_len Cable length at homing position for specified actuator.
    * @param[in] pulley_angle Swivel pulley angle at homing position for specified
    * actuator.
+   * @note This operation locks the robot mutex. The actuators snapshot is published
+   * again before returning, so that it is never referred to the old home configuration.
    */
   void UpdateHomeConfig(const id_t motor_id, const double cable_len,
                         const double pulley_angle);
@@ -191,6 +293,16 @@ class CableRobot: public QObject,
    * @return IDs of active motors.
    */
   vect<id_t> GetActiveMotorsID() const { return active_actuators_id_; }
+  /**
+   * @brief Get the index of active motors, i.e. the map from their ID to their slot in
+   * GetActiveMotorsID().
+   * @return A shared pointer to the index of active motors, which is built once at
+   * construction and never changes, hence it can be read by any thread without locking.
+   */
+  std::shared_ptr<const IdIndexMap> GetActiveMotorsIndex() const
+  {
+    return active_actuators_index_;
+  }
   /**
    * @brief Clear any motor's fault.
    */
@@ -200,13 +312,95 @@ class CableRobot: public QObject,
    * @brief Collect current cable robot measurents.
    */
   void CollectMeas();
+  /**
+   * @brief Get latest collected cable robot measurements.
+   * @return Latest collected measurements, one for each active actuator.
+   */
+  const vect<ActuatorStatusMsg>& GetMeas() const { return meas_; }
   /**
    * @brief Dump latest collected cable robot measurements onto data.log file.
    */
   void DumpMeas() const;
+  /**
+   * @brief Get the directory where homing datasets are saved.
+   * @return The directory where homing datasets are saved, empty if they are not.
+   */
+  const std::string& GetHomingDatasetDir() const { return homing_dataset_dir_; }
+  /**
+   * @brief Get the tuning parameters of the homing optimizer.
+   * @return The tuning parameters of the homing optimizer.
+   */
+  const HomingOptimizerOptions& GetHomingOptimizerOptions() const
+  {
+    return homing_optimizer_options_;
+  }
+  /**
+   * @brief Get the CPUs any non real-time worker thread should run on.
+   *
+   * Threads started by the GUI one inherit its CPUs, so they have to be given these
+   * ones back explicitly when the GUI thread is restricted by the RT profile.
+   * @return The CPUs the process started on if the GUI thread is restricted, an empty
+   * set (i.e. leave as inherited) otherwise.
+   */
+  const std::vector<int>& GetWorkerCpus() const { return worker_cpus_; }
+
+  /**
+   * @brief Start continuous telemetry recording.
+   *
+   * At every cycle of the real time thread, the status of each active actuator and the
+   * control action applied to it are recorded onto a new binary data log file in the
+   * telemetry directory given by application settings.
+   * @return _True_ if recording started, _false_ otherwise.
+   * @see TelemetryRecorder
+   */
+  bool StartRecording();
+  /**
+   * @brief Stop continuous telemetry recording, if active.
+   */
+  void StopRecording();
+  /**
+   * @brief Check if continuous telemetry recording is active.
+   * @return _True_ if continuous telemetry recording is active, _false_ otherwise.
+   */
+  bool IsRecording() const { return telemetry_recorder_.IsRecording(); }
+  /**
+   * @brief Get statistics of current or latest telemetry recording session.
+   * @return Statistics of current or latest telemetry recording session.
+   */
+  TelemetryRecorder::Stats GetRecordingStats() const
+  {
+    return telemetry_recorder_.GetStats();
+  }
+
+  /**
+   * @brief Start or stop streaming per-cycle samples of all active actuators.
+   *
+   * While streaming, the real time thread pushes the status of each active actuator at
+   * every cycle onto a lock-free buffer of its own, to be drained with
+   * PopActuatorSamples(). Each buffer holds the latest half a second of samples, older
+   * ones are overwritten. Samples left behind by a previous session are discarded on
+   * start.
+   * @param[in] enable _True_ to start streaming, _false_ to stop.
+   * @note To be called by the consumer thread only.
+   */
+  void StreamActuatorSamples(const bool enable);
+  /**
+   * @brief Pop the oldest streamed samples of an active actuator.
+   * @param[in] active_idx Index of the active actuator, see GetActiveMotorsID().
+   * @param[out] samples Array of at least _max_samples_ elements to be filled.
+   * @param[in] max_samples Maximum number of samples to pop.
+   * @return The number of samples popped, 0 if none is available.
+   * @note Only one consumer thread is allowed.
+   * @see StreamActuatorSamples()
+   */
+  size_t PopActuatorSamples(const size_t active_idx, ActuatorSample* samples,
+                            const size_t max_samples);
 
   /**
    * @brief Go to home position.
+   *
+   * All active actuators are moved at once to their home position, along synchronized
+   * trajectories, see ControllerMultiDrive.
    * @return _True_ if operation was successful, _false_ otherwise.
    */
   bool GoHome();
@@ -218,7 +412,8 @@ class CableRobot: public QObject,
    * by any derived class of it. In particular, ControllerBase::CalcCtrlActions() is
    * called at every cycle of the real time thread while ControllerBase::TargetReached()
    * is typically used asynchronously to inquire robot control status in waiting
-   * condition.
+   * condition. The controller is also handed the index of active motors, see
+   * GetActiveMotorsIndex().
    */
   void SetController(ControllerBase* controller);
   /**
@@ -312,6 +507,8 @@ class CableRobot: public QObject,
   void forwardPrintToQConsole(const QString&) const;
   void emitMotorStatus();
   void emitActuatorStatus();
+  void dumpRtTimingStatsOnRequest() const;
+  void checkOverrunPolicy();
 
  private:
   //-------- Pseudo-signals from EthercatMaster base class (live in RT thread) --------//
@@ -321,15 +518,25 @@ class CableRobot: public QObject,
   void EcRtThreadStatusChanged(const bool active) override final;
 
  private:
+  grabcdpr::Params config_;
   grabcdpr::PlatformVars platform_;
   grabcdpr::Vars cdpr_status_;
 
+  // Real time estimate of platform pose, written onto cdpr_status_ at every cycle. Hence
+  // platform orientation therein is given in Tait-Bryan angles.
+  ForwardKinematics forward_kinematics_;
+  PlatformPose platform_pose_; // latest estimate
+
   // Timers for status updates
   static constexpr int kMotorStatusIntervalMsec_    = 100;
   static constexpr int kActuatorStatusIntervalMsec_ = 10;
   QTimer* motor_status_timer_                       = NULL;
   QTimer* actuator_status_timer_                    = NULL;
 
+  // Timer polling for external requests of RT timing statistics dump
+  static constexpr int kRtStatsDumpPollIntervalMsec_ = 500;
+  QTimer* rt_stats_dump_timer_                       = NULL;
+
   void StopTimers();
 
   // Data logging
@@ -337,6 +544,13 @@ class CableRobot: public QObject,
   LogBuffer log_buffer_;
   grabrt::Clock clock_;
 
+  // Continuous telemetry recording
+  TelemetryRecorder telemetry_recorder_;
+  std::string telemetry_dir_;
+  std::string homing_dataset_dir_;
+  HomingOptimizerOptions homing_optimizer_options_;
+  vect<ControlAction> applied_ctrl_actions_; // preallocated, same order as active ones
+
   // Ethercat related
 #if INCLUDE_EASYCAT
   grabec::TestEasyCAT1Slave* easycat1_ptr_;
@@ -344,20 +558,63 @@ class CableRobot: public QObject,
 #endif
   vect<Actuator*> actuators_ptrs_;
   vect<Actuator*> active_actuators_ptrs_;
-  vect<ActuatorStatus> active_actuators_status_;
+  ActuatorsState actuators_state_; // active ones, preallocated, updated every cycle
+  std::unique_ptr<ActuatorsCoreBase> actuators_core_; // specialized on active ones
   vect<id_t> active_actuators_id_;
+  std::shared_ptr<const IdIndexMap> active_actuators_index_; // immutable once built
   bool ec_network_valid_ = false;
   bool rt_thread_active_ = false;
 
+  // Simulated EtherCAT network (NULL if physical one is used)
+  SimEthercatNetwork* sim_network_ = NULL;
+
+  void SetupSimNetwork(const grabcdpr::Params& config, const SimDriveParams& params);
+  void StartSimNetwork();
+  void StopSimNetwork();
+
+  // RT cycle timing instrumentation
+  RtTimingStats rt_timing_;
+
+  // RT thread hardening, applied by the RT thread itself at its first wake-up
+  RtProfile rt_profile_;
+  std::atomic<bool> rt_profile_applied_{false};
+  std::vector<int> worker_cpus_; // of non-RT threads, if GUI thread is restricted
+
+  // RT cycle overruns handling
+  OverrunPolicy overrun_policy_;
+  uint64_t last_cycle_work_nsec_ = 0; // lives in the RT thread
+  OverrunPolicy::States overrun_state_ = OverrunPolicy::ST_NOMINAL; // as last checked
+
+  // Lock-free publication of actuators state
+  SeqLock<ActuatorsSnapshot> actuators_snapshot_;
+  SeqLock<PlatformPose> platform_pose_snapshot_;
+  uint64_t rt_cycle_counter_ = 0;
+
+  // Per-cycle samples of each active actuator (on request)
+  static constexpr double kActuatorSamplesBufferSec_ = 0.5;
+  vect<std::unique_ptr<SpscRing<ActuatorSample>>> actuator_samples_;
+  std::atomic<bool> streaming_actuator_samples_;
+
   void EcWorkFun() override final;      // lives in the RT thread
   void EcEmergencyFun() override final; // lives in the RT thread
 
+  void UpdateActuatorsStatus();                          // lives in the RT thread
+  void EstimatePlatformPose();                           // lives in the RT thread
+  void PublishActuatorsSnapshot(const double timestamp); // lives in the RT thread
+  void PushActuatorSamples(const double timestamp);      // lives in the RT thread
+  void RecordTelemetry(const double timestamp);          // lives in the RT thread
+  void RepublishActuatorsSnapshot(); // robot mutex held, RT thread out of its cycle
+
   // Control related
   ControllerBase* controller_ = NULL;
+  ControlActions ctrl_actions_; // preallocated, sized on active actuators
   QMutex qmutex_;
   bool stop_waiting_cmd_recv_ = false;
 
-  void ControlStep();
+  void ControlStep(const double timestamp);
+  void HoldStep(const double timestamp);
+
+  friend class BenchAccess; // benchmark suite, see bench/bench_main.cpp
 
  private:
   //--------- State machine --------------------------------------------------//
@@ -398,6 +655,7 @@ class CableRobot: public QObject,
   END_STATE_MAP
 
   void PrintStateTransition(const States current_state, const States new_state) const;
+  void PrintOverrunPolicyTransition(const OverrunPolicy::States state);
 };
 
 #endif // CABLE_ROBOT_CABLEROBOT_H
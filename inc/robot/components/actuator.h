@@ -16,6 +16,7 @@
 #include "libgrabrt/inc/clocks.h"
 
 #include "pulleys_system.h"
+#include "robot/actuators_state.h"
 #include "winch.h"
 
 using GSWDStates = grabec::GoldSoloWhistleDriveStates; /**< Shortcut for GSWD states. */
@@ -87,6 +88,23 @@ class Actuator: public QObject, public StateMachine
    * @return Most recent actuator status.
    */
   const ActuatorStatus GetStatus();
+  /**
+   * @brief Load actuator raw state, as read from its drive, into the state of all active
+   * actuators.
+   * @param[in] slot The slot of this actuator in the state of all active actuators.
+   * @param[out] state The state of all active actuators.
+   * @note Cable length and swivel pulley angle are left to
+   * ActuatorsState::ConvertCounts(), which converts all actuators at once.
+   */
+  void LoadCounts(const size_t slot, ActuatorsState* state);
+  /**
+   * @brief Load actuator calibration, i.e. conversion factors from encoder counts and
+   * home configuration, into the state of all active actuators.
+   * @param[in] slot The slot of this actuator in the state of all active actuators.
+   * @param[out] state The state of all active actuators.
+   * @see UpdateHomeConfig()
+   */
+  void LoadCalibration(const size_t slot, ActuatorsState* state);
 
   /**
    * @brief Set cable length target and change its operational mode to CYCLIC_POSITION.
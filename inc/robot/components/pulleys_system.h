@@ -54,6 +54,21 @@ class PulleysSystem
    * @return Corresponding swivel pulley angle in degrees.
    */
   double GetAngleDeg(const int counts) { return GetAngleRad(counts) * 180.0 / M_PI; }
+  /**
+   * @brief Get swivel pulley encoder counts at home position.
+   * @return Swivel pulley encoder counts at home position.
+   */
+  int GetHomeCounts() const { return home_counts_; }
+  /**
+   * @brief Get swivel pulley angle in radians at home position.
+   * @return Swivel pulley angle in radians at home position.
+   */
+  double GetHomeAngle() const { return home_angle_; }
+  /**
+   * @brief Get the conversion factor from encoder counts to swivel pulley angle.
+   * @return _[rad/counts]_ Swivel pulley angle per encoder count.
+   */
+  double GetCountsToAngleFactor() const { return params_.PulleyAngleFactorRad(); }
 
   /**
    * @brief Update pulleys system configuration at home position.
@@ -106,6 +106,11 @@ class Winch
    * @return servo motor home position in encoder counts.
    */
   int32_t GetServoHomePos() const { return servo_home_pos_; }
+  /**
+   * @brief Get the conversion factor from servo motor encoder counts to cable length.
+   * @return _[m/counts]_ Cable length per servo motor encoder count.
+   */
+  double GetCountsToLengthFactor() { return params_.CountsToLengthFactor(); }
 
   /**
    * @brief Set motor position target and change operational mode to CYCLIC_POSITION.
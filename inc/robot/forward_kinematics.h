@@ -0,0 +1,141 @@
+/**
+ * @file forward_kinematics.h
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing the real time forward kinematics of the cable robot, i.e. the
+ * estimator of platform pose from measured cable lengths and swivel angles.
+ */
+
+#ifndef CABLE_ROBOT_FORWARD_KINEMATICS_H
+#define CABLE_ROBOT_FORWARD_KINEMATICS_H
+
+#include <cmath>
+
+#include "robot/actuators_state.h"
+#include "robot/inverse_kinematics.h"
+#include "utils/types.h"
+
+/**
+ * @brief Real time forward kinematics of the cable robot.
+ *
+ * This is the native counterpart of _CalcDirectKinematicsLengthSwivel.m_ in
+ * _matlab/common_: the platform pose is the one whose inverse kinematics best matches,
+ * in the least-squares sense, measured cable lengths and pulley swivel angles of all
+ * active actuators, weighted as in the MATLAB script.
+ *
+ * The pose is estimated by a Levenberg-Marquardt, warm started from the previous
+ * estimate at every call and bounded to a fixed budget of iterations, so that its cost
+ * per real time cycle is known in advance. Since the platform moves little between
+ * consecutive cycles, one or two iterations are usually enough to track it, while the
+ * budget lets the estimate catch up after a jump, spreading the work over a few cycles.
+ *
+ * Jacobians are analytic and all memory is allocated at construction, hence an update
+ * never allocates and takes a few microseconds.
+ *
+ * At least 3 active actuators are needed for the pose to be observable. The first
+ * estimate starts from a guess just below the pulleys centroid, unless given by
+ * Reset(), and the estimator restarts from there whenever it gets lost.
+ */
+class ForwardKinematics
+{
+ public:
+  /**
+   * @brief A platform pose, i.e. position followed by orientation angles.
+   */
+  typedef InverseKinematics::Pose Pose;
+
+  /**
+   * @brief ForwardKinematics constructor.
+   * @param[in] params Robot configuration parameters, only active actuators are used.
+   * @param[in] angles_type Parametrization of platform orientation, which must match
+   * the one of the platform state the estimate is written onto, see WriteTo().
+   */
+  ForwardKinematics(const grabcdpr::Params& params,
+                    const OrientationAngles angles_type = ANGLES_TILT_TORSION);
+
+  /**
+   * @brief Check if the platform pose is observable from active actuators.
+   * @return _True_ if there are at least 3 active actuators, _false_ otherwise.
+   */
+  bool IsObservable() const { return inverse_kinematics_.CablesNum() >= 3; }
+  /**
+   * @brief Restart estimation from a given pose.
+   * @param[in] pose Platform pose to start next estimate from.
+   */
+  void Reset(const Pose& pose);
+
+  /**
+   * @brief Update the pose estimate with the latest measurements.
+   * @param[in] actuators_state State of all active actuators, in configuration order.
+   * @return _True_ if the estimate converged within the budget of iterations, _false_
+   * otherwise.
+   * @note Wait-free and allocation-free, to be called by the real time thread.
+   */
+  bool Update(const ActuatorsState& actuators_state);
+
+  /**
+   * @brief Get latest pose estimate.
+   * @return Latest pose estimate.
+   */
+  const Pose& GetPose() const { return pose_; }
+  /**
+   * @brief Check if latest estimate converged within the budget of iterations.
+   * @return _True_ if latest estimate converged, _false_ otherwise.
+   */
+  bool IsConverged() const { return converged_; }
+  /**
+   * @brief Get the norm of the weighted residuals of latest estimate.
+   * @return The norm of the weighted residuals of latest estimate.
+   */
+  double GetResidualNorm() const { return sqrt(2.0 * cost_); }
+  /**
+   * @brief Get the number of iterations spent by latest estimate.
+   * @return The number of iterations spent by latest estimate.
+   */
+  size_t GetIterations() const { return iterations_; }
+  /**
+   * @brief Get the inverse kinematics at latest pose estimate.
+   * @return The inverse kinematics at latest pose estimate.
+   */
+  const InverseKinematics& GetInverseKinematics() const { return inverse_kinematics_; }
+
+  /**
+   * @brief Write latest pose estimate and cables configuration onto a robot status
+   * structure.
+   * @param[out] vars Robot status to be updated.
+   * @see InverseKinematics::WriteTo()
+   */
+  void WriteTo(grabcdpr::Vars* vars) const { inverse_kinematics_.WriteTo(vars); }
+
+ private:
+  static constexpr size_t kMaxIterations_ = 5;     // budget per update
+  static constexpr double kLengthWeight_  = 100.0; // as in MATLAB script
+  static constexpr double kSwivelWeight_  = 10.0;  // as in MATLAB script
+  static constexpr double kStepTolerance_ = 1e-9;  // [m, rad] converged below this
+  static constexpr double kInitDamping_   = 1e-3;
+  static constexpr double kMinDamping_    = 1e-9;
+  static constexpr double kMaxDamping_    = 1e6;
+  static constexpr double kMinCurvature_  = 1.0;   // floor of damped diagonal
+  static constexpr double kStartDrop_     = 1.0;   // [m] first guess below pulleys
+
+  InverseKinematics inverse_kinematics_;
+  Pose start_pose_;
+  Pose pose_;
+  double damping_;
+  double cost_;
+  size_t iterations_;
+  bool converged_;
+
+  // Preallocated workspace, one row per measurement
+  vect<double> lengths_;
+  vect<double> swivels_;
+  vect<double> residuals_;
+  vect<Pose> jacobian_;
+  vect<double> trial_residuals_;
+  vect<Pose> trial_jacobian_;
+
+  bool Evaluate(const Pose& pose, vect<double>* residuals, vect<Pose>* jacobian,
+                double* cost);
+};
+
+#endif // CABLE_ROBOT_FORWARD_KINEMATICS_H
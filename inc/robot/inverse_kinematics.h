@@ -0,0 +1,190 @@
+/**
+ * @file inverse_kinematics.h
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing the inverse kinematics of the cable robot, i.e. cables and
+ * swivel pulleys configuration given the platform one.
+ */
+
+#ifndef CABLE_ROBOT_INVERSE_KINEMATICS_H
+#define CABLE_ROBOT_INVERSE_KINEMATICS_H
+
+#include <array>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "grabcommon.h"
+#include "libcdpr/inc/types.h"
+
+/**
+ * @brief The parametrizations of platform orientation supported by inverse kinematics.
+ *
+ * They match the homonymous ones of _matlab/common/RotationParametrizations.m_.
+ */
+enum OrientationAngles : uint8_t
+{
+  ANGLES_TAIT_BRYAN,  /**< Rotation about X, then Y, then Z (mobile axes). */
+  ANGLES_RPY,         /**< Rotation about Z, then Y, then X (mobile axes). */
+  ANGLES_EULER_ZYZ,   /**< Rotation about Z, then Y, then Z (mobile axes). */
+  ANGLES_TILT_TORSION /**< Euler ZYZ with torsion as third angle plus the first one. */
+};
+
+/**
+ * @brief Configuration of a cable and its swivel pulley, as computed by inverse
+ * kinematics.
+ *
+ * Names follow _matlab/common/CableVar.m_: _P_ is the platform origin, _A_ the cable
+ * attachment point on the platform, _D_ the swivel pulley center and _B_ the point where
+ * the cable leaves the pulley. All vectors are expressed in global frame.
+ */
+struct CableKinematics
+{
+  double length;     /**< [m] Cable length, from pulley swivel axis to platform. */
+  double swivel_ang; /**< [rad] Swivel angle of the pulley. */
+  double tan_ang;    /**< [rad] Angle of the cable winding on the pulley. */
+
+  std::array<double, 3> pos_PA_glob; /**< [m] Attachment point from platform origin. */
+  std::array<double, 3> pos_OA_glob; /**< [m] Attachment point from global origin. */
+  std::array<double, 3> pos_DA_glob; /**< [m] Attachment point from swivel pulley. */
+  std::array<double, 3> pos_BA_glob; /**< [m] Cable straight segment. */
+  std::array<double, 3> vers_u;      /**< Radial versor of the swivel pulley plane. */
+  std::array<double, 3> vers_w;      /**< Normal versor to the swivel pulley plane. */
+  std::array<double, 3> vers_n;      /**< Normal versor to the cable in pulley plane. */
+  std::array<double, 3> vers_rho;    /**< Cable versor, from pulley to platform. */
+
+  double speed;          /**< [m/s] Cable speed. */
+  double swivel_ang_vel; /**< [rad/s] Swivel angle speed. */
+  double tan_ang_vel;    /**< [rad/s] Winding angle speed. */
+
+  std::array<double, 6> geometric_jacobian_row; /**< Cable speed over platform twist. */
+  std::array<double, 6> analitic_jacobian_row;  /**< Cable speed over pose derivative. */
+};
+
+/**
+ * @brief Inverse kinematics of the cable robot.
+ *
+ * This is the native counterpart of _UpdateIKZeroOrd.m_ and _UpdateIKFirstOrd.m_ in
+ * _matlab/common_: given the platform pose (and its derivative), it computes length,
+ * swivel angle and winding angle (and their speeds) of the cable of every active
+ * actuator, together with the rows of platform jacobians.
+ *
+ * Geometry is copied from the robot configuration once at construction, while all
+ * results are stored in memory preallocated there, so that updates never allocate and
+ * take a few hundred nanoseconds per cable. Hence they can be safely called at every
+ * cycle of the real time thread, e.g. within ControllerBase::CalcCtrlActions().
+ *
+ * Results can also be written onto a grabcdpr::Vars instance, which is the robot status
+ * handed to controllers.
+ */
+class InverseKinematics
+{
+ public:
+  /**
+   * @brief A 3D vector.
+   */
+  typedef std::array<double, 3> Vec3;
+  /**
+   * @brief A 3x3 matrix, in row-major order.
+   */
+  typedef std::array<double, 9> Mat3;
+  /**
+   * @brief A platform pose, i.e. position followed by orientation angles, or its time
+   * derivative.
+   */
+  typedef std::array<double, 6> Pose;
+
+  /**
+   * @brief InverseKinematics constructor.
+   * @param[in] params Robot configuration parameters, only active actuators are used.
+   * @param[in] angles_type Parametrization of platform orientation.
+   */
+  InverseKinematics(const grabcdpr::Params& params,
+                    const OrientationAngles angles_type = ANGLES_TILT_TORSION);
+
+  /**
+   * @brief Get the number of active cables.
+   * @return The number of active cables.
+   */
+  size_t CablesNum() const { return cables_.size(); }
+  /**
+   * @brief Get the parametrization of platform orientation.
+   * @return The parametrization of platform orientation.
+   */
+  OrientationAngles GetAnglesType() const { return angles_type_; }
+
+  /**
+   * @brief Update cables configuration given platform pose.
+   * @param[in] pose Platform pose, i.e. position of its origin and orientation angles.
+   * @return _True_ if the pose is feasible, _false_ if any cable attachment point falls
+   * inside the circle of its swivel pulley, in which case winding angle and length of
+   * that cable are not valid.
+   */
+  bool UpdateZeroOrd(const Pose& pose);
+  /**
+   * @brief Update cables speed and jacobians given platform pose derivative.
+   * @param[in] pose_deriv Platform velocity and orientation angles derivative.
+   * @note UpdateZeroOrd() must be called beforehand with the current pose.
+   */
+  void UpdateFirstOrd(const Pose& pose_deriv);
+
+  /**
+   * @brief Get the configuration of an active cable.
+   * @param[in] idx Index of the cable among the active ones, with no bound check.
+   * @return The configuration of the inquired cable.
+   */
+  const CableKinematics& GetCable(const size_t idx) const { return cables_[idx]; }
+  /**
+   * @brief Get the platform rotation matrix of latest pose.
+   * @return The platform rotation matrix, in row-major order.
+   */
+  const Mat3& GetRotMat() const { return rot_mat_; }
+  /**
+   * @brief Get the matrix mapping orientation angles derivative of latest pose onto
+   * platform angular velocity.
+   * @return The matrix mapping orientation angles derivative onto angular velocity, in
+   * row-major order.
+   */
+  const Mat3& GetHMat() const { return h_mat_; }
+  /**
+   * @brief Get the platform angular velocity of latest pose derivative.
+   * @return [rad/s] The platform angular velocity in global frame.
+   */
+  const Vec3& GetAngularVel() const { return angular_vel_; }
+
+  /**
+   * @brief Write latest results onto a robot status structure.
+   *
+   * Platform pose is written onto grabcdpr::Vars::platform, if any, and the
+   * configuration of each active cable onto the element of grabcdpr::Vars::cables
+   * matching its actuator, if any. No memory is allocated.
+   * @param[out] vars Robot status to be updated.
+   */
+  void WriteTo(grabcdpr::Vars* vars) const;
+
+ private:
+  struct CableGeometry
+  {
+    size_t actuator_idx;
+    Vec3 pos_OD_glob;
+    Vec3 vers_i;
+    Vec3 vers_j;
+    Vec3 vers_k;
+    Vec3 pos_PA_loc;
+    double pulley_radius;
+  };
+
+  vect<CableGeometry> geometry_;
+  vect<CableKinematics> cables_;
+  OrientationAngles angles_type_;
+  Vec3 pos_PG_loc_;
+
+  Pose pose_;
+  Mat3 rot_mat_;
+  Mat3 h_mat_; // angular velocity over orientation angles derivative
+  Vec3 pos_PG_glob_;
+  Vec3 angular_vel_;
+
+  void UpdateRotation();
+};
+
+#endif // CABLE_ROBOT_INVERSE_KINEMATICS_H
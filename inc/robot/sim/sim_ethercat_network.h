@@ -0,0 +1,153 @@
+/**
+ * @file sim_ethercat_network.h
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing an in-process simulated EtherCAT network, to run the cable robot
+ * without any physical hardware.
+ */
+
+#ifndef CABLE_ROBOT_SIM_ETHERCAT_NETWORK_H
+#define CABLE_ROBOT_SIM_ETHERCAT_NETWORK_H
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "ecrt.h"
+#include "libgrabec/inc/ethercatslave.h"
+
+#include "robot/sim/sim_goldsolowhistle.h"
+
+/**
+ * @brief An in-process simulated EtherCAT network of GoldSoloWhistle drives.
+ *
+ * This class replaces the EtherCAT master stack and the physical bus: it owns a
+ * simulated process image, i.e. the domain memory, where each slave registered with
+ * AddSlave() finds its PDO entries exactly like in a real domain. Therefore the very same
+ * slave objects (e.g. grabec::GoldSoloWhistleDrive), with their own state machines,
+ * commands and signals, run unchanged on top of it.
+ *
+ * Slaves which are given a SimGoldSoloWhistleDrive model are animated: at every cycle
+ * the model is stepped with the latest output PDOs and its input PDOs are written back
+ * into the process image before the slaves read it.
+ *
+ * The network runs its own periodic thread which, at every cycle:
+ * 1. steps all drive models and writes their inputs into the process image;
+ * 2. calls the given cycle function, i.e. the master work function reading inputs,
+ * computing control actions and writing outputs;
+ * 3. reads the outputs of each drive model from the process image.
+ *
+ * @note The layout of the process image relies on the domain registries exposed by
+ * grabec::EthercatSlave (see GetDomainEntry() and Init()), i.e. the same information used
+ * by the real master to configure its domain.
+ */
+class SimEthercatNetwork
+{
+ public:
+  /**
+   * @brief SimEthercatNetwork constructor.
+   * @param[in] cycle_time_nsec _[nsec]_ Cycle time of the simulated network.
+   */
+  explicit SimEthercatNetwork(const uint32_t cycle_time_nsec);
+  ~SimEthercatNetwork();
+
+  /**
+   * @brief Add a slave to the network.
+   * @param[in] slave_ptr Pointer to the slave, whose PDO entries are laid out in the
+   * simulated process image.
+   * @param[in] drive_params Parameters of the drive model animating the slave.
+   * @param[in] animate If _false_, the slave is laid out in the process image but no
+   * drive model is attached to it.
+   * @note All slaves must be added before calling Configure().
+   */
+  void AddSlave(grabec::EthercatSlave* slave_ptr, const SimDriveParams& drive_params,
+                const bool animate = true);
+  /**
+   * @brief Allocate the simulated process image and let each slave point to it.
+   * @return _True_ if all PDO entries could be mapped, _false_ otherwise.
+   */
+  bool Configure();
+
+  /**
+   * @brief Start the periodic thread of the simulated network.
+   * @param[in] cycle_fun Function to be called at every cycle, typically the master
+   * work function, in between the exchange of inputs and outputs with drive models.
+   * @return _True_ if the thread was started, _false_ if it was already running or the
+   * network is not configured.
+   */
+  bool Start(const std::function<void()>& cycle_fun);
+  /**
+   * @brief Stop the periodic thread of the simulated network, if running.
+   */
+  void Stop();
+  /**
+   * @brief Check if the periodic thread of the simulated network is running.
+   * @return _True_ if running, _false_ otherwise.
+   */
+  bool IsRunning() const { return running_.load(); }
+
+  /**
+   * @brief Get the drive model animating a slave.
+   * @param[in] slave_idx Index of the slave, in order of addition.
+   * @return A pointer to the drive model, or NULL if slave is not animated.
+   * @warning Drive models live in the thread of the simulated network: access them only
+   * when the network is stopped or from within the cycle function.
+   */
+  SimGoldSoloWhistleDrive* GetDrive(const size_t slave_idx);
+  /**
+   * @brief Get the number of slaves in the network.
+   * @return The number of slaves in the network.
+   */
+  size_t GetSlavesNum() const { return slaves_.size(); }
+
+ private:
+  // PDO objects of a GoldSoloWhistle drive, in CiA-402 dictionary terms
+  enum PdoObjects : uint8_t
+  {
+    STATUS_WORD,
+    DISPLAY_OP_MODE,
+    POS_ACTUAL_VALUE,
+    VEL_ACTUAL_VALUE,
+    TORQUE_ACTUAL_VALUE,
+    DIGITAL_INPUTS,
+    AUX_POS_ACTUAL_VALUE,
+    CONTROL_WORD,
+    OP_MODE,
+    TARGET_POSITION,
+    TARGET_VELOCITY,
+    TARGET_TORQUE,
+    PDO_OBJECTS_NUM,
+    UNKNOWN_OBJECT = PDO_OBJECTS_NUM
+  };
+
+  struct SimSlave
+  {
+    grabec::EthercatSlave* slave_ptr;
+    SimDriveParams drive_params;
+    bool animate;
+    std::unique_ptr<SimGoldSoloWhistleDrive> drive;
+    long offsets[PDO_OBJECTS_NUM]; // -1 if object is not mapped
+  };
+
+  static constexpr uint8_t kDefaultEntrySize_ = 4; // [bytes] for unknown objects
+
+  uint32_t cycle_time_nsec_;
+  std::vector<SimSlave> slaves_;
+  std::vector<uint8_t> process_image_;
+  bool configured_ = false;
+
+  std::thread thread_;
+  std::atomic<bool> running_;
+  std::function<void()> cycle_fun_;
+
+  void Loop();
+  void WriteInputs(SimSlave& sim_slave);
+  void ReadOutputs(SimSlave& sim_slave);
+
+  static PdoObjects LookupObject(const uint16_t index, const uint8_t subindex);
+  static uint8_t ObjectSize(const PdoObjects object);
+};
+
+#endif // CABLE_ROBOT_SIM_ETHERCAT_NETWORK_H
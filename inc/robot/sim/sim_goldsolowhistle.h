@@ -0,0 +1,178 @@
+/**
+ * @file sim_goldsolowhistle.h
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing a simulated model of an Elmo GoldSoloWhistle drive and its
+ * motor, exchanging the same process data of the physical one.
+ */
+
+#ifndef CABLE_ROBOT_SIM_GOLDSOLOWHISTLE_H
+#define CABLE_ROBOT_SIM_GOLDSOLOWHISTLE_H
+
+#include <stdint.h>
+
+/**
+ * @brief Tuning parameters of a simulated GoldSoloWhistle drive and its motor.
+ */
+struct SimDriveParams
+{
+  double motor_inertia        = 2.0e-4;  /**< [kg m^2] Rotor and reflected inertia. */
+  double viscous_friction     = 5.0e-3;  /**< [Nm s/rad] Viscous friction coeff. */
+  double load_torque          = 0.0;     /**< [Nm] Load torque at initial position. */
+  double load_stiffness       = 0.05;    /**< [Nm/rad] Elastic load, e.g. the cable. */
+  double rated_torque         = 1.0;     /**< [Nm] Torque equal to 1000 points. */
+  int16_t max_torque          = 3000;    /**< [per thousand] Torque saturation. */
+  double pos_loop_bandwidth   = 50.0;    /**< [rad/s] Position loop bandwidth. */
+  double vel_loop_bandwidth   = 300.0;   /**< [rad/s] Velocity loop bandwidth. */
+  int32_t max_following_err   = 500000;  /**< [counts] Position error causing fault. */
+  uint32_t motor_encoder_res  = 1048576; /**< [counts/rev] Motor encoder resolution. */
+  double aux_encoder_coupling = 0.0;     /**< Aux encoder counts per motor count. */
+};
+
+/**
+ * @brief Output process data received by the simulated drive (RxPDOs).
+ */
+struct SimDriveCommand
+{
+  uint16_t control_word   = 0; /**< CiA-402 control word (0x6040). */
+  int8_t op_mode          = 0; /**< Modes of operation (0x6060). */
+  int32_t target_position = 0; /**< [counts] Target position (0x607A). */
+  int32_t target_velocity = 0; /**< [counts/s] Target velocity (0x60FF). */
+  int16_t target_torque   = 0; /**< [per thousand] Target torque (0x6071). */
+};
+
+/**
+ * @brief Input process data produced by the simulated drive (TxPDOs).
+ */
+struct SimDriveFeedback
+{
+  uint16_t status_word         = 0; /**< CiA-402 status word (0x6041). */
+  int8_t display_op_mode       = 0; /**< Modes of operation display (0x6061). */
+  int32_t pos_actual_value     = 0; /**< [counts] Position actual value (0x6064). */
+  int32_t vel_actual_value     = 0; /**< [counts/s] Velocity actual value (0x606C). */
+  int16_t torque_actual_value  = 0; /**< [per thousand] Torque actual value (0x6077). */
+  uint32_t digital_inputs      = 0; /**< Digital inputs (0x60FD). */
+  int32_t aux_pos_actual_value = 0; /**< [counts] Auxiliary encoder position. */
+};
+
+/**
+ * @brief A simulated Elmo GoldSoloWhistle drive, driving a single motor.
+ *
+ * The model includes:
+ * - the CiA-402 power state machine, driven by the control word and reflected in the
+ * status word exactly as the physical drive does, including fault and fault reset;
+ * - cyclic synchronous position, velocity and torque modes, implemented as cascaded
+ * proportional position and velocity loops on top of a saturated torque source;
+ * - a rigid motor with inertia and viscous friction, loaded by an elastic torque which
+ * mimics the cable pulling the platform, and held by its brake whenever operation is not
+ * enabled;
+ * - the motor encoder and an auxiliary encoder, which is rigidly coupled to the motor
+ * one by a configurable ratio to mimic the swivel pulley encoder.
+ *
+ * A following error larger than SimDriveParams::max_following_err while in cyclic
+ * position mode triggers a fault, like the physical drive protection does.
+ *
+ * This class does not depend on any EtherCAT library and it is not thread-safe: it is
+ * meant to be stepped by the real-time thread only.
+ */
+class SimGoldSoloWhistleDrive
+{
+ public:
+  /**
+   * @brief CiA-402 operational modes handled by the simulated drive.
+   */
+  enum OpModes : int8_t
+  {
+    NONE            = 0,
+    CYCLIC_POSITION = 8,
+    CYCLIC_VELOCITY = 9,
+    CYCLIC_TORQUE   = 10
+  };
+
+  /**
+   * @brief CiA-402 power states.
+   */
+  enum States : uint8_t
+  {
+    ST_NOT_READY_TO_SWITCH_ON,
+    ST_SWITCH_ON_DISABLED,
+    ST_READY_TO_SWITCH_ON,
+    ST_SWITCHED_ON,
+    ST_OPERATION_ENABLED,
+    ST_QUICK_STOP_ACTIVE,
+    ST_FAULT_REACTION_ACTIVE,
+    ST_FAULT
+  };
+
+  /**
+   * @brief SimGoldSoloWhistleDrive constructor.
+   * @param[in] params Tuning parameters of drive and motor.
+   * @param[in] init_pos Initial motor encoder position in counts.
+   * @param[in] init_aux_pos Initial auxiliary encoder position in counts.
+   */
+  SimGoldSoloWhistleDrive(const SimDriveParams& params = SimDriveParams(),
+                          const int32_t init_pos = 0, const int32_t init_aux_pos = 0);
+
+  /**
+   * @brief Set latest output process data sent by the master.
+   * @param[in] command Latest output process data.
+   */
+  void SetCommand(const SimDriveCommand& command);
+  /**
+   * @brief Advance the simulation by a given time interval.
+   * @param[in] dt_sec _[sec]_ Time interval, typically the cycle time of the master.
+   */
+  void Step(const double dt_sec);
+  /**
+   * @brief Get current input process data to be sent to the master.
+   * @return Current input process data.
+   */
+  const SimDriveFeedback& GetFeedback() const { return feedback_; }
+
+  /**
+   * @brief Get current CiA-402 power state.
+   * @return Current CiA-402 power state.
+   */
+  States GetState() const { return state_; }
+  /**
+   * @brief Force the drive into fault, e.g. to test fault handling.
+   */
+  void InjectFault();
+
+  /**
+   * @brief Compute the status word corresponding to a power state.
+   * @param[in] state The CiA-402 power state.
+   * @return The corresponding status word.
+   */
+  static uint16_t StateToStatusWord(const States state);
+
+ private:
+  static constexpr int kSubStepsNum_         = 10;
+  static constexpr uint16_t kRemoteBit_      = 0x0200;
+  static constexpr uint16_t kTargetReachBit_ = 0x0400;
+  static constexpr uint16_t kFaultResetBit_  = 0x0080;
+
+  SimDriveParams params_;
+  SimDriveCommand command_;
+  SimDriveFeedback feedback_;
+  States state_;
+  bool prev_fault_reset_;
+  bool target_reached_;
+
+  double counts_per_rad_;
+  int32_t prev_target_position_;
+  double position_;      // [rad]
+  double velocity_;      // [rad/s]
+  double torque_;        // [Nm] applied by the motor
+  double init_position_; // [rad]
+  int32_t init_pos_;
+  int32_t init_aux_pos_;
+
+  void UpdateStateMachine();
+  double CalcMotorTorque(const double dt_sec);
+  double CalcLoadTorque() const;
+  void IntegrateDynamics(const double motor_torque, const double dt_sec);
+  void UpdateFeedback();
+};
+
+#endif // CABLE_ROBOT_SIM_GOLDSOLOWHISTLE_H
@@ -0,0 +1,144 @@
+/**
+ * @file app_settings.h
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing application-level settings of cable robot app, read from the
+ * same JSON configuration file describing the robot.
+ */
+
+#ifndef CABLE_ROBOT_APP_SETTINGS_H
+#define CABLE_ROBOT_APP_SETTINGS_H
+
+#include <string>
+
+#include "json.hpp"
+
+#include "homing/homing_optimizer_options.h"
+#include "robot/sim/sim_goldsolowhistle.h"
+#include "utils/overrun_policy.h"
+#include "utils/rt_profile.h"
+
+/**
+ * @brief Backends of the EtherCAT network.
+ */
+enum EthercatBackend : uint8_t
+{
+  ETHERCAT_HARDWARE, /**< Physical network, driven by the EtherCAT master stack. */
+  ETHERCAT_SIMULATED /**< In-process simulated network, see SimEthercatNetwork. */
+};
+
+/**
+ * @brief Formats of the data log, see LogBuffer.
+ */
+enum DataLogFormat : uint8_t
+{
+  DATA_LOG_TEXT,  /**< CSV text lines, through easylogging++ _data_ logger. */
+  DATA_LOG_BINARY /**< Compact self-describing binary records, see binary_log.h. */
+};
+
+/**
+ * @brief Application-level settings, i.e. everything which is not a robot parameter.
+ */
+struct AppSettings
+{
+  EthercatBackend ethercat_backend = ETHERCAT_HARDWARE; /**< EtherCAT network backend. */
+  SimDriveParams sim_drive_params; /**< Drive model parameters, if simulated. */
+  DataLogFormat data_log_format = DATA_LOG_TEXT;        /**< Data log format. */
+  /** Data log file path, if binary format is selected. */
+  std::string data_log_binary_filename = "/tmp/cable-robot-logs/data.bin";
+  /** Directory where continuous telemetry recordings are stored. */
+  std::string telemetry_dir = "/tmp/cable-robot-logs";
+  /** Directory where homing datasets are saved, none if empty. */
+  std::string homing_dataset_dir;
+  HomingOptimizerOptions homing_optimizer; /**< Tuning of the homing optimizer. */
+  RtProfile rt_profile; /**< Hardening profile of the real time thread. */
+  OverrunBudget overrun_budget; /**< Budget of tolerated real time cycle overruns. */
+};
+
+/**
+ * @brief A parser of application-level settings from a JSON configuration file.
+ *
+ * Settings are optional: any missing field keeps its default value, so that older
+ * configuration files are still valid. The expected layout is:
+ * @code{.json}
+ * "ethercat": {
+ *   "backend": "hardware",
+ *   "simulation": {
+ *     "motor_inertia": 0.0002,
+ *     ...
+ *   }
+ * },
+ * "logging": {
+ *   "data_format": "text",
+ *   "binary_file": "/tmp/cable-robot-logs/data.bin",
+ *   "telemetry_dir": "/tmp/cable-robot-logs",
+ *   "homing_dataset_dir": "/tmp/cable-robot-logs"
+ * },
+ * "homing": {
+ *   "confident_length_std": 0.003,
+ *   "confident_angle_std": 0.002
+ * },
+ * "rt_profile": {
+ *   "rt_cpus": "3",
+ *   "sched_policy": "fifo",
+ *   "sched_priority": 98,
+ *   "lock_memory": true,
+ *   "prefault_stack_size": 524288,
+ *   "prefault_heap_size": 16777216,
+ *   "log_cpus": "1-2",
+ *   "gui_cpus": "0"
+ * },
+ * "overrun_policy": {
+ *   "enabled": true,
+ *   "max_consecutive": 3,
+ *   "max_total": 50,
+ *   "recovery_cycles": 1000,
+ *   "max_holds": 3
+ * }
+ * @endcode
+ * where _backend_ is either _"hardware"_ or _"simulated"_ and _simulation_ may include
+ * any field of SimDriveParams but the motor encoder resolution, which is taken from the
+ * actuators parameters. Data log _data_format_ is either _"text"_ or _"binary"_, in which
+ * case data are logged onto _binary_file_ instead of the easylogging++ _data_ logger,
+ * while _telemetry_dir_ is where continuous telemetry recordings are stored and
+ * _homing_dataset_dir_, if given, where the measurements of every homing acquisition
+ * are saved as binary snapshots.
+ * In _homing_, confidence thresholds of the incremental home estimate are in meters and
+ * radians, and should be a few times the standard deviation reachable with the noise of
+ * actual encoders. See HomingOptimizerOptions.
+ * In _rt_profile_, CPU lists are given either as strings in the same format of kernel
+ * _isolcpus_ option, e.g. _"2-3,5"_, or as arrays of CPU indices, and _sched_policy_ is
+ * one of _"unchanged"_, _"fifo"_, _"rr"_ or _"other"_. Sizes are in bytes. See RtProfile.
+ * In _overrun_policy_, all counts are in real time cycles, and _max_total_ is unlimited
+ * if 0. See OverrunBudget.
+ */
+class AppSettingsJsonParser
+{
+ public:
+  /**
+   * @brief Parse application settings from a JSON configuration file.
+   * @param[in] filename Path of the JSON configuration file.
+   * @param[out] settings Parsed settings.
+   * @return _True_ if file is valid, _false_ otherwise.
+   */
+  bool ParseFile(const std::string& filename, AppSettings* settings);
+
+ private:
+  // Half the default stack size of a thread, leaving room for the rest of the cycle
+  static constexpr size_t kMaxPrefaultStackSize_ = 4 << 20; // [bytes]
+
+  bool ParseEthercat(const nlohmann::json& ethercat, AppSettings* settings) const;
+  bool ParseSimDriveParams(const nlohmann::json& simulation,
+                           SimDriveParams* params) const;
+  bool ParseLogging(const nlohmann::json& logging, AppSettings* settings) const;
+  bool ParseHoming(const nlohmann::json& homing, HomingOptimizerOptions* options) const;
+  bool ParseRtProfile(const nlohmann::json& rt_profile, RtProfile* profile) const;
+  bool ParseOverrunPolicy(const nlohmann::json& overrun_policy,
+                          OverrunBudget* budget) const;
+  bool ParseCount(const nlohmann::json& parent, const std::string& key,
+                  uint32_t* count) const;
+  bool ParseCpus(const nlohmann::json& parent, const std::string& key,
+                 std::vector<int>* cpus) const;
+};
+
+#endif // CABLE_ROBOT_APP_SETTINGS_H
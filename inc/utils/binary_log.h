@@ -0,0 +1,304 @@
+/**
+ * @file binary_log.h
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing a compact, self-describing binary format for data logs, with
+ * its writer and reader.
+ *
+ * A binary data log is made of a file header followed by fixed-size records.
+ * The file header carries the schema of every loggable message, i.e. its type, name and
+ * the ordered list of its fields name and type, as defined by MSG_FIELDS_ORDER_DEFINE.
+ * Each record is made of the message type, its timestamp and its fields, all of them in
+ * little-endian byte order and without any padding:
+ * @code
+ * header:  "CRBINLOG" | version (u32) | schemas num (u32) | schemas...
+ * schema:  msg type (u32) | name | fields num (u16) | fields...
+ * field:   type (u8) | name
+ * name:    length (u16) | characters...
+ * record:  msg type (u32) | timestamp (f64) | fields...
+ * @endcode
+ */
+
+#ifndef CABLE_ROBOT_BINARY_LOG_H
+#define CABLE_ROBOT_BINARY_LOG_H
+
+#include <cstdio>
+#include <stdint.h>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "utils/wire_layout.h"
+
+/**
+ * @brief Types of binary log fields.
+ */
+enum BinaryFieldType : uint8_t
+{
+  BIN_INT8,
+  BIN_UINT8,
+  BIN_INT16,
+  BIN_UINT16,
+  BIN_INT32,
+  BIN_UINT32,
+  BIN_INT64,
+  BIN_UINT64,
+  BIN_FLOAT32,
+  BIN_FLOAT64,
+  BIN_MAX_FIELD_TYPES
+};
+
+/**
+ * @brief Get the size of a binary log field.
+ * @param[in] type Field type.
+ * @return The size of the field in bytes, 0 if type is not valid.
+ */
+size_t BinaryFieldSize(const BinaryFieldType type);
+
+/**
+ * @brief Get the binary log field type corresponding to an arithmetic or enum type.
+ * @return The binary log field type.
+ */
+template <typename T> constexpr BinaryFieldType BinaryFieldTypeOf()
+{
+  static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,
+                "Only arithmetic and enum types can be binary log fields");
+  // clang-format off
+  return std::is_floating_point<T>::value ? (sizeof(T) == 4 ? BIN_FLOAT32 : BIN_FLOAT64)
+       : sizeof(T) == 1 ? (std::is_signed<T>::value ? BIN_INT8  : BIN_UINT8)
+       : sizeof(T) == 2 ? (std::is_signed<T>::value ? BIN_INT16 : BIN_UINT16)
+       : sizeof(T) == 4 ? (std::is_signed<T>::value ? BIN_INT32 : BIN_UINT32)
+       :                  (std::is_signed<T>::value ? BIN_INT64 : BIN_UINT64);
+  // clang-format on
+}
+
+/**
+ * @brief A field of a binary log message schema.
+ */
+struct BinaryMsgField
+{
+  /**
+   * @brief BinaryMsgField default constructor.
+   */
+  BinaryMsgField() : type(BIN_MAX_FIELD_TYPES) {}
+  /**
+   * @brief BinaryMsgField full constructor.
+   * @param[in] _name Field name.
+   * @param[in] _type Field type.
+   */
+  BinaryMsgField(const std::string& _name, const BinaryFieldType _type)
+    : name(_name), type(_type)
+  {}
+
+  std::string name;     /**< Field name. */
+  BinaryFieldType type; /**< Field type. */
+};
+
+/**
+ * @brief The schema of a binary log message, i.e. its type and its ordered fields.
+ */
+struct BinaryMsgSchema
+{
+  /**
+   * @brief BinaryMsgSchema constructor.
+   * @param[in] _msg_type Message type, as in MsgType.
+   * @param[in] _name Message name.
+   */
+  BinaryMsgSchema(const uint32_t _msg_type = 0, const std::string& _name = "")
+    : msg_type(_msg_type), name(_name)
+  {}
+
+  /**
+   * @brief Get the size of a record of this message.
+   * @return The size of a record of this message in bytes, header included.
+   */
+  size_t RecordSize() const;
+
+  uint32_t msg_type;                  /**< Message type, as in MsgType. */
+  std::string name;                   /**< Message name. */
+  std::vector<BinaryMsgField> fields; /**< Ordered message fields. */
+};
+
+/**
+ * @brief Append a field of arithmetic or enum type to a binary log message schema.
+ * @param[out] schema Schema to be extended.
+ * @param[in] name Field name.
+ */
+template <typename T>
+typename std::enable_if<!std::is_class<T>::value>::type
+AppendBinaryField(BinaryMsgSchema* schema, const char* name)
+{
+  schema->fields.push_back(BinaryMsgField(name, BinaryFieldTypeOf<T>()));
+}
+
+/**
+ * @brief Append all fields of a nested message body to a binary log message schema.
+ *
+ * Nested fields are flattened, i.e. they are appended one by one with their own names,
+ * in the order defined by MSG_FIELDS_ORDER_DEFINE for the nested type.
+ * @param[out] schema Schema to be extended.
+ * @param[in] name Field name, unused.
+ */
+template <typename T>
+typename std::enable_if<std::is_class<T>::value>::type
+AppendBinaryField(BinaryMsgSchema* schema, const char* name)
+{
+  (void)name;
+  WireLayout<T>::Describe(schema);
+}
+
+/**
+ * @brief A writer of binary data log files.
+ *
+ * Records are accumulated in a large preallocated buffer and written onto file in big
+ * batches, either when the buffer is full or upon Flush().
+ *
+ * @note Messages are required to provide a _kWireSize_ constant, a
+ * _serialize(char*)_ function and a _binarySchema()_ static function, see
+ * MSG_STRUCT_DECLARE.
+ */
+class BinaryLogWriter
+{
+ public:
+  /**
+   * @brief BinaryLogWriter constructor.
+   * @param[in] buffer_size Size of the write buffer in bytes.
+   */
+  explicit BinaryLogWriter(const size_t buffer_size = 1 << 16);
+  ~BinaryLogWriter();
+
+  /**
+   * @brief Open a new binary log file and write its header.
+   * @param[in] filename Path of the binary log file, overwritten if existing.
+   * @param[in] schemas Schemas of all messages that may be logged.
+   * @return _True_ if file could be open and header written, _false_ otherwise, e.g. if
+   * any record would exceed the maximum record size.
+   */
+  bool Open(const std::string& filename, const std::vector<BinaryMsgSchema>& schemas);
+  /**
+   * @brief Check if a binary log file is open.
+   * @return _True_ if a binary log file is open, _false_ otherwise.
+   */
+  bool IsOpen() const { return file_ != NULL; }
+  /**
+   * @brief Flush buffered records and close binary log file, if open.
+   */
+  void Close();
+
+  /**
+   * @brief Append a message record to the buffer, flushing it first if full.
+   * @param[in] msg Message to be logged.
+   * @return _True_ if record was appended, _false_ if no file is open or if buffered
+   * records could not be written.
+   */
+  template <class MsgT> bool Write(const MsgT& msg)
+  {
+    static_assert(MsgT::kWireSize <= kMaxRecordSize_, "Binary log record too large");
+    if (!IsOpen())
+      return false;
+    if (buffer_.size() - buffer_len_ < MsgT::kWireSize && !Flush())
+      return false;
+    buffer_len_ += msg.serialize(&buffer_[buffer_len_]);
+    return true;
+  }
+  /**
+   * @brief Write buffered records onto file.
+   * @return _True_ if buffered records were written, _false_ otherwise.
+   */
+  bool Flush();
+
+ private:
+  static constexpr size_t kMaxRecordSize_ = 256; // [bytes]
+
+  FILE* file_ = NULL;
+  std::vector<char> buffer_;
+  size_t buffer_len_ = 0;
+};
+
+/**
+ * @brief A field value read from a binary log record.
+ */
+struct BinaryFieldValue
+{
+  BinaryFieldType type; /**< Field type. */
+  union
+  {
+    int64_t i;  /**< Value of signed integer fields. */
+    uint64_t u; /**< Value of unsigned integer fields. */
+    double f;   /**< Value of floating point fields. */
+  };
+};
+
+/**
+ * @brief A record read from a binary log file.
+ */
+struct BinaryLogRecord
+{
+  const BinaryMsgSchema* schema = NULL; /**< Schema of the record message. */
+  double timestamp              = 0.0;  /**< Message timestamp. */
+  std::vector<BinaryFieldValue> values; /**< Message fields, in schema order. */
+};
+
+/**
+ * @brief Outcomes of reading a binary log record.
+ */
+enum BinaryReadStatus : uint8_t
+{
+  BIN_READ_OK,           /**< A record was read. */
+  BIN_READ_EOF,          /**< End of file, right after the last complete record. */
+  BIN_READ_TRUNCATED,    /**< File ends in the middle of a record. */
+  BIN_READ_UNKNOWN_TYPE, /**< Record message type is not among file schemas. */
+  BIN_READ_ERROR         /**< No file open or I/O error. */
+};
+
+/**
+ * @brief Get a description of the outcome of reading a binary log record.
+ * @param[in] status The outcome of reading a binary log record.
+ * @return A description of the outcome.
+ */
+const char* BinaryReadStatusName(const BinaryReadStatus status);
+
+/**
+ * @brief A reader of binary data log files, based on the schemas in their header.
+ */
+class BinaryLogReader
+{
+ public:
+  ~BinaryLogReader();
+
+  /**
+   * @brief Open a binary log file and read its header.
+   * @param[in] filename Path of the binary log file.
+   * @return _True_ if file could be open and has a valid header, _false_ otherwise.
+   */
+  bool Open(const std::string& filename);
+  /**
+   * @brief Close binary log file, if open.
+   */
+  void Close();
+
+  /**
+   * @brief Get the schemas of the messages stored in the open file.
+   * @return The schemas of the messages stored in the open file.
+   */
+  const std::vector<BinaryMsgSchema>& GetSchemas() const { return schemas_; }
+
+  /**
+   * @brief Read next record.
+   * @param[out] record Record to be filled, only valid if one was read.
+   * @return BIN_READ_OK if a record was read, BIN_READ_EOF if there are no more records
+   * or the error which prevents reading the rest of the file, e.g. a file which was
+   * truncated while being written or a record whose message type is unknown.
+   */
+  BinaryReadStatus ReadRecord(BinaryLogRecord* record);
+
+ private:
+  FILE* file_ = NULL;
+  std::vector<BinaryMsgSchema> schemas_;
+  std::vector<char> record_buffer_;
+
+  bool ReadHeader();
+  bool ReadName(std::string* name);
+};
+
+#endif // CABLE_ROBOT_BINARY_LOG_H
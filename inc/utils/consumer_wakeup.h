@@ -0,0 +1,96 @@
+/**
+ * @file consumer_wakeup.h
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing a wake-up signal letting the consumer of a queue sleep while
+ * the queue is empty, instead of polling it.
+ */
+
+#ifndef CABLE_ROBOT_CONSUMER_WAKEUP_H
+#define CABLE_ROBOT_CONSUMER_WAKEUP_H
+
+#include <atomic>
+#include <errno.h>
+#include <semaphore.h>
+#include <time.h>
+
+/**
+ * @brief A wake-up signal from the producer to the consumer of a queue, e.g. SpscRing.
+ *
+ * The consumer sleeps on a semaphore once it finds the queue empty, see Wait(), and the
+ * producer posts it only if the consumer is actually sleeping, see Notify(). Hence a
+ * producer pushing onto a non-empty queue, or onto a queue whose consumer is busy,
+ * never enters the kernel, and notifying never blocks nor allocates memory.
+ *
+ * @note Only one consumer thread is allowed, while any thread can notify.
+ */
+class ConsumerWakeup
+{
+ public:
+  /**
+   * @brief ConsumerWakeup default constructor.
+   */
+  ConsumerWakeup() : sleeping_(false) { sem_init(&sem_, 0, 0); }
+  ~ConsumerWakeup() { sem_destroy(&sem_); }
+
+  ConsumerWakeup(const ConsumerWakeup&) = delete;
+  ConsumerWakeup& operator=(const ConsumerWakeup&) = delete;
+
+  /**
+   * @brief Wake the consumer up if it is sleeping, to be called right after pushing.
+   * @note Wait-free, safe to be called from the real time thread.
+   */
+  void Notify()
+  {
+    // Pairs with the fence in Wait(): either the consumer sees the new item, or this
+    // sees the consumer sleeping.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (sleeping_.load(std::memory_order_relaxed) &&
+        sleeping_.exchange(false, std::memory_order_relaxed))
+      sem_post(&sem_);
+  }
+  /**
+   * @brief Wake the consumer up anyway, e.g. to make it check a stop request.
+   */
+  void Wake() { sem_post(&sem_); }
+
+  /**
+   * @brief Sleep until notified or woken up, unless the queue is not empty anymore.
+   * @param[in] is_empty Callable with signature bool(), telling if the queue is empty.
+   * @param[in] timeout_msec Maximum sleep time in milliseconds.
+   * @return _False_ if the timeout expired, _true_ otherwise.
+   * @note To be called by the consumer thread only, once it found the queue empty.
+   */
+  template <class IsEmpty>
+  bool Wait(IsEmpty is_empty, const long timeout_msec)
+  {
+    sleeping_.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!is_empty())
+    {
+      sleeping_.store(false, std::memory_order_relaxed);
+      return true;
+    }
+
+    timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += timeout_msec / 1000;
+    deadline.tv_nsec += (timeout_msec % 1000) * 1000000;
+    if (deadline.tv_nsec >= 1000000000)
+    {
+      deadline.tv_sec++;
+      deadline.tv_nsec -= 1000000000;
+    }
+    int ret;
+    while ((ret = sem_timedwait(&sem_, &deadline)) != 0 && errno == EINTR)
+      continue;
+    sleeping_.store(false, std::memory_order_relaxed);
+    return ret == 0;
+  }
+
+ private:
+  sem_t sem_;
+  std::atomic<bool> sleeping_;
+};
+
+#endif // CABLE_ROBOT_CONSUMER_WAKEUP_H
@@ -12,11 +12,16 @@
 #include <QCoreApplication>
 #include <QMutex>
 #include <QThread>
-#include <QWaitCondition>
+
+#include <atomic>
 
 #include "easylogging++.h"
 
+#include "utils/binary_log.h"
+#include "utils/consumer_wakeup.h"
 #include "utils/msgs.h"
+#include "utils/rt_profile.h"
+#include "utils/spsc_ring.h"
 #include "utils/types.h"
 
 //---------------------- MESSAGE LOG FUNCTIONS ---------------------------------------//
@@ -39,6 +44,18 @@ void LogWinchStatusMsg(el::Logger* data_logger, const WinchStatusMsg& msg);
  * @param[in] msg Actuator status message to be logged.
  */
 void LogActuatorStatusMsg(el::Logger* data_logger, const ActuatorStatusMsg& msg);
+/**
+ * @brief Log ActuatorTelemetryMsg.
+ * @param[in] data_logger Pointer to easylogger employed.
+ * @param[in] msg Actuator telemetry message to be logged.
+ */
+void LogActuatorTelemetryMsg(el::Logger* data_logger, const ActuatorTelemetryMsg& msg);
+/**
+ * @brief Log PlatformPoseMsg.
+ * @param[in] data_logger Pointer to easylogger employed.
+ * @param[in] msg Platform pose message to be logged.
+ */
+void LogPlatformPoseMsg(el::Logger* data_logger, const PlatformPoseMsg& msg);
 
 // ... add new message log function declaration here
 
@@ -48,35 +65,96 @@ void LogActuatorStatusMsg(el::Logger* data_logger, const ActuatorStatusMsg& msg)
  * Logging, despite being made very easy thanks to easylogging++ package, still takes some
  * time, which can be critical in real time thread with short cycle periods.
  * To account for this, this log buffer has been developed.
- * It takes serialized information, which are thus received and copied very fast at high
- * rates, and dumps them onto the log file whenever it can, without clogging the more
- * demanding source thread.
+ * It takes serialized information, which are copied into a preallocated wait-free
+ * single-producer/single-consumer ring of fixed-size slots (see SpscRing), and dumps
+ * them onto the log file from its own thread, draining the ring in batches.
  *
+ * Pushing a message never takes a lock nor allocates memory, hence, as long as the
+ * overflow policy is not OverflowPolicy::BLOCK, it is safe to log straight from the real
+ * time thread. When the ring is full, depending on the overflow policy, either the newest
+ * message is discarded, the oldest one is overwritten or the producer waits. Dropped
+ * messages and high-water mark are counted, see GetStats(), and any loss is reported in
+ * the event log when logging stops. The logging thread sleeps while the buffer is
+ * empty and is woken up by the next push, see ConsumerWakeup.
+ *
+ * By default messages are logged as CSV text lines through easylogging++. Alternatively,
+ * they can be logged in a compact binary format (see binary_log.h), which avoids any
+ * number-to-text conversion and writes records onto file in big batches. Binary logs can
+ * be converted back to the very same CSV text with _tools/binlog2csv_.
+ *
+ * @note Only one producer thread at a time is allowed.
  * @note To the developer: the queued message needs to be serialized, have a _deserialize_
  * option and for each message a new message-specific log function must be present, such
  * as LogActuatorStatusMsg. Moreover a new case to LogData private function must be add,
  * with the new message enum value.
- * @see
  */
 class LogBuffer: public QThread
 {
   Q_OBJECT
  public:
+  /**
+   * @brief Statistics of a log buffer.
+   */
+  struct Stats
+  {
+    size_t capacity;          /**< Number of slots of the buffer. */
+    uint64_t pushed;          /**< Number of messages pushed so far. */
+    uint64_t dropped;         /**< Number of messages lost so far, see OverflowPolicy. */
+    uint64_t high_water_mark; /**< Maximum number of messages ever queued at once. */
+  };
+
   /**
    * @brief LogBuffer constructor.
    * @param[in] data_logger Pointer to easylogger employed.
-   * @param[in] buffer_size Maximum buffer size, i.e. maximum queued messages number.
+   * @param[in] buffer_size Minimum buffer size, i.e. maximum queued messages number,
+   * rounded up to a power of 2.
+   * @param[in] policy What to do with a new message when buffer is full.
    */
-  LogBuffer(el::Logger* data_logger, const size_t buffer_size = 2000)
-    : logger_(data_logger), stop_requested_(false),
-      buffer_(buffer_size, QByteArray(static_cast<int>(kMaxMsgSize), 0))
+  LogBuffer(el::Logger* data_logger, const size_t buffer_size = 2048,
+            const OverflowPolicy policy = OverflowPolicy::DROP_NEWEST)
+    : logger_(data_logger), stop_requested_(false), buffer_(buffer_size, policy)
   {}
 
+  /**
+   * @brief Log messages in binary format onto given file, instead of text format.
+   * @param[in] filename Path of the binary log file, overwritten if existing.
+   * @return _True_ if binary log file could be open, _false_ otherwise, in which case
+   * text format is kept.
+   * @note To be called before starting the logging thread.
+   */
+  bool SetBinaryOutput(const std::string& filename);
+  /**
+   * @brief Restrict the logging thread to a set of CPUs, e.g. away from the real time
+   * one.
+   * @param[in] cpus CPUs the logging thread may run on, any if empty.
+   * @note To be called before starting the logging thread.
+   */
+  void SetCpus(const std::vector<int>& cpus) { cpus_ = cpus; }
+
   /**
    * @brief Stop logging command.
+   *
+   * All messages already queued are logged before the logging thread exits. Messages
+   * lost so far, if any, are reported in the event log.
    */
   void Stop();
 
+  /**
+   * @brief Queue a serialized message to be logged.
+   * @param[in] data Serialized message.
+   * @param[in] size Size of serialized message in bytes.
+   * @return _True_ if message was queued, _false_ if it was dropped, either because the
+   * buffer is full or because the message does not fit into a slot.
+   * @note Wait-free and allocation-free unless policy is OverflowPolicy::BLOCK.
+   */
+  bool Push(const char* data, const size_t size);
+
+  /**
+   * @brief Get buffer statistics.
+   * @return Buffer statistics.
+   */
+  Stats GetStats() const;
+
  public slots:
   /**
    * @brief Collect an incoming message to be logged.
@@ -85,26 +163,39 @@ class LogBuffer: public QThread
   void collectMsg(QByteArray msg);
 
  private:
-  el::Logger* logger_ = NULL;
+  static constexpr size_t kSlotSize_    = kMaxMsgSize; // [bytes]
+  static constexpr size_t kBatchSize_   = 64;          // [msgs] drained at once
+  static constexpr long kIdleFlushMsec_ = 100;         // [msec] binary flush if idle
+
+  struct Slot
+  {
+    quint16 size;
+    char data[kSlotSize_];
+  };
 
-  QMutex mutex_;
-  QWaitCondition buffer_not_empty;
-  QWaitCondition buffer_not_full;
-  bool stop_requested_;
+  el::Logger* logger_ = NULL;
+  BinaryLogWriter binary_writer_;
+  std::vector<int> cpus_;
 
-  std::vector<QByteArray> buffer_;
-  quint16 circular_cnt_;
+  std::atomic<bool> stop_requested_;
+  SpscRing<Slot> buffer_;
+  ConsumerWakeup wakeup_;
+  Slot batch_[kBatchSize_];
 
   HeaderMsg header_;
   // Full messages
   MotorStatusMsg motor_status_;
   WinchStatusMsg winch_status_;
   ActuatorStatusMsg actuator_status_;
+  ActuatorTelemetryMsg actuator_telemetry_;
+  PlatformPoseMsg platform_pose_;
   // ... add new message here
 
   void run() override;
 
-  void LogData(const quint16 index);
+  void LogData(const Slot& slot);
+  template <class MsgT>
+  void LogMsg(const MsgT& msg, void (*log_text)(el::Logger*, const MsgT&));
 };
 
 #endif // CABLE_ROBOT_EASYLOG_WRAPPER_H
@@ -0,0 +1,83 @@
+/**
+ * @file id_index_map.h
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing a dense map from actuator IDs to their slots in a list.
+ */
+
+#ifndef CABLE_ROBOT_ID_INDEX_MAP_H
+#define CABLE_ROBOT_ID_INDEX_MAP_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+#include <vector>
+
+/**
+ * @brief A dense map from actuator IDs to their slots in a list, e.g. the list of active
+ * actuators.
+ *
+ * Actuator IDs are small indices in robot configuration, so the map is a plain table
+ * indexed by ID, where every lookup costs a bound check and a load, regardless of the
+ * number of actuators.
+ *
+ * The map is immutable after construction, hence it can be shared and read by any
+ * thread, including the real time one, without locking.
+ */
+class IdIndexMap
+{
+ public:
+  static constexpr size_t kNotFound = SIZE_MAX; /**< Slot of IDs not in the list. */
+
+  /**
+   * @brief IdIndexMap default constructor, with no IDs.
+   */
+  IdIndexMap() {}
+  /**
+   * @brief IdIndexMap constructor.
+   * @param[in] ids List of IDs, whose order defines their slots. If an ID occurs more
+   * than once, only its first occurrence is mapped.
+   */
+  explicit IdIndexMap(const std::vector<id_t>& ids);
+
+  /**
+   * @brief Find the slot of an ID.
+   * @param[in] id The ID to look for.
+   * @return The slot of given ID in the list, or _kNotFound_ if it is not in the list.
+   */
+  size_t Find(const id_t id) const { return id < slots_.size() ? slots_[id] : kNotFound; }
+  /**
+   * @brief Check if an ID is in the list.
+   * @param[in] id The ID to look for.
+   * @return _True_ if given ID is in the list, _false_ otherwise.
+   */
+  bool Contains(const id_t id) const { return Find(id) != kNotFound; }
+
+  /**
+   * @brief Get the ID at a given slot, with no bound check.
+   * @param[in] slot The slot of the inquired ID.
+   * @return The ID at given slot.
+   */
+  id_t Id(const size_t slot) const { return ids_[slot]; }
+  /**
+   * @brief Get the list of IDs.
+   * @return The list of IDs, in slots order.
+   */
+  const std::vector<id_t>& Ids() const { return ids_; }
+  /**
+   * @brief Get the number of IDs in the list.
+   * @return The number of IDs in the list.
+   */
+  size_t Size() const { return ids_.size(); }
+  /**
+   * @brief Check if the list is empty.
+   * @return _True_ if the list is empty, _false_ otherwise.
+   */
+  bool Empty() const { return ids_.empty(); }
+
+ private:
+  std::vector<id_t> ids_;
+  std::vector<size_t> slots_; // indexed by ID, kNotFound for IDs not in the list
+};
+
+#endif // CABLE_ROBOT_ID_INDEX_MAP_H
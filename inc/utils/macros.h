@@ -3,28 +3,28 @@
 
 #include "grabcommon.h"
 
-//---------------------- DECLARATIONS ------------------------------------------------//
-
-#ifndef MSG_SERIALIZATION_DECLARE
-#define MSG_SERIALIZATION_DECLARE(_MsgType)                                              \
-  QDataStream& operator<<(QDataStream& ostream, const _MsgType& data);                   \
-  QDataStream& operator>>(QDataStream& istream, _MsgType& data);                         \
-  QByteArray serialize(const _MsgType##Msg& data);
-#endif
+#include "utils/binary_log.h"
+#include "utils/wire_layout.h"
 
+//---------------------- DECLARATIONS ------------------------------------------------//
 
 #ifndef MSG_STRUCT_DECLARE
 #define MSG_STRUCT_DECLARE(_MSG_TYPE, _BodyType)                                         \
   struct _BodyType##Msg: BaseMsg                                                         \
   {                                                                                      \
+    static constexpr size_t kWireSize = WireSize<HeaderMsg>() + WireSize<_BodyType>();   \
+                                                                                         \
     _BodyType##Msg() : BaseMsg(_MSG_TYPE) {}                                             \
     _BodyType##Msg(const _BodyType& data) : BaseMsg(_MSG_TYPE), body(data) {}            \
     _BodyType##Msg(const double time_sec, const _BodyType& data)                         \
       : BaseMsg(time_sec, _MSG_TYPE), body(data)                                         \
     {}                                                                                   \
-    _BodyType##Msg(const QByteArray data) : BaseMsg(_MSG_TYPE) { deserialize(data); }    \
+    _BodyType##Msg(const QByteArray& data) : BaseMsg(_MSG_TYPE) { deserialize(data); }   \
+    size_t serialize(char* buffer) const;                                                \
     QByteArray serialized() const;                                                       \
-    void deserialize(QByteArray data);                                                   \
+    bool deserialize(const char* data, const size_t size);                               \
+    bool deserialize(const QByteArray& data);                                            \
+    static BinaryMsgSchema binarySchema();                                               \
     _BodyType body;                                                                      \
   };
 #endif
@@ -32,46 +32,79 @@
 //---------------------- DEFINITIONS -------------------------------------------------//
 
 // Actions (WHAT)
-#define OSTREAM_MSG_FIELD(_field) << data._field
-#define ISTREAM_MSG_FIELD(_field) >> data._field
+#define WIRE_SIZE_MSG_FIELD(_field) +WireSize<decltype(Type::_field)>()
+#define WIRE_WRITE_MSG_FIELD(_field) buffer = WireWrite(buffer, data._field);
+#define WIRE_READ_MSG_FIELD(_field) buffer = WireRead(buffer, &data->_field);
+#define SCHEMA_MSG_FIELD(_field)                                                         \
+  AppendBinaryField<decltype(Type::_field)>(schema, #_field);
 
 #ifndef MSG_FIELDS_ORDER_DEFINE
 #define MSG_FIELDS_ORDER_DEFINE(_MsgType, ...)                                           \
-  QDataStream& operator<<(QDataStream& ostream, const _MsgType& data)                    \
+  template <> struct WireLayout<_MsgType>                                                \
   {                                                                                      \
-    return ostream FOR_EACH(OSTREAM_MSG_FIELD, __VA_ARGS__);                             \
-  }                                                                                      \
+    typedef _MsgType Type;                                                               \
                                                                                          \
-  QDataStream& operator>>(QDataStream& istream, _MsgType& data)                          \
-  {                                                                                      \
-    istream FOR_EACH(ISTREAM_MSG_FIELD, __VA_ARGS__);                                    \
-    return istream;                                                                      \
-  }
+    static constexpr size_t kSize = 0 FOR_EACH(WIRE_SIZE_MSG_FIELD, __VA_ARGS__);        \
+                                                                                         \
+    static char* Write(char* buffer, const _MsgType& data)                               \
+    {                                                                                    \
+      FOR_EACH(WIRE_WRITE_MSG_FIELD, __VA_ARGS__)                                        \
+      return buffer;                                                                     \
+    }                                                                                    \
+                                                                                         \
+    static const char* Read(const char* buffer, _MsgType* data)                          \
+    {                                                                                    \
+      FOR_EACH(WIRE_READ_MSG_FIELD, __VA_ARGS__)                                         \
+      return buffer;                                                                     \
+    }                                                                                    \
+                                                                                         \
+    static void Describe(BinaryMsgSchema* schema)                                        \
+    {                                                                                    \
+      FOR_EACH(SCHEMA_MSG_FIELD, __VA_ARGS__)                                            \
+    }                                                                                    \
+  };
 #endif
 
 #ifndef MSG_SERIALIZATION_DEFINE
 #define MSG_SERIALIZATION_DEFINE(_MSG_TYPE, _BodyType)                                   \
-  QByteArray _BodyType##Msg::serialized() const { return serialize(*this); }             \
+  constexpr size_t _BodyType##Msg::kWireSize;                                            \
+                                                                                         \
+  size_t _BodyType##Msg::serialize(char* buffer) const                                   \
+  {                                                                                      \
+    WireWrite(WireWrite(buffer, header), body);                                          \
+    return kWireSize;                                                                    \
+  }                                                                                      \
+                                                                                         \
+  QByteArray _BodyType##Msg::serialized() const                                          \
+  {                                                                                      \
+    QByteArray data(static_cast<int>(kWireSize), Qt::Uninitialized);                     \
+    serialize(data.data());                                                              \
+    return data;                                                                         \
+  }                                                                                      \
                                                                                          \
-  void _BodyType##Msg::deserialize(QByteArray data)                                      \
+  bool _BodyType##Msg::deserialize(const char* data, const size_t size)                  \
   {                                                                                      \
-    QDataStream stream(&data, QIODevice::ReadOnly);                                      \
-    stream.setVersion(QDataStream::Qt_4_5);                                              \
+    if (size < kWireSize)                                                                \
+      return false;                                                                      \
     HeaderMsg tmp_header;                                                                \
-    stream >> tmp_header;                                                                \
-    if (header.msg_type != _MSG_TYPE)                                                    \
-      return;                                                                            \
-    stream >> body;                                                                      \
+    const char* cursor = WireRead(data, &tmp_header);                                    \
+    if (tmp_header.msg_type != _MSG_TYPE)                                                \
+      return false;                                                                      \
+    WireRead(cursor, &body);                                                             \
     header = tmp_header;                                                                 \
+    return true;                                                                         \
+  }                                                                                      \
+                                                                                         \
+  bool _BodyType##Msg::deserialize(const QByteArray& data)                               \
+  {                                                                                      \
+    return deserialize(data.constData(), static_cast<size_t>(data.size()));              \
   }                                                                                      \
                                                                                          \
-  QByteArray serialize(const _BodyType##Msg& data)                                       \
+  BinaryMsgSchema _BodyType##Msg::binarySchema()                                         \
   {                                                                                      \
-    QByteArray buf;                                                                      \
-    QDataStream strm(&buf, QIODevice::WriteOnly);                                        \
-    strm.setVersion(QDataStream::Qt_4_5);                                                \
-    strm << data.header << data.body;                                                    \
-    return buf;                                                                          \
+    BinaryMsgSchema schema(_MSG_TYPE, #_BodyType);                                       \
+    WireLayout<_BodyType>::Describe(&schema);                                            \
+    return schema;                                                                       \
   }
 #endif
 
@@ -8,7 +8,7 @@
 #ifndef CABLE_ROBOT_MSGS_H
 #define CABLE_ROBOT_MSGS_H
 
-#include <QDataStream>
+#include <QByteArray>
 
 #include "utils/macros.h"
 #include "utils/types.h"
@@ -24,6 +24,8 @@ enum MsgType : quint32
   MOTOR_STATUS,
   WINCH_STATUS,
   ACTUATOR_STATUS,
+  ACTUATOR_TELEMETRY,
+  PLATFORM_POSE,
   // ... add new message type here, e.g. MY_TYPE, ...
 };
 
@@ -69,20 +71,13 @@ struct HeaderMsg
   MsgType msg_type; /**< Message type. */
 };
 
-/**
- * @brief operator << for serialization of HeaderMsg.
- * @param[out] ostream
- * @param[in] data Header message to be serialized.
- * @return Serialized HeaderMsg.
- */
-QDataStream& operator<<(QDataStream& ostream, const HeaderMsg& data);
-/**
- * @brief operator >> for deserialization of HeaderMsg.
- * @param[in] istream
- * @param[out] data Header message to be filled.
- * @return
- */
-QDataStream& operator>>(QDataStream& istream, HeaderMsg& data);
+// clang-format off
+// @cond DO_NOT_DOCUMENT
+MSG_FIELDS_ORDER_DEFINE(HeaderMsg,
+                        msg_type,
+                        timestamp)
+// @endcond
+// clang-format on
 
 //----------------------  MESSAGES ---------------------------------------------------//
 
@@ -111,16 +106,65 @@ struct BaseMsg
   HeaderMsg header; /**< Header message including timestamp and message type. */
 };
 
-extern const size_t kMaxMsgSize; /**< Maximum serialized message size in bytes. */
+// clang-format off
+// @cond DO_NOT_DOCUMENT
+MSG_FIELDS_ORDER_DEFINE(MotorStatus,
+                        id,
+                        op_mode,
+                        motor_position,
+                        motor_speed,
+                        motor_torque)
+MSG_FIELDS_ORDER_DEFINE(WinchStatus,
+                        id,
+                        op_mode,
+                        motor_position,
+                        motor_speed,
+                        motor_torque,
+                        cable_length,
+                        aux_position)
+MSG_FIELDS_ORDER_DEFINE(ActuatorStatus,
+                        id,
+                        op_mode,
+                        motor_position,
+                        motor_speed,
+                        motor_torque,
+                        cable_length,
+                        aux_position,
+                        state,
+                        pulley_angle)
+MSG_FIELDS_ORDER_DEFINE(ActuatorTelemetry,
+                        status,
+                        ctrl_mode,
+                        setpoint)
+MSG_FIELDS_ORDER_DEFINE(PlatformPose,
+                        position_x,
+                        position_y,
+                        position_z,
+                        angle_x,
+                        angle_y,
+                        angle_z,
+                        residual_norm,
+                        iterations,
+                        converged)
+// ... message order goes here, this is how you need to handle data in parser for example.
+// E.g. MSG_FIELDS_ORDER_DEFINE(MyTypeStruct, field1, field2, ...)
+// @endcond
+// clang-format on
 
 MSG_STRUCT_DECLARE(MOTOR_STATUS, MotorStatus)
 MSG_STRUCT_DECLARE(WINCH_STATUS, WinchStatus)
 MSG_STRUCT_DECLARE(ACTUATOR_STATUS, ActuatorStatus)
+MSG_STRUCT_DECLARE(ACTUATOR_TELEMETRY, ActuatorTelemetry)
+MSG_STRUCT_DECLARE(PLATFORM_POSE, PlatformPose)
 // ... and here, e.g. MSG_STRUCT_DECLARE(MY_TYPE, MyTypeStruct), ...
 
-MSG_SERIALIZATION_DECLARE(MotorStatus)
-MSG_SERIALIZATION_DECLARE(WinchStatus)
-MSG_SERIALIZATION_DECLARE(ActuatorStatus)
-// ... and here, e.g. MSG_SERIALIZATION_DECLARE(MyTypeStruct)
+/**
+ * @brief Maximum serialized message size in bytes, computed at compile time.
+ */
+constexpr size_t kMaxMsgSize =
+  MaxWireSize(MotorStatusMsg::kWireSize, WinchStatusMsg::kWireSize,
+              ActuatorStatusMsg::kWireSize, ActuatorTelemetryMsg::kWireSize,
+              PlatformPoseMsg::kWireSize);
+// ... and here, e.g. MyTypeStructMsg::kWireSize
 
 #endif // CABLE_ROBOT_MSGS_H
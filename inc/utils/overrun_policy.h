@@ -0,0 +1,175 @@
+/**
+ * @file overrun_policy.h
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing the policy handling overruns of the real time cycle, i.e.
+ * counting and classifying them and deciding when to hold the robot or escalate.
+ */
+
+#ifndef CABLE_ROBOT_OVERRUN_POLICY_H
+#define CABLE_ROBOT_OVERRUN_POLICY_H
+
+#include <atomic>
+#include <stdint.h>
+
+/**
+ * @brief The budget of overruns tolerated by OverrunPolicy.
+ */
+struct OverrunBudget
+{
+  /** If _false_, overruns are only counted and classified. */
+  bool enabled = true;
+  /** Consecutive overrun cycles tolerated, before holding. */
+  uint32_t max_consecutive = 3;
+  /** Overrun cycles tolerated since last recovery, before holding, unlimited if 0. */
+  uint32_t max_total = 50;
+  /** Consecutive cycles on time needed to release a hold. */
+  uint32_t recovery_cycles = 1000;
+  /** Holds tolerated since last reset, before escalating at next budget violation. */
+  uint32_t max_holds = 3;
+};
+
+/**
+ * @brief The policy handling overruns of the real time cycle.
+ *
+ * At the beginning of every cycle, the real time thread reports how long the previous
+ * cycle worked and how many whole periods were lost before waking up, see Update(). Each
+ * cycle is then classified as either on time, late (the previous cycle exceeded its
+ * period, but the schedule was caught up) or skipped (one or more periods were lost),
+ * and counted accordingly.
+ *
+ * Overruns are tolerated within a budget (see OverrunBudget), either of consecutive or
+ * total overrun cycles. Once the budget is exceeded, the policy moves to ST_HOLD, where
+ * the robot is expected to freeze its set points, until enough consecutive cycles are on
+ * time again and the policy gets back to ST_NOMINAL. If the budget is exceeded while
+ * holding, or once too many holds occurred, the policy moves to ST_ESCALATED instead,
+ * where it stays until reset, see RequestReset().
+ *
+ * Like RtTimingStats, there is a single writer, i.e. the real time thread, which never
+ * blocks nor allocates, while any thread can read state and counters.
+ */
+class OverrunPolicy
+{
+ public:
+  /**
+   * @brief Policy states.
+   */
+  enum States : uint8_t
+  {
+    ST_NOMINAL,  /**< Overruns within budget: the robot is controlled as usual. */
+    ST_HOLD,     /**< Budget exceeded: set points are frozen until cycles are on time. */
+    ST_ESCALATED /**< Budget exceeded while holding, or too many holds: error. */
+  };
+
+  /**
+   * @brief Classes of cycles, as far as timing is concerned.
+   */
+  enum Overruns : uint8_t
+  {
+    ON_TIME, /**< Previous cycle within its period and no period lost. */
+    LATE,    /**< Previous cycle exceeded its period, but no whole period was lost. */
+    SKIPPED  /**< One or more whole periods were lost before this cycle. */
+  };
+
+  /**
+   * @brief OverrunPolicy default constructor, with default budget.
+   */
+  OverrunPolicy();
+
+  /**
+   * @brief Set cycle period and budget, and reset the policy.
+   * @param[in] period_nsec Nominal cycle period in nanoseconds.
+   * @param[in] budget Budget of tolerated overruns.
+   * @note Not thread-safe: call it before the real time thread starts.
+   */
+  void Setup(const uint64_t period_nsec, const OverrunBudget& budget);
+
+  //--------- Writer side (real time thread only) ------------------------------------//
+
+  /**
+   * @brief Classify current cycle and update the policy accordingly.
+   * @param[in] prev_work_nsec Work time of previous cycle in nanoseconds, see
+   * RtTimingStats::EndCycle().
+   * @param[in] missed_cycles Number of whole periods lost right before current cycle,
+   * see RtTimingStats::CycleMissedWakeups().
+   * @return The state of the policy for current cycle.
+   */
+  States Update(const uint64_t prev_work_nsec, const uint64_t missed_cycles);
+  /**
+   * @brief Get the class of current cycle, as of last Update().
+   * @return The class of current cycle.
+   */
+  Overruns CycleOverrun() const { return cycle_overrun_; }
+
+  //--------- Reader side (any thread) -----------------------------------------------//
+
+  /**
+   * @brief Request a reset of the policy, i.e. back to ST_NOMINAL with no overruns and
+   * holds to account for, carried out at next Update().
+   */
+  void RequestReset() { reset_requested_.store(true, std::memory_order_relaxed); }
+
+  /**
+   * @brief Get the state of the policy.
+   * @return The state of the policy.
+   */
+  States GetState() const { return state_.load(std::memory_order_relaxed); }
+  /**
+   * @brief Get the budget of tolerated overruns.
+   * @return The budget of tolerated overruns.
+   */
+  const OverrunBudget& GetBudget() const { return budget_; }
+  /**
+   * @brief Get the number of late cycles since last reset.
+   * @return The number of late cycles since last reset.
+   */
+  uint64_t LateCount() const { return late_count_.load(std::memory_order_relaxed); }
+  /**
+   * @brief Get the number of skipped cycles since last reset, i.e. of wake-ups after
+   * lost periods.
+   * @return The number of skipped cycles since last reset.
+   */
+  uint64_t SkippedCount() const { return skipped_count_.load(std::memory_order_relaxed); }
+  /**
+   * @brief Get the number of whole periods lost since last reset.
+   * @return The number of whole periods lost since last reset.
+   */
+  uint64_t LostCyclesCount() const
+  {
+    return lost_cycles_count_.load(std::memory_order_relaxed);
+  }
+  /**
+   * @brief Get the number of holds since last reset.
+   * @return The number of holds since last reset.
+   */
+  uint64_t HoldsCount() const { return holds_count_.load(std::memory_order_relaxed); }
+
+  /**
+   * @brief Get the name of given state.
+   * @param[in] state The state.
+   * @return The name of the state.
+   */
+  static const char* StateName(const States state);
+
+ private:
+  uint64_t period_nsec_;
+  OverrunBudget budget_;
+
+  std::atomic<States> state_;
+  std::atomic<uint64_t> late_count_;
+  std::atomic<uint64_t> skipped_count_;
+  std::atomic<uint64_t> lost_cycles_count_;
+  std::atomic<uint64_t> holds_count_;
+  std::atomic<bool> reset_requested_;
+
+  // Writer-only state
+  Overruns cycle_overrun_;
+  uint32_t consecutive_;    // overrun cycles in a row
+  uint32_t total_;          // overrun cycles since last recovery
+  uint32_t on_time_cycles_; // cycles on time in a row, while holding
+
+  void ResetNow();
+  bool BudgetExceeded() const;
+};
+
+#endif // CABLE_ROBOT_OVERRUN_POLICY_H
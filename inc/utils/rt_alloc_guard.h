@@ -0,0 +1,88 @@
+/**
+ * @file rt_alloc_guard.h
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing a debug tool to detect heap allocations inside real-time code
+ * sections, such as the control step of the cable robot.
+ */
+
+#ifndef CABLE_ROBOT_RT_ALLOC_GUARD_H
+#define CABLE_ROBOT_RT_ALLOC_GUARD_H
+
+#include <stdint.h>
+
+/**
+ * @brief Debug tool to detect heap allocations performed inside real-time code sections.
+ *
+ * When the application is built with `CABLE_ROBOT_RT_ALLOC_GUARD` defined (see
+ * cable_robot.pro), malloc(), calloc(), realloc() and their aligned variants are
+ * interposed by thin wrappers around the glibc allocator. Whenever any of them is called
+ * by a thread which armed the guard, the violation is counted, reported on stderr and,
+ * if trapping is enabled (default), a SIGTRAP is raised so that a debugger stops right at
+ * the offending call.
+ *
+ * Since C++ operator new relies on malloc(), any container growth or temporary
+ * allocation is caught as well.
+ *
+ * Without the define all methods are empty inlines, so guarded sections cost nothing.
+ */
+class RtAllocGuard
+{
+ public:
+  /**
+   * @brief RAII helper arming the guard for the calling thread within its scope.
+   */
+  class Scope
+  {
+   public:
+    Scope() { RtAllocGuard::Arm(); }
+    ~Scope() { RtAllocGuard::Disarm(); }
+  };
+
+#ifdef CABLE_ROBOT_RT_ALLOC_GUARD
+  /**
+   * @brief Start trapping heap allocations on the calling thread.
+   */
+  static void Arm();
+  /**
+   * @brief Stop trapping heap allocations on the calling thread.
+   */
+  static void Disarm();
+  /**
+   * @brief Check if the guard is armed on the calling thread.
+   * @return _True_ if the guard is armed on the calling thread, _false_ otherwise.
+   */
+  static bool IsArmed();
+  /**
+   * @brief Enable or disable raising SIGTRAP on violation.
+   * @param[in] value If _false_, violations are only counted and reported.
+   */
+  static void SetTrapOnViolation(const bool value);
+  /**
+   * @brief Enable or disable reporting violations on stderr.
+   * @param[in] value If _false_, violations are only counted, e.g. when measuring
+   * allocations on purpose.
+   */
+  static void SetReportOnViolation(const bool value);
+  /**
+   * @brief Get the total number of heap allocations performed by armed threads.
+   * @return The total number of violations since application start.
+   */
+  static uint64_t ViolationsCount();
+  /**
+   * @brief Check if the guard is compiled in.
+   * @return _True_ if the allocator is interposed, _false_ otherwise.
+   */
+  static constexpr bool Enabled() { return true; }
+#else
+  static void Arm() {}
+  static void Disarm() {}
+  static bool IsArmed() { return false; }
+  static void SetTrapOnViolation(const bool) {}
+  static void SetReportOnViolation(const bool) {}
+  static uint64_t ViolationsCount() { return 0; }
+  static constexpr bool Enabled() { return false; }
+#endif
+};
+
+#endif // CABLE_ROBOT_RT_ALLOC_GUARD_H
@@ -0,0 +1,131 @@
+/**
+ * @file rt_profile.h
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing the hardening profile of the real time thread, i.e. CPU
+ * isolation, scheduling, memory locking and prefaulting, and its check against the
+ * system.
+ */
+
+#ifndef CABLE_ROBOT_RT_PROFILE_H
+#define CABLE_ROBOT_RT_PROFILE_H
+
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Scheduling policies of the real time thread.
+ */
+enum RtSchedPolicy : uint8_t
+{
+  RT_SCHED_UNCHANGED, /**< Keep the one set by whoever started the thread. */
+  RT_SCHED_FIFO,      /**< SCHED_FIFO, with given priority. */
+  RT_SCHED_RR,        /**< SCHED_RR, with given priority. */
+  RT_SCHED_OTHER      /**< SCHED_OTHER, i.e. no real time scheduling. */
+};
+
+/**
+ * @brief The hardening profile of the real time thread, so that its cycle stays
+ * deterministic.
+ *
+ * Default values leave everything as it is, i.e. as set by the EtherCAT master.
+ */
+struct RtProfile
+{
+  /** CPUs of the real time thread, any if empty. */
+  std::vector<int> rt_cpus;
+  /** Scheduling policy of the real time thread. */
+  RtSchedPolicy sched_policy = RT_SCHED_UNCHANGED;
+  /** Scheduling priority of the real time thread, if FIFO or RR. */
+  int sched_priority = 0;
+  /** Lock all current and future memory of the process. */
+  bool lock_memory = false;
+  /** [bytes] Stack of the real time thread to be prefaulted. */
+  size_t prefault_stack_size = 0;
+  /** [bytes] Heap to be prefaulted and kept in the process. */
+  size_t prefault_heap_size = 0;
+  /** CPUs of the data logging thread, any if empty. */
+  std::vector<int> log_cpus;
+  /**
+   * CPUs of the GUI thread, any if empty. Since threads inherit the CPUs of the thread
+   * which starts them, any other thread left to any CPU is then explicitly given back
+   * the CPUs the process started on.
+   */
+  std::vector<int> gui_cpus;
+};
+
+/**
+ * @brief Parse a list of CPUs in the format of Linux _sysfs_ and _isolcpus_, e.g.
+ * _"0-2,5"_.
+ * @param[in] list The list to be parsed, possibly ending with a newline.
+ * @param[out] cpus Parsed CPUs, in ascending order with no duplicates.
+ * @return _True_ if the list is valid, _false_ otherwise.
+ */
+bool ParseCpuList(const std::string& list, std::vector<int>* cpus);
+/**
+ * @brief Format a list of CPUs in the format of Linux _sysfs_, e.g. _"0-2,5"_.
+ * @param[in] cpus CPUs to be formatted, in ascending order with no duplicates.
+ * @return The formatted list.
+ */
+std::string FormatCpuList(const std::vector<int>& cpus);
+
+/**
+ * @brief Restrict a thread to a set of CPUs.
+ * @param[in] thread The thread to be restricted.
+ * @param[in] cpus CPUs the thread may run on.
+ * @return _True_ if successful, _false_ otherwise.
+ */
+bool SetThreadCpus(const pthread_t thread, const std::vector<int>& cpus);
+/**
+ * @brief Get the set of CPUs a thread may run on.
+ * @param[in] thread The inquired thread.
+ * @param[out] cpus CPUs the thread may run on, in ascending order.
+ * @return _True_ if successful, _false_ otherwise.
+ */
+bool GetThreadCpus(const pthread_t thread, std::vector<int>* cpus);
+/**
+ * @brief Lock all current and future memory of the process, so that it is never paged
+ * out.
+ * @return _True_ if successful, _false_ otherwise, e.g. for lack of privileges.
+ */
+bool LockProcessMemory();
+/**
+ * @brief Prefault a chunk of heap memory and keep it in the process, so that later
+ * allocations do not page fault.
+ * @param[in] size [bytes] Size of the chunk.
+ */
+void PrefaultHeap(const size_t size);
+/**
+ * @brief Apply the real time thread part of a profile, i.e. CPUs, scheduling and stack
+ * prefaulting, to the calling thread.
+ * @param[in] profile The profile to be applied.
+ * @return _True_ if successful, _false_ if any setting could not be applied.
+ * @note This is meant to be called by the real time thread itself, once, before
+ * entering its cycle.
+ */
+bool ApplyRtThreadProfile(const RtProfile& profile);
+
+/**
+ * @brief Describe a profile in a human readable form, to be reported at startup.
+ * @param[in] profile The profile to be described.
+ * @return The description of given profile.
+ */
+std::string RtProfileReport(const RtProfile& profile);
+/**
+ * @brief Check a profile against the running system, as described by Linux _sysfs_.
+ *
+ * Each misconfiguration is flagged, e.g. real time CPUs not isolated from the scheduler,
+ * or shared with other threads, or not running at full speed, as well as missing
+ * privileges to lock memory or set given priority.
+ * @param[in] profile The profile to be checked.
+ * @param[in] sysfs_cpu_dir Directory of CPUs description in _sysfs_.
+ * @return One message per misconfiguration, none if everything is fine.
+ */
+std::vector<std::string>
+CheckRtProfile(const RtProfile& profile,
+               const std::string& sysfs_cpu_dir = "/sys/devices/system/cpu");
+
+#endif // CABLE_ROBOT_RT_PROFILE_H
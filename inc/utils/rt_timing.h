@@ -0,0 +1,357 @@
+/**
+ * @file rt_timing.h
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing low-overhead timing instrumentation of the real-time cycle,
+ * based on lock-free log-linear histograms.
+ */
+
+#ifndef CABLE_ROBOT_RT_TIMING_H
+#define CABLE_ROBOT_RT_TIMING_H
+
+#include <atomic>
+#include <memory>
+#include <ostream>
+#include <stdint.h>
+#include <time.h>
+
+/**
+ * @brief A lock-free log-linear histogram of non-negative integer values, e.g.
+ * durations in nanoseconds.
+ *
+ * Values are binned in power-of-two ranges, each split in kSubBucketsNum linear
+ * sub-buckets, which yields a constant relative resolution (about 6%) over the whole
+ * range with a small, fixed memory footprint and a O(1) record operation.
+ *
+ * @note Only one thread (the writer, typically the real-time one) may call Record() and
+ * ResetNow(), while any number of readers can inspect the histogram concurrently. Reads
+ * are not atomic as a whole, so statistics may be off by the few samples recorded while
+ * reading.
+ */
+class LogLinearHistogram
+{
+ public:
+  static constexpr int kSubBucketBits = 4; /**< log2 of sub-buckets per power of two. */
+  static constexpr int kSubBucketsNum = 1 << kSubBucketBits; /**< Linear sub-buckets. */
+  static constexpr int kMaxValueBits  = 36; /**< Values above 2^36 are saturated. */
+  static constexpr int kBucketsNum =
+    (kMaxValueBits - kSubBucketBits + 1) * kSubBucketsNum; /**< Total buckets. */
+
+  /**
+   * @brief LogLinearHistogram default constructor.
+   */
+  LogLinearHistogram() { ResetNow(); }
+
+  /**
+   * @brief Record a new value.
+   * @param[in] value The value to be recorded.
+   * @note To be called by the writer thread only.
+   */
+  void Record(const uint64_t value);
+  /**
+   * @brief Clear all recorded values.
+   * @note To be called by the writer thread only.
+   */
+  void ResetNow();
+
+  /**
+   * @brief Get the number of recorded values.
+   * @return The number of recorded values.
+   */
+  uint64_t Count() const { return count_.load(std::memory_order_relaxed); }
+  /**
+   * @brief Get the minimum recorded value.
+   * @return The minimum recorded value, or 0 if histogram is empty.
+   */
+  uint64_t Min() const;
+  /**
+   * @brief Get the maximum recorded value.
+   * @return The maximum recorded value, or 0 if histogram is empty.
+   */
+  uint64_t Max() const { return max_.load(std::memory_order_relaxed); }
+  /**
+   * @brief Get the mean of recorded values.
+   * @return The mean of recorded values, or 0 if histogram is empty.
+   */
+  double Mean() const;
+  /**
+   * @brief Get an estimate of the given percentile of recorded values.
+   * @param[in] percentile Percentile in the range [0, 100].
+   * @return The upper bound of the bucket including the given percentile, clamped to
+   * the maximum recorded value.
+   */
+  uint64_t Percentile(const double percentile) const;
+
+  /**
+   * @brief Get the index of the bucket which a value falls into.
+   * @param[in] value The value.
+   * @return The bucket index.
+   */
+  static size_t BucketIndex(const uint64_t value);
+  /**
+   * @brief Get the smallest value falling into given bucket.
+   * @param[in] idx The bucket index.
+   * @return The smallest value falling into the bucket.
+   */
+  static uint64_t BucketLowerBound(const size_t idx);
+  /**
+   * @brief Get the largest value falling into given bucket.
+   * @param[in] idx The bucket index.
+   * @return The largest value falling into the bucket.
+   */
+  static uint64_t BucketUpperBound(const size_t idx);
+
+ private:
+  std::atomic<uint32_t> buckets_[kBucketsNum];
+  std::atomic<uint64_t> count_;
+  std::atomic<uint64_t> sum_;
+  std::atomic<uint64_t> min_;
+  std::atomic<uint64_t> max_;
+};
+
+/**
+ * @brief Timing statistics of the real-time cycle of the cable robot.
+ *
+ * The real-time thread instruments each cycle as follows:
+ * @code
+ * const uint64_t t_begin = stats.BeginCycle();
+ * uint64_t t             = t_begin;
+ * for (size_t i = 0; i < slaves_num; i++)
+ * {
+ *   slave[i]->ReadInputs();
+ *   t = stats.RecordSlave(RtTimingStats::READ_PHASE, i, t);
+ * }
+ * t = stats.RecordPhase(RtTimingStats::READ_PHASE, t_begin);
+ * // ... control and write phases alike ...
+ * stats.EndCycle();
+ * @endcode
+ * Each metric is collected in a LogLinearHistogram together with the cycle index of its
+ * worst case, while slaves costs are tracked as average and maximum values only.
+ *
+ * Wake-up latency is measured with respect to the ideal wake-up schedule t0 + k * period,
+ * where t0 is re-anchored whenever the cycle starts earlier than expected. Hence it is a
+ * relative figure, accurate to the smallest latency observed so far. When a whole period
+ * is lost the schedule is advanced and the miss is counted.
+ *
+ * Any thread can read these statistics at any time without locking or perturbing the
+ * real-time thread. A reset can be requested by any thread too, and it is carried out by
+ * the real-time thread at the beginning of next cycle.
+ */
+class RtTimingStats
+{
+ public:
+  /**
+   * @brief The collected metrics.
+   */
+  enum Metrics : uint8_t
+  {
+    CYCLE_PERIOD,   /**< Time between the beginning of two consecutive cycles. */
+    CYCLE_JITTER,   /**< Absolute deviation of cycle period from nominal one. */
+    WAKEUP_LATENCY, /**< Delay of cycle beginning w.r.t. ideal schedule. */
+    READ_PHASE,     /**< Time spent reading inputs of all slaves. */
+    CONTROL_PHASE,  /**< Time spent processing inputs and computing control actions. */
+    WRITE_PHASE,    /**< Time spent writing outputs to all slaves. */
+    CYCLE_WORK,     /**< Total time spent in the cycle, i.e. the consumed budget. */
+    METRICS_NUM
+  };
+
+  /**
+   * @brief Average and worst-case cost of a single slave read or write operation.
+   */
+  struct SlaveCost
+  {
+    std::atomic<uint64_t> count;  /**< Number of recorded operations. */
+    std::atomic<uint64_t> sum_ns; /**< [nsec] Total time. */
+    std::atomic<uint64_t> max_ns; /**< [nsec] Worst case. */
+  };
+
+  /**
+   * @brief RtTimingStats constructor.
+   * @param[in] period_nsec Nominal cycle period in nanoseconds.
+   * @param[in] slaves_num Number of EtherCAT slaves whose cost is to be tracked.
+   */
+  RtTimingStats(const uint64_t period_nsec = 1000000, const size_t slaves_num = 0);
+
+  /**
+   * @brief Set nominal cycle period and number of tracked slaves, resetting all
+   * statistics.
+   * @param[in] period_nsec Nominal cycle period in nanoseconds.
+   * @param[in] slaves_num Number of EtherCAT slaves whose cost is to be tracked.
+   * @note This operation allocates memory: do not call it while the real-time thread is
+   * running.
+   */
+  void Setup(const uint64_t period_nsec, const size_t slaves_num);
+
+  //--------- Writer side (real-time thread) -----------------------------------------//
+
+  /**
+   * @brief Mark the beginning of a new cycle and record period, jitter and wake-up
+   * latency.
+   * @return Current monotonic time in nanoseconds, to be used to time the first phase.
+   */
+  uint64_t BeginCycle();
+  /**
+   * @brief Record the cost of a single slave operation.
+   * @param[in] phase Either READ_PHASE or WRITE_PHASE.
+   * @param[in] slave_idx The index of the slave in the network.
+   * @param[in] t_start_nsec Time when the operation started.
+   * @return Current monotonic time in nanoseconds, to be used to time next operation.
+   */
+  uint64_t RecordSlave(const Metrics phase, const size_t slave_idx,
+                       const uint64_t t_start_nsec);
+  /**
+   * @brief Record the duration of a cycle phase.
+   * @param[in] phase One of READ_PHASE, CONTROL_PHASE or WRITE_PHASE.
+   * @param[in] t_start_nsec Time when the phase started.
+   * @return Current monotonic time in nanoseconds, to be used to time next phase.
+   */
+  uint64_t RecordPhase(const Metrics phase, const uint64_t t_start_nsec);
+  /**
+   * @brief Mark the end of current cycle and record its total work time.
+   * @return Total work time of current cycle in nanoseconds.
+   */
+  uint64_t EndCycle();
+  /**
+   * @brief Get the number of whole periods lost right before current cycle, as of last
+   * BeginCycle().
+   * @return The number of missed wake-ups right before current cycle.
+   */
+  uint64_t CycleMissedWakeups() const { return cycle_missed_wakeups_; }
+  /**
+   * @brief Forget the cycle schedule, so that next cycle is taken as the first one.
+   *
+   * To be called when the cyclic thread is (re)started or was held up on purpose, so
+   * that this gap is not accounted as jitter or missed wake-ups.
+   */
+  void RestartSchedule();
+
+  //--------- Reader side (any thread) -----------------------------------------------//
+
+  /**
+   * @brief Request a reset of all statistics, carried out at the beginning of next cycle.
+   */
+  void RequestReset() { reset_requested_.store(true, std::memory_order_relaxed); }
+
+  /**
+   * @brief Get the histogram of given metric.
+   * @param[in] metric The inquired metric.
+   * @return A const reference to the histogram of given metric.
+   */
+  const LogLinearHistogram& Histogram(const Metrics metric) const
+  {
+    return histograms_[metric];
+  }
+  /**
+   * @brief Get the index of the cycle where the worst case of given metric occurred.
+   * @param[in] metric The inquired metric.
+   * @return The cycle index of the worst case of given metric.
+   */
+  uint64_t WorstCaseCycle(const Metrics metric) const
+  {
+    return worst_cycles_[metric].load(std::memory_order_relaxed);
+  }
+  /**
+   * @brief Get the cost of read or write operations on a given slave.
+   * @param[in] phase Either READ_PHASE or WRITE_PHASE.
+   * @param[in] slave_idx The index of the slave in the network.
+   * @return A const reference to the inquired slave cost.
+   */
+  const SlaveCost& GetSlaveCost(const Metrics phase, const size_t slave_idx) const;
+  /**
+   * @brief Get the number of tracked slaves.
+   * @return The number of tracked slaves.
+   */
+  size_t SlavesNum() const { return slaves_num_; }
+  /**
+   * @brief Get the nominal cycle period.
+   * @return The nominal cycle period in nanoseconds.
+   */
+  uint64_t PeriodNsec() const { return period_nsec_; }
+  /**
+   * @brief Get the number of cycles since last reset.
+   * @return The number of cycles since last reset.
+   */
+  uint64_t CyclesCount() const { return cycles_count_.load(std::memory_order_relaxed); }
+  /**
+   * @brief Get the number of cycles whose work time exceeded the nominal period.
+   * @return The number of overrun cycles since last reset.
+   */
+  uint64_t OverrunsCount() const
+  {
+    return overruns_count_.load(std::memory_order_relaxed);
+  }
+  /**
+   * @brief Get the number of whole periods lost between two consecutive cycles.
+   * @return The number of missed wake-ups since last reset.
+   */
+  uint64_t MissedWakeupsCount() const
+  {
+    return missed_wakeups_count_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Print a human readable report of all statistics.
+   * @param[out] stream The output stream, e.g. std::cout.
+   */
+  void Dump(std::ostream& stream) const;
+
+  /**
+   * @brief Get the name of given metric.
+   * @param[in] metric The metric.
+   * @return The name of the metric.
+   */
+  static const char* MetricName(const Metrics metric);
+
+  /**
+   * @brief Get current monotonic time.
+   * @return Current monotonic time in nanoseconds.
+   */
+  static uint64_t NowNsec()
+  {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL +
+           static_cast<uint64_t>(ts.tv_nsec);
+  }
+
+  /**
+   * @brief Request a dump of the statistics from outside the application, e.g. from a
+   * signal handler. It is async-signal-safe.
+   */
+  static void RequestDump() { dump_requested_.store(true, std::memory_order_relaxed); }
+  /**
+   * @brief Check and clear an external dump request.
+   * @return _True_ if a dump was requested since last call, _false_ otherwise.
+   */
+  static bool TakeDumpRequest()
+  {
+    return dump_requested_.exchange(false, std::memory_order_relaxed);
+  }
+
+ private:
+  static std::atomic<bool> dump_requested_;
+
+  uint64_t period_nsec_;
+  size_t slaves_num_;
+
+  LogLinearHistogram histograms_[METRICS_NUM];
+  std::atomic<uint64_t> worst_cycles_[METRICS_NUM];
+  std::unique_ptr<SlaveCost[]> slaves_read_cost_;
+  std::unique_ptr<SlaveCost[]> slaves_write_cost_;
+
+  std::atomic<uint64_t> cycles_count_;
+  std::atomic<uint64_t> overruns_count_;
+  std::atomic<uint64_t> missed_wakeups_count_;
+  std::atomic<bool> reset_requested_;
+
+  // Writer-only state
+  uint64_t cycle_start_nsec_;
+  uint64_t prev_cycle_start_nsec_;
+  uint64_t expected_wakeup_nsec_;
+  uint64_t cycle_missed_wakeups_;
+
+  void Record(const Metrics metric, const uint64_t value_nsec);
+  void ResetNow();
+};
+
+#endif // CABLE_ROBOT_RT_TIMING_H
@@ -0,0 +1,120 @@
+/**
+ * @file seqlock.h
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing a sequence lock to publish versioned snapshots from a single
+ * writer (typically the real-time thread) to any number of non-blocking readers.
+ */
+
+#ifndef CABLE_ROBOT_SEQLOCK_H
+#define CABLE_ROBOT_SEQLOCK_H
+
+#include <atomic>
+#include <stdint.h>
+
+/**
+ * @brief A single-writer, multiple-readers sequence lock protecting a snapshot of type T.
+ *
+ * The writer never blocks: it increments the sequence number to an odd value, updates
+ * the payload in place and increments it again to an even value. Readers never block the
+ * writer either: they copy what they need and retry if the sequence number changed in
+ * the meanwhile, i.e. if they read a torn snapshot.
+ *
+ * Because the payload is updated in place, make sure T does not (re)allocate memory when
+ * written by the real-time thread, e.g. size any container member once before publishing.
+ *
+ * @note Only one writer thread is allowed. Readers must only copy data inside their
+ * callback, since the payload may change under their feet until the version is checked.
+ */
+template <typename T>
+class SeqLock
+{
+ public:
+  /**
+   * @brief SeqLock default constructor.
+   */
+  SeqLock() : seq_(0) {}
+  /**
+   * @brief SeqLock constructor with initial payload.
+   * @param[in] init Initial snapshot.
+   */
+  explicit SeqLock(const T& init) : seq_(0), data_(init) {}
+
+  /**
+   * @brief Get a reference to the payload to initialize it before publishing starts.
+   * @return A reference to the payload.
+   * @warning Not thread-safe, use it only before the writer thread is started.
+   */
+  T& Unsafe() { return data_; }
+
+  /**
+   * @brief Update the payload in place and publish a new version.
+   * @param[in] writer Callable with signature void(T&) which updates the snapshot.
+   * @note To be called by the writer thread only.
+   */
+  template <class Writer>
+  void Write(Writer writer)
+  {
+    const uint64_t seq = seq_.load(std::memory_order_relaxed);
+    seq_.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    writer(data_);
+    seq_.store(seq + 2, std::memory_order_release);
+  }
+
+  /**
+   * @brief Publish a new snapshot by copy.
+   * @param[in] value New snapshot.
+   * @note To be called by the writer thread only.
+   */
+  void Store(const T& value)
+  {
+    Write([&value](T& data) { data = value; });
+  }
+
+  /**
+   * @brief Read a consistent view of the latest published snapshot.
+   * @param[in] reader Callable with signature void(const T&) copying the needed data.
+   * It may be invoked more than once if the writer interferes.
+   * @return The version of the snapshot that was read, i.e. the number of publications
+   * so far.
+   */
+  template <class Reader>
+  uint64_t Read(Reader reader) const
+  {
+    uint64_t seq0, seq1;
+    do
+    {
+      do
+      {
+        seq0 = seq_.load(std::memory_order_acquire);
+      } while (seq0 & 1);
+      reader(static_cast<const T&>(data_));
+      std::atomic_thread_fence(std::memory_order_acquire);
+      seq1 = seq_.load(std::memory_order_relaxed);
+    } while (seq0 != seq1);
+    return seq0 >> 1;
+  }
+
+  /**
+   * @brief Copy the latest published snapshot.
+   * @param[out] value Destination snapshot.
+   * @return The version of the snapshot that was read.
+   */
+  uint64_t Load(T* value) const
+  {
+    return Read([value](const T& data) { *value = data; });
+  }
+
+  /**
+   * @brief Get the version of the latest published snapshot.
+   * @return The number of publications so far.
+   */
+  uint64_t Version() const { return seq_.load(std::memory_order_acquire) >> 1; }
+
+ private:
+  std::atomic<uint64_t> seq_;
+  T data_;
+};
+
+#endif // CABLE_ROBOT_SEQLOCK_H
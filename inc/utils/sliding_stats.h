@@ -0,0 +1,109 @@
+/**
+ * @file sliding_stats.h
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing streaming statistics of a signal over a sliding window.
+ */
+
+#ifndef CABLE_ROBOT_SLIDING_STATS_H
+#define CABLE_ROBOT_SLIDING_STATS_H
+
+#include <stddef.h>
+#include <vector>
+
+/**
+ * @brief Streaming statistics of a signal over a sliding window of its latest samples.
+ *
+ * Mean and variance are updated with Welford's algorithm, extended to remove the oldest
+ * sample once the window is full, while the least-squares slope of the samples versus
+ * their position in the window is updated from running sums. Hence each new sample costs
+ * constant time, regardless of window size, and no statistic ever requires a pass over
+ * the window.
+ *
+ * To prevent round-off errors from accumulating on long signals, all statistics are
+ * recomputed from scratch once every window length samples, which keeps the amortized
+ * cost constant.
+ *
+ * Memory is allocated once at construction, so that adding samples never allocates.
+ */
+class SlidingWindowStats
+{
+ public:
+  /**
+   * @brief SlidingWindowStats constructor.
+   * @param[in] window_size Maximum number of latest samples statistics refer to. It
+   * must be at least 2.
+   */
+  explicit SlidingWindowStats(const size_t window_size);
+
+  /**
+   * @brief Add a new sample, discarding the oldest one if the window is full.
+   * @param[in] value The new sample.
+   */
+  void Add(const double value);
+  /**
+   * @brief Discard all samples.
+   */
+  void Reset();
+
+  /**
+   * @brief Get the maximum number of samples in the window.
+   * @return The maximum number of samples in the window.
+   */
+  size_t WindowSize() const { return window_.size(); }
+  /**
+   * @brief Get the number of samples currently in the window.
+   * @return The number of samples currently in the window.
+   */
+  size_t Size() const { return size_; }
+  /**
+   * @brief Check if the window is full.
+   * @return _True_ if the window is full, _false_ otherwise.
+   */
+  bool IsFull() const { return size_ == window_.size(); }
+
+  /**
+   * @brief Get the mean of the samples in the window.
+   * @return The mean of the samples in the window, or 0 if there is none.
+   */
+  double Mean() const { return mean_; }
+  /**
+   * @brief Get the (unbiased) variance of the samples in the window.
+   * @return The variance of the samples in the window, or 0 if there are less than 2.
+   */
+  double Variance() const;
+  /**
+   * @brief Get the standard deviation of the samples in the window.
+   * @return The standard deviation of the samples in the window.
+   * @see Variance()
+   */
+  double Std() const;
+  /**
+   * @brief Get the trend of the samples in the window, i.e. the slope of their
+   * least-squares line versus their position in the window.
+   * @return The change of the signal per sample, or 0 if there are less than 2.
+   */
+  double Slope() const;
+  /**
+   * @brief Get the drift of the signal over the window, i.e. the change of its
+   * least-squares line from the oldest to the newest sample.
+   * @return The drift of the signal over the window.
+   * @see Slope()
+   */
+  double Drift() const;
+
+ private:
+  std::vector<double> window_;
+  size_t head_              = 0; // position of the oldest sample
+  size_t size_              = 0;
+  size_t adds_since_update_ = 0;
+
+  double mean_  = 0.0;
+  double m2_    = 0.0; // sum of squared deviations from mean
+  double sum_   = 0.0; // sum of samples
+  double sum_x_ = 0.0; // sum of samples times their position in the window
+
+  void Recompute();
+};
+
+#endif // CABLE_ROBOT_SLIDING_STATS_H
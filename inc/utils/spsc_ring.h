@@ -0,0 +1,244 @@
+/**
+ * @file spsc_ring.h
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing a wait-free single-producer/single-consumer ring buffer of
+ * fixed-size slots, with configurable overflow policy.
+ */
+
+#ifndef CABLE_ROBOT_SPSC_RING_H
+#define CABLE_ROBOT_SPSC_RING_H
+
+#include <atomic>
+#include <memory>
+#include <stdint.h>
+#include <thread>
+#include <type_traits>
+
+/**
+ * @brief What the producer does when the ring is full.
+ */
+enum class OverflowPolicy : uint8_t
+{
+  DROP_NEWEST,      /**< Discard the item being pushed (wait-free). */
+  OVERWRITE_OLDEST, /**< Overwrite the oldest unread item (wait-free). */
+  BLOCK             /**< Wait until the consumer frees a slot (not for RT threads!). */
+};
+
+/**
+ * @brief A wait-free single-producer/single-consumer ring buffer of fixed-size slots.
+ *
+ * Items are copied in and out of preallocated slots, so neither side ever allocates
+ * memory nor takes a lock. Each slot is guarded by its own sequence number, like a tiny
+ * SeqLock: this lets the producer overwrite the oldest items without any coordination,
+ * while the consumer detects being lapped and skips the lost items.
+ *
+ * The consumer pops items in batches, to amortize synchronization costs.
+ *
+ * Statistics are kept for monitoring: pushed items, dropped items (either discarded or
+ * overwritten, depending on the overflow policy) and high-water mark, i.e. the maximum
+ * number of items ever queued at once.
+ *
+ * @note T must be trivially copyable. Only one producer thread and one consumer thread
+ * are allowed, while statistics can be read by any thread.
+ */
+template <typename T>
+class SpscRing
+{
+  static_assert(std::is_trivially_copyable<T>::value,
+                "SpscRing items must be trivially copyable");
+
+ public:
+  /**
+   * @brief SpscRing constructor.
+   * @param[in] min_capacity Minimum number of slots, rounded up to a power of 2.
+   * @param[in] policy What the producer does when the ring is full.
+   */
+  explicit SpscRing(const size_t min_capacity,
+                    const OverflowPolicy policy = OverflowPolicy::DROP_NEWEST)
+    : capacity_(RoundUpPow2(min_capacity)), mask_(capacity_ - 1), policy_(policy),
+      slots_(new Slot[capacity_]), head_(0), tail_(0), pushed_(0), discarded_(0),
+      overwritten_(0), high_water_mark_(0)
+  {
+    for (size_t i = 0; i < capacity_; i++)
+      slots_[i].seq.store(0, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Push an item by writing it in place.
+   * @param[in] writer Callable with signature void(T&) filling the slot.
+   * @return _True_ if item was queued, _false_ if it was discarded.
+   * @note To be called by the producer thread only.
+   */
+  template <class Writer>
+  bool Emplace(Writer writer)
+  {
+    const uint64_t head = head_.load(std::memory_order_relaxed);
+    if (policy_ != OverflowPolicy::OVERWRITE_OLDEST)
+    {
+      while (head - tail_.load(std::memory_order_acquire) >= capacity_)
+      {
+        if (policy_ == OverflowPolicy::DROP_NEWEST)
+        {
+          Increment(discarded_);
+          return false;
+        }
+        std::this_thread::yield();
+      }
+    }
+
+    Slot& slot = slots_[head & mask_];
+    slot.seq.store(2 * head + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    writer(slot.item);
+    slot.seq.store(2 * head + 2, std::memory_order_release);
+    head_.store(head + 1, std::memory_order_release);
+
+    Increment(pushed_);
+    const uint64_t queued = head + 1 - tail_.load(std::memory_order_relaxed);
+    if (queued > high_water_mark_.load(std::memory_order_relaxed))
+      high_water_mark_.store(queued < capacity_ ? queued : capacity_,
+                             std::memory_order_relaxed);
+    return true;
+  }
+
+  /**
+   * @brief Push an item by copy.
+   * @param[in] item Item to be queued.
+   * @return _True_ if item was queued, _false_ if it was discarded.
+   * @note To be called by the producer thread only.
+   */
+  bool Push(const T& item)
+  {
+    return Emplace([&item](T& slot_item) { slot_item = item; });
+  }
+
+  /**
+   * @brief Pop a batch of items, oldest first.
+   * @param[out] items Array of at least _max_items_ elements to be filled.
+   * @param[in] max_items Maximum number of items to pop.
+   * @return The number of items popped, 0 if ring is empty.
+   * @note To be called by the consumer thread only.
+   */
+  size_t Pop(T* items, const size_t max_items)
+  {
+    uint64_t tail = tail_.load(std::memory_order_relaxed);
+    size_t count  = 0;
+    while (count < max_items)
+    {
+      const Slot& slot   = slots_[tail & mask_];
+      const uint64_t seq = slot.seq.load(std::memory_order_acquire);
+      if (seq < 2 * tail + 2)
+        break; // not written yet
+      if (seq == 2 * tail + 2)
+      {
+        items[count] = slot.item;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.seq.load(std::memory_order_relaxed) == seq)
+        {
+          count++;
+          tail++;
+          continue;
+        }
+      }
+      // Lapped by the producer: skip to the oldest item which is still available.
+      const uint64_t head     = head_.load(std::memory_order_acquire);
+      const uint64_t new_tail = head - capacity_;
+      overwritten_.fetch_add(new_tail - tail, std::memory_order_relaxed);
+      tail = new_tail;
+    }
+    tail_.store(tail, std::memory_order_release);
+    return count;
+  }
+
+  /**
+   * @brief Get the number of queued items.
+   * @return The number of queued items, approximate if called while either side runs.
+   */
+  size_t Size() const
+  {
+    const uint64_t queued =
+      head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+    return queued < capacity_ ? queued : capacity_;
+  }
+  /**
+   * @brief Check if ring is empty.
+   * @return _True_ if no items are queued, _false_ otherwise.
+   */
+  bool Empty() const { return Size() == 0; }
+  /**
+   * @brief Get the number of slots.
+   * @return The number of slots.
+   */
+  size_t Capacity() const { return capacity_; }
+  /**
+   * @brief Get the overflow policy.
+   * @return The overflow policy.
+   */
+  OverflowPolicy Policy() const { return policy_; }
+
+  /**
+   * @brief Get the number of items pushed so far, including overwritten ones.
+   * @return The number of items pushed so far.
+   */
+  uint64_t PushedCount() const { return pushed_.load(std::memory_order_relaxed); }
+  /**
+   * @brief Get the number of items lost so far, either discarded or overwritten.
+   * @return The number of items lost so far.
+   */
+  uint64_t DroppedCount() const
+  {
+    return discarded_.load(std::memory_order_relaxed) +
+           overwritten_.load(std::memory_order_relaxed);
+  }
+  /**
+   * @brief Get the maximum number of items ever queued at once.
+   * @return The high-water mark.
+   */
+  uint64_t HighWaterMark() const
+  {
+    return high_water_mark_.load(std::memory_order_relaxed);
+  }
+  /**
+   * @brief Reset the high-water mark to the number of items currently queued.
+   * @note Not to be called while the producer is pushing.
+   */
+  void ResetHighWaterMark() { high_water_mark_.store(Size(), std::memory_order_relaxed); }
+
+ private:
+  struct Slot
+  {
+    std::atomic<uint64_t> seq; // 2n+1 while writing n-th item, 2n+2 once written
+    T item;
+  };
+
+  const size_t capacity_;
+  const size_t mask_;
+  const OverflowPolicy policy_;
+  std::unique_ptr<Slot[]> slots_;
+
+  // Keep producer and consumer indices on separate cache lines
+  alignas(64) std::atomic<uint64_t> head_; // written by producer only
+  alignas(64) std::atomic<uint64_t> tail_; // written by consumer only
+
+  alignas(64) std::atomic<uint64_t> pushed_; // written by producer only
+  std::atomic<uint64_t> discarded_;          // written by producer only
+  std::atomic<uint64_t> overwritten_;        // written by consumer only
+  std::atomic<uint64_t> high_water_mark_;    // written by producer only
+
+  static void Increment(std::atomic<uint64_t>& counter)
+  {
+    // Single writer: no need for a read-modify-write instruction
+    counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  }
+
+  static size_t RoundUpPow2(const size_t value)
+  {
+    size_t pow2 = 1;
+    while (pow2 < value)
+      pow2 <<= 1;
+    return pow2;
+  }
+};
+
+#endif // CABLE_ROBOT_SPSC_RING_H
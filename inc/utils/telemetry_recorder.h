@@ -0,0 +1,148 @@
+/**
+ * @file telemetry_recorder.h
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing a recorder of continuous real-time telemetry onto binary data
+ * log files.
+ */
+
+#ifndef CABLE_ROBOT_TELEMETRY_RECORDER_H
+#define CABLE_ROBOT_TELEMETRY_RECORDER_H
+
+#include <QThread>
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "utils/binary_log.h"
+#include "utils/consumer_wakeup.h"
+#include "utils/msgs.h"
+#include "utils/spsc_ring.h"
+
+/**
+ * @brief A recorder of continuous real-time telemetry onto binary data log files.
+ *
+ * The real time thread records a telemetry sample per active actuator and the estimated
+ * platform pose at every cycle, which are copied into preallocated wait-free rings (see
+ * SpscRing) and streamed onto a binary data log file (see binary_log.h) by the recorder
+ * own thread, in big batches. The recorder thread sleeps until a full batch is queued or
+ * a timeout expires, so that it neither polls nor wakes up at every real time cycle.
+ * Recording neither locks nor allocates memory on the real time side, and memory usage
+ * is constant regardless of recording duration. Telemetry and pose samples are merged
+ * by timestamp on their way to file, so that records are in time order.
+ * If the disk cannot keep up for longer than the ring can absorb, newest samples are
+ * dropped and counted, see GetStats().
+ *
+ * Recorded files can be converted to CSV text with _tools/binlog2csv_.
+ * @note Only one producer thread at a time is allowed, i.e. the real time thread.
+ */
+class TelemetryRecorder: public QThread
+{
+  Q_OBJECT
+ public:
+  /**
+   * @brief Statistics of current or latest recording session.
+   */
+  struct Stats
+  {
+    size_t capacity;          /**< Number of samples each buffer can hold. */
+    uint64_t recorded;        /**< Number of samples recorded so far. */
+    uint64_t dropped;         /**< Number of samples dropped so far. */
+    uint64_t high_water_mark; /**< Maximum number of samples ever queued in a buffer. */
+  };
+
+  /**
+   * @brief TelemetryRecorder constructor.
+   * @param[in] buffer_size Minimum size of each buffer, i.e. maximum queued samples
+   * number per message type, rounded up to a power of 2.
+   */
+  explicit TelemetryRecorder(const size_t buffer_size = 1 << 15);
+  ~TelemetryRecorder() override;
+
+  /**
+   * @brief Restrict the recorder thread to a set of CPUs.
+   * @param[in] cpus CPUs the recorder thread may run on, the ones inherited from the
+   * thread which starts it if empty.
+   * @note To be called before starting a recording session.
+   */
+  void SetCpus(const std::vector<int>& cpus) { cpus_ = cpus; }
+
+  /**
+   * @brief Start a new recording session.
+   * @param[in] filename Path of the binary data log file, overwritten if existing.
+   * @return _True_ if recording started, _false_ if already recording or if file could
+   * not be open.
+   */
+  bool Start(const std::string& filename);
+  /**
+   * @brief Stop current recording session, if any.
+   *
+   * All samples already queued are written onto file before returning.
+   */
+  void Stop();
+  /**
+   * @brief Check if a recording session is active.
+   * @return _True_ if a recording session is active, _false_ otherwise.
+   */
+  bool IsRecording() const { return recording_.load(std::memory_order_acquire); }
+  /**
+   * @brief Get statistics of current or latest recording session.
+   * @return Statistics of current or latest recording session.
+   */
+  Stats GetStats() const;
+
+  /**
+   * @brief Record a telemetry sample, if a recording session is active.
+   * @param[in] msg Telemetry sample to be recorded.
+   * @return _True_ if sample was queued, _false_ if not recording or if buffer is full.
+   * @note Wait-free and allocation-free, to be called by the real time thread.
+   */
+  bool Record(const ActuatorTelemetryMsg& msg)
+  {
+    if (!IsRecording() || !buffer_.Push(msg))
+      return false;
+    if (buffer_.Size() >= kBatchSize_)
+      wakeup_.Notify();
+    return true;
+  }
+  /**
+   * @brief Record a platform pose sample, if a recording session is active.
+   * @param[in] msg Platform pose sample to be recorded.
+   * @return _True_ if sample was queued, _false_ if not recording or if buffer is full.
+   * @note Wait-free and allocation-free, to be called by the real time thread.
+   */
+  bool Record(const PlatformPoseMsg& msg)
+  {
+    if (!IsRecording() || !pose_buffer_.Push(msg))
+      return false;
+    if (pose_buffer_.Size() >= kBatchSize_)
+      wakeup_.Notify();
+    return true;
+  }
+
+ private:
+  static constexpr size_t kBatchSize_   = 256; // [samples] drained at once
+  static constexpr long kIdleWaitMsec_ = 100; // [msec] max wait for a full batch
+
+  std::atomic<bool> recording_;
+  std::atomic<bool> stop_requested_;
+  SpscRing<ActuatorTelemetryMsg> buffer_;
+  ActuatorTelemetryMsg batch_[kBatchSize_];
+  size_t batch_size_ = 0; // popped samples
+  size_t batch_pos_  = 0; // next sample to be written
+  SpscRing<PlatformPoseMsg> pose_buffer_;
+  PlatformPoseMsg pose_batch_[kBatchSize_];
+  size_t pose_batch_size_ = 0;
+  size_t pose_batch_pos_  = 0;
+  ConsumerWakeup wakeup_;
+  BinaryLogWriter writer_;
+  std::vector<int> cpus_;
+  uint64_t pushed_at_start_  = 0;
+  uint64_t dropped_at_start_ = 0;
+
+  void run() override;
+  void WriteMerged();
+};
+
+#endif // CABLE_ROBOT_TELEMETRY_RECORDER_H
@@ -12,6 +12,7 @@
 #include <cmath>
 #include <stdint.h>
 #include <stdlib.h>
+#include <vector>
 
 #include "libgrabec/inc/slaves/goldsolowhistledrive.h"
 
@@ -156,4 +157,96 @@ struct ActuatorStatus: WinchStatus
   double pulley_angle; /**< [rad] */
 };
 
+/**
+ * @brief A structure including an actuator telemetry sample, i.e. its status and the
+ * control action applied to it at a given real-time cycle.
+ */
+struct ActuatorTelemetry
+{
+  /**
+   * @brief ActuatorTelemetry default constructor.
+   */
+  ActuatorTelemetry() : ctrl_mode(0), setpoint(0.0) {}
+  /**
+   * @brief ActuatorTelemetry full constructor.
+   * @param[in] _status Actuator status.
+   * @param[in] _ctrl_mode Control mode of applied control action, see ControlMode.
+   * @param[in] _setpoint Set point of applied control action, in control mode units.
+   */
+  ActuatorTelemetry(const ActuatorStatus& _status, const uint8_t _ctrl_mode,
+                    const double _setpoint)
+    : status(_status), ctrl_mode(_ctrl_mode), setpoint(_setpoint)
+  {}
+
+  ActuatorStatus status; /**< Actuator status. */
+  uint8_t ctrl_mode;     /**< see ControlMode, NONE if no action was applied. */
+  double setpoint;       /**< Set point, in units of _ctrl_mode_. */
+};
+
+/**
+ * @brief A structure including the platform pose estimated by forward kinematics at a
+ * given real-time cycle, with the quality of the estimate.
+ */
+struct PlatformPose
+{
+  /**
+   * @brief PlatformPose default constructor.
+   */
+  PlatformPose()
+    : position_x(0.0), position_y(0.0), position_z(0.0), angle_x(0.0), angle_y(0.0),
+      angle_z(0.0), residual_norm(0.0), iterations(0), converged(0)
+  {}
+
+  double position_x;    /**< [m] Platform origin position along global X axis. */
+  double position_y;    /**< [m] Platform origin position along global Y axis. */
+  double position_z;    /**< [m] Platform origin position along global Z axis. */
+  double angle_x;       /**< [rad] Tait-Bryan rotation about X axis. */
+  double angle_y;       /**< [rad] Tait-Bryan rotation about mobile Y axis. */
+  double angle_z;       /**< [rad] Tait-Bryan rotation about mobile Z axis. */
+  double residual_norm; /**< Norm of weighted residuals of the estimate. */
+  uint8_t iterations;   /**< Iterations spent on the estimate. */
+  uint8_t converged;    /**< 1 if the estimate converged, 0 otherwise. */
+};
+
+/**
+ * @brief A structure including the complete state of an actuator at a given real-time
+ * cycle, both as processed actuator status and as raw drive input PDOs.
+ */
+struct ActuatorFrame
+{
+  ActuatorStatus status;             /**< Processed actuator status. */
+  grabec::GSWDriveInPdos drive_pdos; /**< Raw GoldSoloWhistle drive input PDOs. */
+};
+
+/**
+ * @brief A structure including an actuator status sampled by the real-time thread, at a
+ * given cycle.
+ */
+struct ActuatorSample
+{
+  /**
+   * @brief ActuatorSample default constructor.
+   */
+  ActuatorSample() : timestamp(-1.0) {}
+
+  double timestamp;      /**< [sec] Elapsed time at sampling. */
+  ActuatorStatus status; /**< Actuator status. */
+};
+
+/**
+ * @brief A structure including the state of all active actuators, as published once per
+ * cycle by the real-time thread.
+ */
+struct ActuatorsSnapshot
+{
+  /**
+   * @brief ActuatorsSnapshot default constructor.
+   */
+  ActuatorsSnapshot() : cycle(0), timestamp(-1.0) {}
+
+  uint64_t cycle;                       /**< Real-time cycle counter. */
+  double timestamp;                     /**< [sec] Elapsed time at publication. */
+  std::vector<ActuatorFrame> actuators; /**< Active actuators frames, same order. */
+};
+
 #endif // CABLE_ROBOT_TYPES_H
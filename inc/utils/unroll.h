@@ -0,0 +1,53 @@
+/**
+ * @file unroll.h
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing a compile-time loop unroller.
+ */
+
+#ifndef CABLE_ROBOT_UNROLL_H
+#define CABLE_ROBOT_UNROLL_H
+
+#include <stddef.h>
+
+/**
+ * @brief A compile-time loop unroller, calling a function once per index from 0 to N-1.
+ *
+ * This is equivalent to
+ * @code
+ * for (size_t i = 0; i < N; i++)
+ *   fun(i);
+ * @endcode
+ * except that the loop is expanded by the compiler into N consecutive calls with constant
+ * indices, with no counter nor branches left, so that each call can be inlined and
+ * optimized on its own. Use it only for short loops whose trip count is known at compile
+ * time.
+ * @tparam N Number of iterations.
+ */
+template <size_t N>
+struct Unroll
+{
+  /**
+   * @brief Call a function once per index, in increasing order.
+   * @param[in] fun The function to be called, taking the index as only argument.
+   */
+  template <class Fun>
+  static inline void Run(const Fun& fun)
+  {
+    Unroll<N - 1>::Run(fun);
+    fun(N - 1);
+  }
+};
+
+/**
+ * @brief Compile-time loop unroller with no iterations, i.e. the end of the recursion.
+ */
+template <>
+struct Unroll<0>
+{
+  template <class Fun>
+  static inline void Run(const Fun&)
+  {}
+};
+
+#endif // CABLE_ROBOT_UNROLL_H
@@ -0,0 +1,115 @@
+/**
+ * @file wire_layout.h
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing the compile-time wire layout of loggable messages, i.e. how
+ * they are serialized into and deserialized from raw memory buffers.
+ *
+ * Values are packed one after the other in little-endian byte order, without any
+ * padding. Layouts of message bodies are generated from their ordered field list by
+ * MSG_FIELDS_ORDER_DEFINE, so that each message wire size is a compile-time constant
+ * and serialization boils down to plain stores into a caller-provided buffer.
+ */
+
+#ifndef CABLE_ROBOT_WIRE_LAYOUT_H
+#define CABLE_ROBOT_WIRE_LAYOUT_H
+
+#include <cstring>
+#include <stddef.h>
+#include <stdint.h>
+#include <type_traits>
+
+/**
+ * @brief The wire layout of a type.
+ *
+ * Each specialization provides:
+ * - `static constexpr size_t kSize`, the serialized size in bytes;
+ * - `static char* Write(char* buffer, const T& value)`, returning the end of written
+ *   data;
+ * - `static const char* Read(const char* buffer, T* value)`, returning the end of read
+ *   data.
+ *
+ * Arithmetic and enum types are specialized here, while message bodies are specialized
+ * by MSG_FIELDS_ORDER_DEFINE.
+ */
+template <typename T, class Enable = void> struct WireLayout;
+
+/** @cond DO_NOT_DOCUMENT */
+template <typename T>
+struct WireLayout<T, typename std::enable_if<std::is_arithmetic<T>::value ||
+                                             std::is_enum<T>::value>::type>
+{
+  static constexpr size_t kSize = sizeof(T);
+
+  static char* Write(char* buffer, const T& value)
+  {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    memcpy(buffer, &value, sizeof(T));
+#else
+    unsigned char bytes[sizeof(T)];
+    memcpy(bytes, &value, sizeof(T));
+    for (size_t i = 0; i < sizeof(T); i++)
+      buffer[i] = static_cast<char>(bytes[sizeof(T) - 1 - i]);
+#endif
+    return buffer + sizeof(T);
+  }
+
+  static const char* Read(const char* buffer, T* value)
+  {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    memcpy(value, buffer, sizeof(T));
+#else
+    unsigned char bytes[sizeof(T)];
+    for (size_t i = 0; i < sizeof(T); i++)
+      bytes[i] = static_cast<unsigned char>(buffer[sizeof(T) - 1 - i]);
+    memcpy(value, bytes, sizeof(T));
+#endif
+    return buffer + sizeof(T);
+  }
+};
+/** @endcond */
+
+/**
+ * @brief Get the serialized size of a type.
+ * @return The serialized size of given type in bytes.
+ */
+template <typename T> constexpr size_t WireSize() { return WireLayout<T>::kSize; }
+
+/**
+ * @brief Serialize a value into a raw memory buffer.
+ * @param[out] buffer Memory where the value is written, at least WireSize<T>() long.
+ * @param[in] value Value to be serialized.
+ * @return A pointer to the end of written data.
+ */
+template <typename T> inline char* WireWrite(char* buffer, const T& value)
+{
+  return WireLayout<T>::Write(buffer, value);
+}
+
+/**
+ * @brief Deserialize a value from a raw memory buffer.
+ * @param[in] buffer Memory where the value is read, at least WireSize<T>() long.
+ * @param[out] value Value to be filled.
+ * @return A pointer to the end of read data.
+ */
+template <typename T> inline const char* WireRead(const char* buffer, T* value)
+{
+  return WireLayout<T>::Read(buffer, value);
+}
+
+/**
+ * @brief Get the maximum among a list of sizes at compile time.
+ * @param[in] size First size.
+ * @param[in] sizes Other sizes.
+ * @return The maximum among given sizes.
+ */
+constexpr size_t MaxWireSize(const size_t size) { return size; }
+/** @cond DO_NOT_DOCUMENT */
+template <typename... Sizes>
+constexpr size_t MaxWireSize(const size_t size, const Sizes... sizes)
+{
+  return size > MaxWireSize(sizes...) ? size : MaxWireSize(sizes...);
+}
+/** @endcond */
+
+#endif // CABLE_ROBOT_WIRE_LAYOUT_H
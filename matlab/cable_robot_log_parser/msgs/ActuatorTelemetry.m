@@ -0,0 +1,59 @@
+classdef ActuatorTelemetry < handle
+    properties
+        id
+        op_mode
+        motor_position
+        motor_speed
+        motor_torque
+        cable_length
+        aux_position
+        state
+        pulley_angle
+        ctrl_mode
+        setpoint
+    end
+    
+    methods
+        function set(obj, actuator_telemetry_packed)
+            obj.id = actuator_telemetry_packed(1);
+            obj.op_mode = actuator_telemetry_packed(2);
+            obj.motor_position = actuator_telemetry_packed(3);
+            obj.motor_speed = actuator_telemetry_packed(4);
+            obj.motor_torque = actuator_telemetry_packed(5);
+            obj.cable_length = actuator_telemetry_packed(6);
+            obj.aux_position = actuator_telemetry_packed(7);
+            obj.state = actuator_telemetry_packed(8);
+            obj.pulley_angle = actuator_telemetry_packed(9);
+            obj.ctrl_mode = actuator_telemetry_packed(10);
+            obj.setpoint = actuator_telemetry_packed(11);
+        end
+        
+        function append(obj, actuator_telemetry_packed)
+            obj.id(end + 1) = actuator_telemetry_packed(1);
+            obj.op_mode(end + 1) = actuator_telemetry_packed(2);
+            obj.motor_position(end + 1) = actuator_telemetry_packed(3);
+            obj.motor_speed(end + 1) = actuator_telemetry_packed(4);
+            obj.motor_torque(end + 1) = actuator_telemetry_packed(5);
+            obj.cable_length(end + 1) = actuator_telemetry_packed(6);
+            obj.aux_position(end + 1) = actuator_telemetry_packed(7);
+            obj.state(end + 1) = actuator_telemetry_packed(8);
+            obj.pulley_angle(end + 1) = actuator_telemetry_packed(9);
+            obj.ctrl_mode(end + 1) = actuator_telemetry_packed(10);
+            obj.setpoint(end + 1) = actuator_telemetry_packed(11);
+        end        
+        
+        function clear(obj)
+            obj.id = [];
+            obj.op_mode = [];
+            obj.motor_position = [];
+            obj.motor_speed = [];
+            obj.motor_torque = [];
+            obj.cable_length = [];
+            obj.aux_position = [];
+            obj.state = [];
+            obj.pulley_angle = [];
+            obj.ctrl_mode = [];
+            obj.setpoint = [];
+        end
+    end
+end
@@ -7,5 +7,7 @@ classdef CableRobotMsgs < uint32
         MOTOR_STATUS(1)
         WINCH_STATUS(2)
         ACTUATOR_STATUS(3)
+        ACTUATOR_TELEMETRY(4)
+        PLATFORM_POSE(5)
     end
 end
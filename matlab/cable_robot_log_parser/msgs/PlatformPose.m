@@ -0,0 +1,51 @@
+classdef PlatformPose < handle
+    properties
+        position_x
+        position_y
+        position_z
+        angle_x
+        angle_y
+        angle_z
+        residual_norm
+        iterations
+        converged
+    end
+    
+    methods
+        function set(obj, platform_pose_packed)
+            obj.position_x = platform_pose_packed(1);
+            obj.position_y = platform_pose_packed(2);
+            obj.position_z = platform_pose_packed(3);
+            obj.angle_x = platform_pose_packed(4);
+            obj.angle_y = platform_pose_packed(5);
+            obj.angle_z = platform_pose_packed(6);
+            obj.residual_norm = platform_pose_packed(7);
+            obj.iterations = platform_pose_packed(8);
+            obj.converged = platform_pose_packed(9);
+        end
+        
+        function append(obj, platform_pose_packed)
+            obj.position_x(end + 1) = platform_pose_packed(1);
+            obj.position_y(end + 1) = platform_pose_packed(2);
+            obj.position_z(end + 1) = platform_pose_packed(3);
+            obj.angle_x(end + 1) = platform_pose_packed(4);
+            obj.angle_y(end + 1) = platform_pose_packed(5);
+            obj.angle_z(end + 1) = platform_pose_packed(6);
+            obj.residual_norm(end + 1) = platform_pose_packed(7);
+            obj.iterations(end + 1) = platform_pose_packed(8);
+            obj.converged(end + 1) = platform_pose_packed(9);
+        end        
+        
+        function clear(obj)
+            obj.position_x = [];
+            obj.position_y = [];
+            obj.position_z = [];
+            obj.angle_x = [];
+            obj.angle_y = [];
+            obj.angle_z = [];
+            obj.residual_norm = [];
+            obj.iterations = [];
+            obj.converged = [];
+        end
+    end
+end
@@ -33,6 +33,12 @@ while 1
         case CableRobotMsgs.ACTUATOR_STATUS
             messages.actuator_status.timestamp(end + 1) = split_line(2);
             messages.actuator_status.values.append(split_line(3:end));
+        case CableRobotMsgs.ACTUATOR_TELEMETRY
+            messages.actuator_telemetry.timestamp(end + 1) = split_line(2);
+            messages.actuator_telemetry.values.append(split_line(3:end));
+        case CableRobotMsgs.PLATFORM_POSE
+            messages.platform_pose.timestamp(end + 1) = split_line(2);
+            messages.platform_pose.values.append(split_line(3:end));
         otherwise
             counter_unknown = counter_unknown + 1;
     end    
@@ -84,4 +90,8 @@ function messages = initMessages()
     messages.winch_status = struct('timestamp', [], 'values', WinchStatus);
     messages.actuator_status = struct('timestamp', [], ...
                                       'values', ActuatorStatus);
+    messages.actuator_telemetry = struct('timestamp', [], ...
+                                         'values', ActuatorTelemetry);
+    messages.platform_pose = struct('timestamp', [], ...
+                                    'values', PlatformPose);
 end
@@ -11,9 +11,11 @@ ControllerBase::ControllerBase(const id_t motor_id)
 {
   motors_id_.push_back(motor_id);
   modes_.resize(1, ControlMode::NONE);
+  motors_index_ = IdIndexMap(motors_id_);
 }
 
-ControllerBase::ControllerBase(const vect<id_t>& motors_id) : motors_id_(motors_id)
+ControllerBase::ControllerBase(const vect<id_t>& motors_id)
+  : motors_id_(motors_id), motors_index_(motors_id)
 {
   modes_.resize(motors_id.size(), ControlMode::NONE);
 }
@@ -29,6 +31,7 @@ void ControllerBase::SetMotorID(const id_t motor_id)
 
   motors_id_.push_back(motor_id);
   modes_.resize(1, ControlMode::NONE);
+  motors_index_ = IdIndexMap(motors_id_);
 }
 
 void ControllerBase::SetMotorsID(const vect<id_t>& motors_id)
@@ -38,6 +41,7 @@ void ControllerBase::SetMotorsID(const vect<id_t>& motors_id)
 
   motors_id_ = motors_id;
   modes_.resize(motors_id.size(), ControlMode::NONE);
+  motors_index_ = IdIndexMap(motors_id_);
 }
 
 void ControllerBase::SetMode(const ControlMode mode)
@@ -56,20 +60,104 @@ void ControllerBase::SetMode(const id_t motor_id, const ControlMode mode)
     PrintColor(
       'y',
       "[ControllerBase] WARNING: no motor ID defined: cannot set motor operational mode");
-  for (size_t i = 0; i < motors_id_.size(); i++)
+  const size_t idx = motors_index_.Find(motor_id);
+  if (idx != IdIndexMap::kNotFound)
+    modes_[idx] = mode;
+}
+
+ControlMode ControllerBase::GetMode(const id_t motor_id) const
+{
+  const size_t idx = motors_index_.Find(motor_id);
+  return idx == IdIndexMap::kNotFound ? ControlMode::NONE : modes_[idx];
+}
+
+void ControllerBase::OpenSetpointsStream(const size_t capacity)
+{
+  setpoints_.reset(new SpscRing<Setpoint>(capacity, OverflowPolicy::DROP_NEWEST));
+  next_setpoint_ready_ = false;
+  rejected_setpoints_.store(0, std::memory_order_relaxed);
+}
+
+bool ControllerBase::PushSetpoint(const Setpoint& setpoint)
+{
+  if (!setpoints_)
+    return false;
+  return setpoints_->Push(setpoint);
+}
+
+size_t ControllerBase::ConsumeSetpoints(const double timestamp)
+{
+  return PopDueSetpoints(timestamp, true);
+}
+
+size_t ControllerBase::DiscardSetpoints(const double timestamp)
+{
+  return PopDueSetpoints(timestamp, false);
+}
+
+size_t ControllerBase::PendingSetpoints() const
+{
+  if (!setpoints_)
+    return 0;
+  return setpoints_->Size();
+}
+
+uint64_t ControllerBase::DroppedSetpoints() const
+{
+  if (!setpoints_)
+    return 0;
+  return setpoints_->DroppedCount() + rejected_setpoints_.load(std::memory_order_relaxed);
+}
+
+//--------- Protected functions ------------------------------------------------------//
+
+size_t ControllerBase::FindSlot(const ActuatorsState& actuators_state,
+                                const id_t motor_id) const
+{
+  const vect<id_t>& ids = actuators_state.GetIDs();
+  if (actuators_index_)
   {
-    if (motors_id_[i] == motor_id)
-    {
-      modes_[i] = mode;
-      break;
-    }
+    const size_t idx = actuators_index_->Find(motor_id);
+    if (idx == IdIndexMap::kNotFound)
+      return IdIndexMap::kNotFound;
+    if (idx < ids.size() && ids[idx] == motor_id)
+      return idx;
   }
+  // No index, or actuators state not in index order
+  for (size_t i = 0; i < ids.size(); i++)
+    if (ids[i] == motor_id)
+      return i;
+  return IdIndexMap::kNotFound;
 }
 
-ControlMode ControllerBase::GetMode(const id_t motor_id) const
+bool ControllerBase::ApplySetpoint(const ControlAction&) { return false; }
+
+//--------- Private functions --------------------------------------------------------//
+
+size_t ControllerBase::PopDueSetpoints(const double timestamp, const bool apply)
 {
-  for (size_t i = 0; i < motors_id_.size(); i++)
-    if (motor_id == motors_id_[i])
-      return modes_[i];
-  return ControlMode::NONE;
+  if (!setpoints_)
+    return 0;
+
+  size_t applied_num = 0;
+  size_t lost_num    = 0;
+  while (next_setpoint_ready_ || setpoints_->Pop(&next_setpoint_, 1) > 0)
+  {
+    // Set points are chronological: stop at the first one which is not due yet
+    if (next_setpoint_.timestamp > timestamp)
+    {
+      next_setpoint_ready_ = true;
+      break;
+    }
+    next_setpoint_ready_ = false;
+    if (apply && ApplySetpoint(next_setpoint_.action))
+      applied_num++;
+    else // single writer: no need for a read-modify-write instruction
+    {
+      lost_num++;
+      rejected_setpoints_.store(rejected_setpoints_.load(std::memory_order_relaxed) + 1,
+                                std::memory_order_relaxed);
+    }
+  }
+  return apply ? applied_num : lost_num;
 }
@@ -0,0 +1,148 @@
+/**
+ * @file controller_multidrive.cpp
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing definitions of derived class declared in
+ * controller_multidrive.h.
+ */
+
+#include "ctrl/controller_multidrive.h"
+
+#include <algorithm>
+#include <cmath>
+
+constexpr double ControllerMultiDrive::kAbsMaxLengthSpeed_;
+constexpr double ControllerMultiDrive::kAbsMaxSpeed_;
+constexpr double ControllerMultiDrive::kMinTrajTime_;
+constexpr double ControllerMultiDrive::kPoly5PeakSpeedRatio_;
+
+ControllerMultiDrive::ControllerMultiDrive(const uint32_t period_nsec)
+  : ControllerBase(), period_sec_(period_nsec * 0.000000001), target_mode_(NONE),
+    traj_time_(-1.0), new_trajectory_(false), on_target_(false)
+{}
+
+ControllerMultiDrive::ControllerMultiDrive(const vect<id_t>& motors_id,
+                                           const uint32_t period_nsec)
+  : ControllerBase(motors_id), period_sec_(period_nsec * 0.000000001),
+    target_mode_(NONE), traj_time_(-1.0), new_trajectory_(false), on_target_(false)
+{}
+
+//--------- Public functions ---------------------------------------------------------//
+
+void ControllerMultiDrive::SetCableLensTarget(const vect<double>& targets,
+                                              const double time /*= -1.0*/)
+{
+  SetTargets(CABLE_LENGTH, targets, time);
+}
+
+void ControllerMultiDrive::SetMotorsPosTarget(const vect<int32_t>& targets,
+                                              const double time /*= -1.0*/)
+{
+  SetTargets(MOTOR_POSITION, vect<double>(targets.begin(), targets.end()), time);
+}
+
+void ControllerMultiDrive::OnCyclesSkipped(const uint64_t cycles_num)
+{
+  // A trajectory which did not start yet has no time to catch up with
+  if (target_mode_ != NONE && !new_trajectory_)
+    profile_.Skip(cycles_num);
+}
+
+void ControllerMultiDrive::CalcCtrlActions(const grabcdpr::Vars&,
+                                           const ActuatorsState& actuators_state,
+                                           ControlActions* ctrl_actions)
+{
+  if (target_mode_ == NONE || targets_.size() != motors_id_.size())
+    return;
+  if (new_trajectory_)
+    StartTrajectory(actuators_state);
+
+  // Same normalized profile for all motors, with null initial and final velocity and
+  // acceleration
+  on_target_           = profile_.Done();
+  const double profile = profile_.Step().position;
+
+  for (size_t i = 0; i < motors_id_.size(); i++)
+  {
+    if (modes_[i] != target_mode_)
+      continue;
+    ControlAction res;
+    res.motor_id     = motors_id_[i];
+    res.ctrl_mode    = target_mode_;
+    const double q_t = on_target_ ? targets_[i]
+                                  : initials_[i] + profile * (targets_[i] - initials_[i]);
+    if (target_mode_ == CABLE_LENGTH)
+      res.cable_length = q_t;
+    else
+      res.motor_position = static_cast<int32_t>(round(q_t));
+    ctrl_actions->Push(res);
+  }
+}
+
+//--------- Private functions --------------------------------------------------------//
+
+void ControllerMultiDrive::SetTargets(const ControlMode mode, const vect<double>& targets,
+                                      const double time)
+{
+  if (targets.size() != motors_id_.size())
+  {
+    PrintColor('y', "[ControllerMultiDrive] WARNING: targets number does not match "
+                    "motors number: target ignored");
+    return;
+  }
+  target_mode_    = mode;
+  targets_        = targets;
+  traj_time_      = time;
+  new_trajectory_ = true;
+  on_target_      = false;
+  initials_.resize(targets_.size()); // filled at trajectory start
+  // When duration is known beforehand, precompute trajectory profile here, i.e. outside
+  // of the real time thread
+  if (traj_time_ > 0.0)
+    profile_.Plan(traj_time_, period_sec_, true);
+}
+
+void ControllerMultiDrive::StartTrajectory(const ActuatorsState& actuators_state)
+{
+  double max_delta = 0.0;
+  for (size_t i = 0; i < motors_id_.size(); i++)
+  {
+    const size_t slot = FindSlot(actuators_state, motors_id_[i]);
+    if (slot == IdIndexMap::kNotFound)
+      initials_[i] = targets_[i]; // this is for safety, in case there's no id match
+    else
+      initials_[i] =
+        target_mode_ == CABLE_LENGTH
+          ? actuators_state.GetCableLengths()[slot]
+          : static_cast<double>(actuators_state.GetMotorPositions()[slot]);
+    max_delta = std::max(max_delta, std::abs(targets_[i] - initials_[i]));
+  }
+  // Slowest motor sets the pace of all others
+  if (traj_time_ <= 0.0)
+  {
+    const double max_speed =
+      target_mode_ == CABLE_LENGTH ? kAbsMaxLengthSpeed_ : kAbsMaxSpeed_;
+    traj_time_ = std::max(kMinTrajTime_, kPoly5PeakSpeedRatio_ * max_delta / max_speed);
+    profile_.Plan(traj_time_, period_sec_);
+  }
+  profile_.Start(0.0, 1.0);
+  new_trajectory_ = false;
+}
+
+bool ControllerMultiDrive::ApplySetpoint(const ControlAction& setpoint)
+{
+  // Only motors already targeted in the same control mode can be streamed, since
+  // targets buffers cannot grow in the real time thread
+  if (setpoint.ctrl_mode != target_mode_ || targets_.size() != motors_id_.size())
+    return false;
+  const size_t i = motors_index_.Find(setpoint.motor_id);
+  if (i == IdIndexMap::kNotFound || modes_[i] != target_mode_)
+    return false;
+  // Streamed set points are dense, hence applied directly, with no trajectory
+  const double target = target_mode_ == CABLE_LENGTH
+                          ? setpoint.cable_length
+                          : static_cast<double>(setpoint.motor_position);
+  targets_[i]  = target;
+  initials_[i] = target;
+  return true;
+}
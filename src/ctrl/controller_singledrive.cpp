@@ -49,6 +49,10 @@ void ControllerSingleDrive::SetMotorPosTarget(const int32_t target,
   new_trajectory_   = true;
   apply_trajectory_ = apply_traj;
   target_flags_.Set(POSITION);
+  // When duration is known beforehand, precompute trajectory profile here, i.e. outside
+  // of the real time thread
+  if (apply_trajectory_ && traj_time_ > 0.0)
+    trajectory_.Plan(traj_time_, period_sec_, true);
 }
 
 void ControllerSingleDrive::SetMotorSpeedTarget(const int32_t target)
@@ -99,9 +103,16 @@ void ControllerSingleDrive::MotorTorqueIncrement(const bool active,
     delta_torque_ = sign * abs_delta_torque_;
 }
 
-vect<ControlAction>
-ControllerSingleDrive::CalcCtrlActions(const grabcdpr::Vars&,
-                                       const vect<ActuatorStatus>& actuators_status)
+void ControllerSingleDrive::OnCyclesSkipped(const uint64_t cycles_num)
+{
+  // A trajectory which did not start yet has no time to catch up with
+  if (target_flags_.CheckBit(POSITION) && apply_trajectory_ && !new_trajectory_)
+    trajectory_.Skip(cycles_num);
+}
+
+void ControllerSingleDrive::CalcCtrlActions(const grabcdpr::Vars&,
+                                            const ActuatorsState& actuators_state,
+                                            ControlActions* ctrl_actions)
 {
   ControlAction res;
   if (!modes_.empty())
@@ -123,7 +134,7 @@ ControllerSingleDrive::CalcCtrlActions(const grabcdpr::Vars&,
       break;
     case MOTOR_POSITION:
       if (target_flags_.CheckBit(POSITION))
-        res.motor_position = CalcMotorPos(actuators_status);
+        res.motor_position = CalcMotorPos(actuators_state);
       else
         res.ctrl_mode = NONE;
       break;
@@ -143,7 +154,7 @@ ControllerSingleDrive::CalcCtrlActions(const grabcdpr::Vars&,
           torque_pid_.Reset();
           on_target_ = false;
         }
-        res.motor_torque = CalcMotorTorque(actuators_status);
+        res.motor_torque = CalcMotorTorque(actuators_state);
       }
       else
         res.ctrl_mode = NONE;
@@ -152,46 +163,39 @@ ControllerSingleDrive::CalcCtrlActions(const grabcdpr::Vars&,
       res.ctrl_mode = NONE;
       break;
   }
-  return vect<ControlAction>(1, res);
+  ctrl_actions->Push(res);
 }
 
 //--------- Private functions --------------------------------------------------------//
 
-int32_t ControllerSingleDrive::CalcMotorPos(const vect<ActuatorStatus>& actuators_status)
+int32_t ControllerSingleDrive::CalcMotorPos(const ActuatorsState& actuators_state)
 {
   if (on_target_)
     return pos_target_true_;
 
-  int32_t pos_target =
-    pos_target_true_; // this is for safety, in case there's no id match
-  for (const ActuatorStatus& actuator_status : actuators_status)
-  {
-    if (actuator_status.id != motors_id_[0])
-      continue;
-    pos_target =
-      CalcPoly5Waypoint(actuator_status.motor_position, pos_target_true_, kAbsMaxSpeed_);
-    on_target_ = pos_target == pos_target_true_;
-    break;
-  }
+  const size_t slot = FindSlot(actuators_state, motors_id_[0]);
+  if (slot == IdIndexMap::kNotFound)
+    return pos_target_true_; // this is for safety, in case there's no id match
+  const int32_t pos_target = CalcPoly5Waypoint(actuators_state.GetMotorPositions()[slot],
+                                               pos_target_true_, kAbsMaxSpeed_);
+  on_target_ = pos_target == pos_target_true_;
   return pos_target;
 }
 
-int16_t
-ControllerSingleDrive::CalcMotorTorque(const vect<ActuatorStatus>& actuators_status)
+int16_t ControllerSingleDrive::CalcMotorTorque(const ActuatorsState& actuators_state)
 {
   if (on_target_)
     return torque_target_true_;
 
+  const size_t slot   = FindSlot(actuators_state, motors_id_[0]);
   double motor_torque = torque_target_;
-  for (const ActuatorStatus& actuator_status : actuators_status)
+  if (slot != IdIndexMap::kNotFound)
   {
-    if (actuator_status.id != motors_id_[0])
-      continue;
-    double current_motor_torque = static_cast<double>(actuator_status.motor_torque);
+    double current_motor_torque =
+      static_cast<double>(actuators_state.GetMotorTorques()[slot]);
     motor_torque = torque_pid_.Calculate(torque_target_, current_motor_torque);
     //    printf("%d - %.1f -> %.1f\n", torque_target_true_, current_motor_torque,
     //           motor_torque);
-    break;
   }
   on_target_ = (std::abs(torque_pid_.GetError()) + std::abs(torque_pid_.GetPrevError())) <
                (2 * torque_ss_err_tol_);
@@ -201,31 +205,52 @@ ControllerSingleDrive::CalcMotorTorque(const vect<ActuatorStatus>& actuators_sta
 int32_t ControllerSingleDrive::CalcPoly5Waypoint(const int32_t q, const int32_t q_final,
                                                  const int32_t max_dq)
 {
-  static double a0, a3, a4, a5; // polynomial coefficients for null init/final vel/acc
-  static grabrt::Clock clock;
-
   // Check if a trajectory was requested
   if (!apply_trajectory_)
     return q_final;
 
   if (new_trajectory_)
   {
-    double dq = q_final - q;
     if (traj_time_ <= 0.0)
-      traj_time_ = std::max(1.0, std::abs(dq) / max_dq);
-    a0              = q; // this is q_init for a new trajectory
-    a3              = 20. / (2 * pow(traj_time_, 3.)) * dq;
-    a4              = -30. / (2 * pow(traj_time_, 4.)) * dq;
-    a5              = 12. / (2 * pow(traj_time_, 5.)) * dq;
+    {
+      // Duration depends on current position: profile is evaluated cycle by cycle
+      traj_time_ = std::max(1.0, std::abs(q_final - q) / static_cast<double>(max_dq));
+      trajectory_.Plan(traj_time_, period_sec_);
+    }
+    trajectory_.Start(q, q_final); // q is q_init for a new trajectory
     new_trajectory_ = false;
-    clock.Reset();
   }
 
-  double t = clock.Elapsed();
-  if (t >= traj_time_)
+  if (trajectory_.Done())
     return q_final;
-  double q_t = a0 + a3 * pow(t, 3.) + a4 * pow(t, 4.) + a5 * pow(t, 5.);
-  return static_cast<int32_t>(round(q_t));
+  return static_cast<int32_t>(round(trajectory_.Step().position));
+}
+
+bool ControllerSingleDrive::ApplySetpoint(const ControlAction& setpoint)
+{
+  if (modes_.empty() || setpoint.motor_id != motors_id_[0] ||
+      setpoint.ctrl_mode != modes_[0])
+    return false;
+
+  // Streamed set points are dense, hence applied directly, with no trajectory
+  switch (setpoint.ctrl_mode)
+  {
+    case CABLE_LENGTH:
+      SetCableLenTarget(setpoint.cable_length);
+      return true;
+    case MOTOR_POSITION:
+      SetMotorPosTarget(setpoint.motor_position, false);
+      return true;
+    case MOTOR_SPEED:
+      SetMotorSpeedTarget(setpoint.motor_speed);
+      return true;
+    case MOTOR_TORQUE:
+      SetMotorTorqueTarget(setpoint.motor_torque);
+      return true;
+    case NONE:
+      break;
+  }
+  return false;
 }
 
 void ControllerSingleDrive::Clear()
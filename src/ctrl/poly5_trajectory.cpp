@@ -0,0 +1,84 @@
+/**
+ * @file poly5_trajectory.cpp
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing definitions of functions and class declared in
+ * poly5_trajectory.h.
+ */
+
+#include "ctrl/poly5_trajectory.h"
+
+#include <cmath>
+
+constexpr uint64_t Poly5Trajectory::kMaxPrecomputedCycles_;
+
+Poly5Trajectory::Poly5Trajectory()
+  : duration_(0.0), period_sec_(0.0), cycles_num_(0), cycle_(0), initial_(0.0),
+    delta_(0.0)
+{}
+
+//--------- Public functions ---------------------------------------------------------//
+
+void Poly5Trajectory::Plan(const double duration, const double period_sec,
+                           const bool precompute /*= false*/)
+{
+  duration_   = duration > 0.0 ? duration : 0.0;
+  period_sec_ = period_sec;
+  // Small tolerance, so that a duration multiple of the period is not rounded up
+  cycles_num_ = duration_ > 0.0 && period_sec_ > 0.0
+                  ? static_cast<uint64_t>(ceil(duration_ / period_sec_ - 1e-9))
+                  : 0;
+  cycle_ = cycles_num_; // stopped until started
+
+  profile_.clear(); // never releases memory, so that replanning in RT thread is safe
+  if (!precompute || cycles_num_ > kMaxPrecomputedCycles_)
+    return;
+  profile_.resize(cycles_num_);
+  for (uint64_t k = 0; k < cycles_num_; k++)
+    profile_[k] = Normalized(k);
+}
+
+void Poly5Trajectory::Start(const double initial, const double final)
+{
+  initial_ = initial;
+  delta_   = final - initial;
+  cycle_   = 0;
+}
+
+Poly5Trajectory::Waypoint Poly5Trajectory::Step()
+{
+  const Waypoint waypoint = At(cycle_);
+  if (cycle_ < cycles_num_)
+    cycle_++;
+  return waypoint;
+}
+
+void Poly5Trajectory::Skip(const uint64_t cycles_num)
+{
+  cycle_ = cycles_num < cycles_num_ - cycle_ ? cycle_ + cycles_num : cycles_num_;
+}
+
+Poly5Trajectory::Waypoint Poly5Trajectory::At(const uint64_t cycle) const
+{
+  if (cycle >= cycles_num_)
+    return {initial_ + delta_, 0.0, 0.0};
+
+  const Waypoint normalized = profile_.empty() ? Normalized(cycle) : profile_[cycle];
+  return {initial_ + delta_ * normalized.position, delta_ * normalized.velocity,
+          delta_ * normalized.acceleration};
+}
+
+//--------- Private functions --------------------------------------------------------//
+
+Poly5Trajectory::Waypoint Poly5Trajectory::Normalized(const uint64_t cycle) const
+{
+  // s(tau) = 10 tau^3 - 15 tau^4 + 6 tau^5 and its time derivatives, by Horner's rule
+  const double tau  = cycle * period_sec_ / duration_;
+  const double tau2 = tau * tau;
+  Waypoint normalized;
+  normalized.position     = tau2 * tau * (10.0 + tau * (-15.0 + tau * 6.0));
+  normalized.velocity     = tau2 * (30.0 + tau * (-60.0 + tau * 30.0)) / duration_;
+  normalized.acceleration =
+    tau * (60.0 + tau * (-180.0 + tau * 120.0)) / (duration_ * duration_);
+  return normalized;
+}
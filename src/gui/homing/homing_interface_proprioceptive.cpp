@@ -230,7 +230,8 @@ void HomingInterfaceProprioceptive::on_pushButton_extFile_clicked()
   CLOG(TRACE, "event");
   QString config_filename =
     QFileDialog::getOpenFileName(this, tr("Load Optimization Results"), tr("../.."),
-                                 tr("Optimization results (*.json)"));
+                                 tr("Optimization results (*.json);;Homing "
+                                    "measurements (*.bin)"));
   if (config_filename.isEmpty())
   {
     QMessageBox::warning(this, "File Error", "File name is empty!");
@@ -244,15 +245,29 @@ void HomingInterfaceProprioceptive::on_pushButton_ok_clicked()
   CLOG(TRACE, "event");
   ui->pushButton_ok->setChecked(false);
   ui->progressBar_optimization->setValue(0);
-  connect(&app_, SIGNAL(progressValue(int)), this, SLOT(updateOptimizationProgress(int)),
-          Qt::ConnectionType::DirectConnection);
-  // "Internal" optimization (ext call to Matlab)
+  ui->progressBar_optimization->resetFormat();
+  connect(&app_, SIGNAL(optimizationProgress(int, double)), this,
+          SLOT(updateOptimizationProgress(int, double)), Qt::UniqueConnection);
+  // "Internal" optimization (native solver)
   if (ui->radioButton_internal->isChecked())
   {
     ui->groupBox_dataCollection->setEnabled(false);
     app_.Optimize();
     return;
   }
+  // "External" measurements = run native solver again on a saved acquisition
+  if (ui->lineEdit_extFile->text().endsWith(".bin"))
+  {
+    if (!app_.LoadDataset(ui->lineEdit_extFile->text()))
+    {
+      QMessageBox::warning(this, "File Error",
+                           "File content is not valid!\nPlease load a different file.");
+      return;
+    }
+    ui->groupBox_dataCollection->setEnabled(false);
+    app_.Optimize();
+    return;
+  }
   // "External" optimization = load results obtained somehow externally
   HomingProprioceptiveHomeData* home_data = new HomingProprioceptiveHomeData;
   if (!app_.ParseExtFile(ui->lineEdit_extFile->text(), home_data))
@@ -358,10 +373,13 @@ void HomingInterfaceProprioceptive::updateAcquisitionProgress(const int value)
     ui->progressBar_acquisition->setValue(static_cast<int>(value));
 }
 
-void HomingInterfaceProprioceptive::updateOptimizationProgress(const int value)
+void HomingInterfaceProprioceptive::updateOptimizationProgress(
+  const int value, const double best_residual)
 {
   if (value > ui->progressBar_optimization->value())
     ui->progressBar_optimization->setValue(value);
+  ui->progressBar_optimization->setFormat(
+    QString("%p% (best residual RMS = %1)").arg(best_residual, 0, 'g', 3));
 }
 
 void HomingInterfaceProprioceptive::handleAcquisitionComplete()
@@ -422,8 +440,8 @@ void HomingInterfaceProprioceptive::handleStateChanged(const quint8& state)
       ui->pushButton_clearFaults->setEnabled(true);
       break;
     case HomingProprioceptive::ST_HOME:
-      disconnect(&app_, SIGNAL(progressValue(int)), this,
-                 SLOT(updateOptimizationProgress(int)));
+      disconnect(&app_, SIGNAL(optimizationProgress(int, double)), this,
+                 SLOT(updateOptimizationProgress(int, double)));
       break;
     default:
       break;
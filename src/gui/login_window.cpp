@@ -117,7 +117,7 @@ void LoginWindow::on_pushButton_load_clicked()
     return;
   }
   CLOG(INFO, "event") << "Loaded configuration file '" << config_filename << "'";
-  main_gui = new MainGUI(this, config_);
+  main_gui = new MainGUI(this, config_, app_settings_);
   hide();
   CLOG(INFO, "event") << "Hide login window";
   main_gui->show();
@@ -131,7 +131,7 @@ void LoginWindow::on_pushButton_loadDefault_clicked()
   default_filename.append("config/default.json");
   CLOG(INFO, "event") << "Loaded default configuration file '" << default_filename << "'";
   ParseConfigFile(default_filename);
-  main_gui = new MainGUI(this, config_);
+  main_gui = new MainGUI(this, config_, app_settings_);
   hide();
   CLOG(INFO, "event") << "Hide login window";
   main_gui->show();
@@ -142,5 +142,12 @@ bool LoginWindow::ParseConfigFile(QString& config_filename)
 {
   RobotConfigJsonParser parser;
   CLOG(INFO, "event") << "Parsing configuration file '" << config_filename << "'...";
-  return parser.ParseFile(config_filename, &config_);
+  if (!parser.ParseFile(config_filename, &config_))
+    return false;
+  AppSettingsJsonParser settings_parser;
+  if (!settings_parser.ParseFile(config_filename.toStdString(), &app_settings_))
+    return false;
+  if (app_settings_.ethercat_backend == ETHERCAT_SIMULATED)
+    CLOG(INFO, "event") << "EtherCAT network is simulated";
+  return true;
 }
@@ -8,8 +8,11 @@
 #include "gui/main_gui.h"
 #include "ui_main_gui.h"
 
-MainGUI::MainGUI(QWidget* parent, const grabcdpr::Params& config)
-  : QDialog(parent), ui(new Ui::MainGUI), config_params_(config)
+#include <sstream>
+
+MainGUI::MainGUI(QWidget* parent, const grabcdpr::Params& config,
+                 const AppSettings& settings /*= AppSettings()*/)
+  : QDialog(parent), ui(new Ui::MainGUI), config_params_(config), app_settings_(settings)
 {
   ui->setupUi(this);
 
@@ -38,15 +41,59 @@ MainGUI::~MainGUI()
 void MainGUI::on_pushButton_reset_clicked()
 {
   CLOG(TRACE, "event");
-  robot_ptr_->Reset();
+  robot_ptr_->ResetNetwork();
   ui->frame_manualControl->setEnabled(true);
 }
 
+void MainGUI::on_pushButton_rtStats_clicked()
+{
+  CLOG(TRACE, "event");
+  if (robot_ptr_ == NULL)
+    return;
+  std::ostringstream report;
+  robot_ptr_->GetRtTimingStats().Dump(report);
+  CLOG(INFO, "browser") << report.str();
+  ui->textBrowser_logs->append(
+    QString("<pre>%1</pre>").arg(QString::fromStdString(report.str()).toHtmlEscaped()));
+}
+
+void MainGUI::on_pushButton_resetOverruns_clicked()
+{
+  CLOG(TRACE, "event");
+  if (robot_ptr_ == NULL)
+    return;
+  robot_ptr_->ResetOverrunPolicy();
+}
+
+void MainGUI::on_pushButton_record_toggled(bool checked)
+{
+  CLOG(TRACE, "event") << checked;
+  if (robot_ptr_ == NULL)
+    return;
+  if (!checked)
+  {
+    robot_ptr_->StopRecording();
+    ui->pushButton_record->setText(tr("Record"));
+    return;
+  }
+  if (robot_ptr_->StartRecording())
+  {
+    ui->pushButton_record->setText(tr("Stop rec"));
+    return;
+  }
+  // Could not start: restore button without triggering this slot again
+  ui->pushButton_record->blockSignals(true);
+  ui->pushButton_record->setChecked(false);
+  ui->pushButton_record->blockSignals(false);
+}
+
 void MainGUI::on_pushButton_calib_clicked()
 {
   CLOG(TRACE, "event");
   if (!(ec_network_valid_ && rt_thread_running_))
     return;
+  if (!OverrunsCleared())
+    return;
 
   if (robot_ptr_->GetCurrentState() == CableRobot::ST_READY)
     if (!ExitReadyStateRequest())
@@ -71,6 +118,8 @@ void MainGUI::on_pushButton_homing_clicked()
   CLOG(TRACE, "event");
   if (!(ec_network_valid_ && rt_thread_running_))
     return;
+  if (!OverrunsCleared())
+    return;
 
   ui->pushButton_homing->setDisabled(true);
   ui->pushButton_calib->setDisabled(true);
@@ -96,6 +145,8 @@ void MainGUI::on_pushButton_startApp_clicked()
   CLOG(TRACE, "event");
   if (!(ec_network_valid_ && rt_thread_running_))
     return;
+  if (!OverrunsCleared())
+    return;
 
   ui->pushButton_homing->setDisabled(true);
   ui->pushButton_calib->setDisabled(true);
@@ -383,6 +434,7 @@ void MainGUI::updateRtThreadStatusLED(const bool active)
 
   if (!rt_thread_running_)
   {
+    on_pushButton_rtStats_clicked(); // show timing statistics leading to the shutdown
     QMessageBox::warning(this, "Thread Error",
                          "Real-Time thread missed its dealine and "
                          "automatically shut down!\nPlease reset the robot.");
@@ -570,6 +622,15 @@ bool MainGUI::ExitReadyStateRequest()
   return (reply == QMessageBox::Yes);
 }
 
+bool MainGUI::OverrunsCleared()
+{
+  if (robot_ptr_->GetOverrunPolicy().GetState() != OverrunPolicy::ST_ESCALATED)
+    return true;
+  appendText2Browser("WARNING: Set points are frozen by too many RT cycle overruns: "
+                     "reset overruns first");
+  return false;
+}
+
 //--------- Private methods ----------------------------------------------------------//
 
 void MainGUI::SetupDirectMotorCtrl(const bool enable)
@@ -630,7 +691,7 @@ ControlMode MainGUI::DriveOpMode2CtrlMode(const int8_t drive_op_mode)
 
 void MainGUI::StartRobot()
 {
-  robot_ptr_ = new CableRobot(this, config_params_);
+  robot_ptr_ = new CableRobot(this, config_params_, app_settings_);
 
   connect(robot_ptr_, SIGNAL(printToQConsole(QString)), this,
           SLOT(appendText2Browser(QString)), Qt::ConnectionType::QueuedConnection);
@@ -643,7 +704,7 @@ void MainGUI::StartRobot()
 
   robot_ptr_->eventSuccess(); // pwd & config OK --> robot ENABLED
   if (robot_ptr_->GetCurrentState() == CableRobot::ST_ENABLED)
-    robot_ptr_->Start(); // start rt thread (ec master)
+    robot_ptr_->StartNetwork(); // start rt thread (ec master or simulated network)
 }
 
 void MainGUI::DeleteRobot()
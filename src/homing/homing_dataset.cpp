@@ -0,0 +1,139 @@
+/**
+ * @file homing_dataset.cpp
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing definitions of functions and class declared in
+ * homing_dataset.h.
+ */
+
+#include "homing/homing_dataset.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+const char kMagic[]             = {'C', 'R', 'H', 'O', 'M', 'I', 'N', 'G'};
+const uint32_t kVersion         = 1;
+const uint32_t kMaxActuatorsNum = 256; // sanity check against corrupted snapshots
+
+template <typename T> bool WriteValue(FILE* file, const T& value)
+{
+  char data[WireSize<T>()];
+  WireWrite(data, value);
+  return fwrite(data, 1, sizeof(data), file) == sizeof(data);
+}
+
+template <typename T> bool ReadValue(FILE* file, T* value)
+{
+  char data[WireSize<T>()];
+  if (fread(data, 1, sizeof(data), file) != sizeof(data))
+    return false;
+  WireRead(data, value);
+  return true;
+}
+
+} // end namespace
+
+//--------- Public functions ---------------------------------------------------------//
+
+void HomingDataset::Reset(const vect<id_t>& actuators_id, const size_t capacity /*= 0*/)
+{
+  actuators_id_ = actuators_id;
+  samples_.clear();
+  samples_.reserve(capacity);
+}
+
+bool HomingDataset::Add(const size_t actuator_idx, const vect<ActuatorStatusMsg>& meas)
+{
+  if (actuator_idx >= actuators_id_.size() || meas.size() != actuators_id_.size())
+    return false;
+  for (size_t i = 0; i < meas.size(); i++)
+    if (meas[i].body.id != actuators_id_[i])
+      return false;
+
+  samples_.emplace_back();
+  HomingSample& sample = samples_.back();
+  sample.actuator_idx  = actuator_idx;
+  sample.cable_lengths.resize(meas.size());
+  sample.pulley_angles.resize(meas.size());
+  for (size_t i = 0; i < meas.size(); i++)
+  {
+    sample.cable_lengths[i] = meas[i].body.cable_length;
+    sample.pulley_angles[i] = meas[i].body.pulley_angle;
+  }
+  return true;
+}
+
+bool HomingDataset::Save(const std::string& filename) const
+{
+  FILE* file = fopen(filename.c_str(), "wb");
+  if (file == NULL)
+    return false;
+
+  bool ok = fwrite(kMagic, 1, sizeof(kMagic), file) == sizeof(kMagic) &&
+            WriteValue(file, kVersion) &&
+            WriteValue(file, static_cast<uint32_t>(actuators_id_.size()));
+  for (const id_t id : actuators_id_)
+    ok = ok && WriteValue(file, static_cast<uint32_t>(id));
+  ok = ok && WriteValue(file, static_cast<uint32_t>(samples_.size()));
+  for (const HomingSample& sample : samples_)
+  {
+    ok = ok && WriteValue(file, static_cast<uint32_t>(sample.actuator_idx));
+    for (const double length : sample.cable_lengths)
+      ok = ok && WriteValue(file, length);
+    for (const double angle : sample.pulley_angles)
+      ok = ok && WriteValue(file, angle);
+  }
+  return fclose(file) == 0 && ok;
+}
+
+bool HomingDataset::Load(const std::string& filename)
+{
+  FILE* file = fopen(filename.c_str(), "rb");
+  if (file == NULL)
+    return false;
+
+  char magic[sizeof(kMagic)];
+  uint32_t version;
+  uint32_t actuators_num;
+  bool ok = fread(magic, 1, sizeof(magic), file) == sizeof(magic) &&
+            memcmp(magic, kMagic, sizeof(kMagic)) == 0 && ReadValue(file, &version) &&
+            version == kVersion && ReadValue(file, &actuators_num) &&
+            actuators_num > 0 && actuators_num <= kMaxActuatorsNum;
+
+  vect<id_t> actuators_id(ok ? actuators_num : 0);
+  for (id_t& id : actuators_id)
+  {
+    uint32_t value;
+    ok = ok && ReadValue(file, &value);
+    id = static_cast<id_t>(value);
+  }
+  uint32_t samples_num = 0;
+  ok                   = ok && ReadValue(file, &samples_num);
+
+  // Samples are appended as they are read, so that a corrupted count cannot trigger a
+  // huge allocation
+  vect<HomingSample> samples;
+  for (uint32_t k = 0; ok && k < samples_num; k++)
+  {
+    HomingSample sample;
+    uint32_t actuator_idx;
+    ok                  = ReadValue(file, &actuator_idx) && actuator_idx < actuators_num;
+    sample.actuator_idx = actuator_idx;
+    sample.cable_lengths.resize(actuators_num);
+    sample.pulley_angles.resize(actuators_num);
+    for (double& length : sample.cable_lengths)
+      ok = ok && ReadValue(file, &length);
+    for (double& angle : sample.pulley_angles)
+      ok = ok && ReadValue(file, &angle);
+    samples.push_back(sample);
+  }
+  fclose(file);
+  if (!ok)
+    return false;
+
+  actuators_id_.swap(actuators_id);
+  samples_.swap(samples);
+  return true;
+}
@@ -0,0 +1,898 @@
+/**
+ * @file homing_optimizer.cpp
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing definitions of functions and class declared in
+ * homing_optimizer.h.
+ */
+
+#include "homing/homing_optimizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <random>
+#include <thread>
+
+namespace {
+
+typedef HomingOptimizer::Vec3 Vec3;
+typedef HomingOptimizer::Pose Pose;
+typedef std::array<Vec3, 3> Mat3; // row by row
+
+constexpr size_t kPoseDim      = 6;
+constexpr double kDiffStep     = 1e-6; // relative step of numerical derivatives
+constexpr double kInitDamping  = 1e-3; // initial Levenberg-Marquardt damping
+constexpr double kMaxDamping   = 1e12;
+constexpr double kDampingScale = 10.0;
+
+//--------- Linear algebra -----------------------------------------------------------//
+
+double Dot(const Vec3& a, const Vec3& b)
+{
+  return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+Vec3 Cross(const Vec3& a, const Vec3& b)
+{
+  return {{a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2],
+           a[0] * b[1] - a[1] * b[0]}};
+}
+
+Vec3 Sum(const Vec3& a, const Vec3& b)
+{
+  return {{a[0] + b[0], a[1] + b[1], a[2] + b[2]}};
+}
+
+Vec3 Diff(const Vec3& a, const Vec3& b)
+{
+  return {{a[0] - b[0], a[1] - b[1], a[2] - b[2]}};
+}
+
+Vec3 Scaled(const Vec3& a, const double k) { return {{a[0] * k, a[1] * k, a[2] * k}}; }
+
+Vec3 Product(const Mat3& m, const Vec3& v)
+{
+  return {{Dot(m[0], v), Dot(m[1], v), Dot(m[2], v)}};
+}
+
+// Tait-Bryan angles, i.e. R = Rx(pose[3]) * Ry(pose[4]) * Rz(pose[5])
+Mat3 RotTaitBryan(const Pose& pose)
+{
+  const double ca = cos(pose[3]), sa = sin(pose[3]);
+  const double cb = cos(pose[4]), sb = sin(pose[4]);
+  const double cc = cos(pose[5]), sc = sin(pose[5]);
+  Mat3 rot;
+  rot[0] = {{cb * cc, -cb * sc, sb}};
+  rot[1] = {{sa * sb * cc + ca * sc, -sa * sb * sc + ca * cc, -sa * cb}};
+  rot[2] = {{-ca * sb * cc + sa * sc, ca * sb * sc + sa * cc, ca * cb}};
+  return rot;
+}
+
+// In-place Cholesky decomposition of a symmetric positive definite matrix (row-major),
+// whose lower triangle is replaced by L, such that A = L * L^T.
+bool CholeskyDecompose(double* a, const size_t n)
+{
+  for (size_t j = 0; j < n; j++)
+  {
+    double diag = a[j * n + j];
+    for (size_t k = 0; k < j; k++)
+      diag -= a[j * n + k] * a[j * n + k];
+    if (!(diag > 0.0))
+      return false;
+    a[j * n + j] = sqrt(diag);
+    for (size_t i = j + 1; i < n; i++)
+    {
+      double value = a[i * n + j];
+      for (size_t k = 0; k < j; k++)
+        value -= a[i * n + k] * a[j * n + k];
+      a[i * n + j] = value / a[j * n + j];
+    }
+  }
+  return true;
+}
+
+// Solve L * L^T * x = b in place, given L from CholeskyDecompose().
+void CholeskySolve(const double* l, const size_t n, double* b)
+{
+  for (size_t i = 0; i < n; i++)
+  {
+    for (size_t k = 0; k < i; k++)
+      b[i] -= l[i * n + k] * b[k];
+    b[i] /= l[i * n + i];
+  }
+  for (size_t i = n; i-- > 0;)
+  {
+    for (size_t k = i + 1; k < n; k++)
+      b[i] -= l[k * n + i] * b[k];
+    b[i] /= l[i * n + i];
+  }
+}
+
+// Solve A * x = b in place by Gaussian elimination with partial pivoting (row-major).
+bool SolveLinearSystem(double* a, double* b, const size_t n)
+{
+  for (size_t j = 0; j < n; j++)
+  {
+    size_t pivot = j;
+    for (size_t i = j + 1; i < n; i++)
+      if (fabs(a[i * n + j]) > fabs(a[pivot * n + j]))
+        pivot = i;
+    if (a[pivot * n + j] == 0.0)
+      return false;
+    if (pivot != j)
+    {
+      for (size_t k = 0; k < n; k++)
+        std::swap(a[j * n + k], a[pivot * n + k]);
+      std::swap(b[j], b[pivot]);
+    }
+    for (size_t i = j + 1; i < n; i++)
+    {
+      const double factor = a[i * n + j] / a[j * n + j];
+      for (size_t k = j; k < n; k++)
+        a[i * n + k] -= factor * a[j * n + k];
+      b[i] -= factor * b[j];
+    }
+  }
+  for (size_t i = n; i-- > 0;)
+  {
+    for (size_t k = i + 1; k < n; k++)
+      b[i] -= a[i * n + k] * b[k];
+    b[i] /= a[i * n + i];
+  }
+  return true;
+}
+
+double SquaredNorm(const vect<double>& v)
+{
+  double norm = 0.0;
+  for (const double value : v)
+    norm += value * value;
+  return norm;
+}
+
+double MaxAbs(const double* values, const size_t size)
+{
+  double max_abs = 0.0;
+  for (size_t i = 0; i < size; i++)
+    max_abs = std::max(max_abs, fabs(values[i]));
+  return max_abs;
+}
+
+// Whether the residuals r are orthogonal, within given tolerance, to a column Jk of the
+// jacobian, given the gradient component Jk^T*r, the squared norm of Jk and of r. This is
+// the scale-free stationarity test of MINPACK (gtol).
+bool IsOrthogonal(const double gradient, const double column_sq_norm,
+                  const double residuals_sq_norm, const double tolerance)
+{
+  const double bound = tolerance * tolerance * column_sq_norm * residuals_sq_norm;
+  return gradient * gradient <= bound;
+}
+
+bool AllFinite(const double* values, const size_t size)
+{
+  for (size_t i = 0; i < size; i++)
+    if (!std::isfinite(values[i]))
+      return false;
+  return true;
+}
+
+// Central-difference jacobian (row-major, residuals_num x kPoseDim) of a residual
+// function of a pose.
+template <class ResidualFun>
+bool CalcPoseJacobian(const ResidualFun& fun, const Pose& pose,
+                      const size_t residuals_num, vect<double>* residuals_buf,
+                      double* jacobian)
+{
+  vect<double>& forward  = residuals_buf[0];
+  vect<double>& backward = residuals_buf[1];
+  for (size_t c = 0; c < kPoseDim; c++)
+  {
+    const double step = kDiffStep * (1.0 + fabs(pose[c]));
+    Pose perturbed    = pose;
+    perturbed[c]      = pose[c] + step;
+    if (!fun(perturbed, forward.data()))
+      return false;
+    perturbed[c] = pose[c] - step;
+    if (!fun(perturbed, backward.data()))
+      return false;
+    for (size_t r = 0; r < residuals_num; r++)
+      jacobian[r * kPoseDim + c] = (forward[r] - backward[r]) / (2.0 * step);
+  }
+  return true;
+}
+
+// Levenberg-Marquardt on a pose only, i.e. a small dense nonlinear least-squares problem.
+template <class ResidualFun>
+bool SolvePose(const ResidualFun& fun, const size_t residuals_num,
+               const HomingOptimizerOptions& options, Pose* pose)
+{
+  vect<double> residuals(residuals_num);
+  vect<double> new_residuals(residuals_num);
+  vect<double> diff_buf[2] = {vect<double>(residuals_num), vect<double>(residuals_num)};
+  vect<double> jacobian(residuals_num * kPoseDim);
+  if (!fun(*pose, residuals.data()))
+    return false;
+  double cost    = SquaredNorm(residuals);
+  double damping = kInitDamping;
+  for (size_t iter = 0; iter < options.max_iterations; iter++)
+  {
+    if (!CalcPoseJacobian(fun, *pose, residuals_num, diff_buf, jacobian.data()))
+      return false;
+    double hessian[kPoseDim * kPoseDim];
+    double gradient[kPoseDim];
+    for (size_t i = 0; i < kPoseDim; i++)
+    {
+      gradient[i] = 0.0;
+      for (size_t r = 0; r < residuals_num; r++)
+        gradient[i] += jacobian[r * kPoseDim + i] * residuals[r];
+      for (size_t j = 0; j < kPoseDim; j++)
+      {
+        hessian[i * kPoseDim + j] = 0.0;
+        for (size_t r = 0; r < residuals_num; r++)
+          hessian[i * kPoseDim + j] +=
+            jacobian[r * kPoseDim + i] * jacobian[r * kPoseDim + j];
+      }
+    }
+
+    bool improved          = false;
+    double first_step_norm = HUGE_VAL; // least damped trial of this iteration
+    while (!improved && damping < kMaxDamping)
+    {
+      double damped[kPoseDim * kPoseDim];
+      double step[kPoseDim];
+      for (size_t i = 0; i < kPoseDim * kPoseDim; i++)
+        damped[i] = hessian[i];
+      for (size_t i = 0; i < kPoseDim; i++)
+      {
+        damped[i * kPoseDim + i] *= 1.0 + damping;
+        damped[i * kPoseDim + i] += damping * kDiffStep;
+        step[i] = -gradient[i];
+      }
+      if (CholeskyDecompose(damped, kPoseDim))
+      {
+        CholeskySolve(damped, kPoseDim, step);
+        if (first_step_norm == HUGE_VAL)
+          first_step_norm = MaxAbs(step, kPoseDim);
+        Pose new_pose = *pose;
+        for (size_t i = 0; i < kPoseDim; i++)
+          new_pose[i] += step[i];
+        if (fun(new_pose, new_residuals.data()))
+        {
+          const double new_cost = SquaredNorm(new_residuals);
+          if (new_cost < cost)
+          {
+            const bool converged = cost - new_cost <= options.tolerance * cost;
+            *pose                = new_pose;
+            residuals.swap(new_residuals);
+            cost     = new_cost;
+            damping  = std::max(damping / kDampingScale, kDiffStep);
+            improved = true;
+            if (converged)
+              return true;
+            continue;
+          }
+        }
+      }
+      damping *= kDampingScale;
+    }
+    if (!improved)
+    {
+      // Cannot improve anymore: a solution if even the least damped step was negligible
+      // (e.g. residuals at round-off) or if the gradient vanishes, i.e. noise left in the
+      // residuals is not explained by any direction.
+      if (first_step_norm <= options.step_tolerance)
+        return true;
+      for (size_t i = 0; i < kPoseDim; i++)
+        if (!IsOrthogonal(gradient[i], hessian[i * kPoseDim + i], cost,
+                          options.gradient_tolerance))
+          return false;
+      return true;
+    }
+  }
+  return false;
+}
+
+} // end namespace
+
+//------------------------------------------------------------------------------------//
+//--------- HomingOptimizer class ----------------------------------------------------//
+//------------------------------------------------------------------------------------//
+
+HomingOptimizer::HomingOptimizer(const grabcdpr::Params& params,
+                                 const HomingOptimizerOptions& options
+                                 /*= HomingOptimizerOptions()*/)
+  : options_(options)
+{
+  for (const grabcdpr::ActuatorParams& actuator : params.actuators)
+  {
+    if (!actuator.active)
+      continue;
+    CableGeometry cable;
+    for (uint8_t i = 0; i < 3; i++)
+    {
+      cable.pos_OD_glob[i] = actuator.pulley.pos_OD_glob(i + 1, 1);
+      cable.vers_i[i]      = actuator.pulley.vers_i(i + 1, 1);
+      cable.vers_j[i]      = actuator.pulley.vers_j(i + 1, 1);
+      cable.vers_k[i]      = actuator.pulley.vers_k(i + 1, 1);
+      cable.pos_PA_loc[i]  = actuator.winch.pos_PA_loc(i + 1, 1);
+    }
+    cable.pulley_radius = actuator.pulley.radius;
+    cables_.push_back(cable);
+  }
+  platform_mass_ = params.platform.mass;
+  for (uint8_t i = 0; i < 3; i++)
+  {
+    pos_PG_loc_[i]     = params.platform.pos_PG_loc(i + 1, 1);
+    ext_force_loc_[i]  = params.platform.ext_force_loc(i + 1, 1);
+    ext_torque_loc_[i] = params.platform.ext_torque_loc(i + 1, 1);
+  }
+}
+
+//--------- Public functions ---------------------------------------------------------//
+
+bool HomingOptimizer::IsAcceptable(const HomingOptimizerResult& result) const
+{
+  return result.converged && result.residual_rms <= options_.accept_residual_rms;
+}
+
+bool HomingOptimizer::IsConfident(const HomingOptimizerResult& result,
+                                  const HomingOptimizerResult& previous) const
+{
+  if (!result.converged || result.init_lengths.size() != previous.init_lengths.size() ||
+      result.init_angles.size() != previous.init_angles.size())
+    return false;
+  for (size_t i = 0; i < result.init_lengths.size(); i++)
+  {
+    if (result.init_lengths_std[i] > options_.confident_length_std ||
+        fabs(result.init_lengths[i] - previous.init_lengths[i]) >
+          options_.confident_length_std)
+      return false;
+    if (result.init_angles_std[i] > options_.confident_angle_std ||
+        fabs(result.init_angles[i] - previous.init_angles[i]) >
+          options_.confident_angle_std)
+      return false;
+  }
+  return true;
+}
+
+HomingOptimizerResult HomingOptimizer::Optimize(const vect<HomingSample>& samples,
+                                                const size_t start_idx /*= 0*/,
+                                                const std::atomic<bool>* cancel
+                                                /*= NULL*/) const
+{
+  HomingOptimizerResult result;
+  result.start_idx = start_idx;
+  if (!AreValid(samples))
+    return result;
+  const size_t cables_num = CablesNum();
+
+  // 1. Guess of home pose and corresponding cable lengths and pulley angles
+  vect<CableState> cables(cables_num);
+  Pose home_pose;
+  if (!FindHomePose(&home_pose))
+    return result; // no equilibrium to start from, i.e. not converged
+  PerturbPose(start_idx, &home_pose);
+  CalcCables(home_pose, cables.data());
+  vect<double> home_values(2 * cables_num); // pulley angles, then cable lengths
+  for (size_t i = 0; i < cables_num; i++)
+  {
+    home_values[i]              = cables[i].swivel_angle;
+    home_values[cables_num + i] = cables[i].length;
+  }
+
+  // 2. Guess of each measured pose by direct kinematics
+  vect<Pose> poses;
+  if (!GuessPoses(samples, home_values, home_pose, true, cancel, &poses))
+    return result;
+
+  // 3. Least-squares fit of home values and poses at once
+  Fit(samples, cancel, &home_values, &poses, &result);
+  return result;
+}
+
+HomingOptimizerResult HomingOptimizer::Refine(const vect<HomingSample>& samples,
+                                              const HomingOptimizerResult& previous,
+                                              const std::atomic<bool>* cancel
+                                              /*= NULL*/) const
+{
+  const size_t cables_num = CablesNum();
+  if (previous.poses.empty() || previous.poses.size() > samples.size() ||
+      previous.init_lengths.size() != cables_num ||
+      previous.init_angles.size() != cables_num)
+    return Optimize(samples, 0, cancel); // nothing to start from
+  HomingOptimizerResult result;
+  if (!AreValid(samples))
+    return result;
+
+  // Warm start from previous solution, guessing new poses from the latest one
+  vect<double> home_values(previous.init_angles);
+  home_values.insert(home_values.end(), previous.init_lengths.begin(),
+                     previous.init_lengths.end());
+  vect<Pose> poses(previous.poses);
+  if (!GuessPoses(samples, home_values, poses.back(), false, cancel, &poses))
+    return result;
+
+  Fit(samples, cancel, &home_values, &poses, &result);
+  return result;
+}
+HomingOptimizerResult
+HomingOptimizer::OptimizeMultiStart(const vect<HomingSample>& samples,
+                                    const size_t threads_num /*= 0*/,
+                                    std::atomic<bool>* cancel /*= NULL*/,
+                                    const ProgressCallback& progress_cb
+                                    /*= ProgressCallback()*/) const
+{
+  std::atomic<bool> local_cancel(false);
+  if (cancel == NULL)
+    cancel = &local_cancel;
+  const size_t starts_num = std::max(options_.starts_num, static_cast<size_t>(1));
+  size_t workers_num      = threads_num;
+  if (workers_num == 0)
+    workers_num = std::max(std::thread::hardware_concurrency(), 1u);
+  workers_num = std::min(workers_num, starts_num);
+
+  std::atomic<size_t> next_start(0);
+  std::mutex mutex;
+  size_t completed_num = 0;
+  HomingOptimizerResult best;
+  best.residual_norm = HUGE_VAL;
+  best.residual_rms  = HUGE_VAL;
+
+  auto work = [&]() {
+    while (!cancel->load(std::memory_order_relaxed))
+    {
+      const size_t start_idx = next_start.fetch_add(1);
+      if (start_idx >= starts_num)
+        break;
+      const HomingOptimizerResult result = Optimize(samples, start_idx, cancel);
+      std::lock_guard<std::mutex> lock(mutex);
+      completed_num++;
+      // Outcomes of cancelled starts are still valid, just less refined
+      if (!result.init_lengths.empty() && result.residual_norm < best.residual_norm)
+        best = result;
+      if (IsAcceptable(best))
+        cancel->store(true, std::memory_order_relaxed);
+      if (progress_cb)
+        progress_cb(completed_num, best);
+    }
+  };
+
+  vect<std::thread> workers;
+  for (size_t i = 1; i < workers_num; i++)
+    workers.push_back(std::thread(work));
+  work(); // calling thread is part of the pool too
+  for (std::thread& worker : workers)
+    worker.join();
+  return best;
+}
+
+//--------- Private functions --------------------------------------------------------//
+
+bool HomingOptimizer::AreValid(const vect<HomingSample>& samples) const
+{
+  if (CablesNum() == 0 || samples.empty())
+    return false;
+  for (const HomingSample& sample : samples)
+    if (sample.cable_lengths.size() != CablesNum() ||
+        sample.pulley_angles.size() != CablesNum())
+      return false;
+  return true;
+}
+
+bool HomingOptimizer::GuessPoses(const vect<HomingSample>& samples,
+                                 const vect<double>& home_values, const Pose& start_pose,
+                                 const bool restart, const std::atomic<bool>* cancel,
+                                 vect<Pose>* poses) const
+{
+  const size_t cables_num = CablesNum();
+  vect<double> lengths(cables_num);
+  Pose pose = start_pose;
+  for (size_t j = poses->size(); j < samples.size(); j++)
+  {
+    if (cancel != NULL && cancel->load(std::memory_order_relaxed))
+      return false;
+    if (restart && j > 0 && samples[j].actuator_idx != samples[j - 1].actuator_idx)
+      pose = start_pose;
+    for (size_t i = 0; i < cables_num; i++)
+      lengths[i] = home_values[cables_num + i] + samples[j].cable_lengths[i];
+    FindPose(lengths, &pose);
+    poses->push_back(pose);
+  }
+  return true;
+}
+
+void HomingOptimizer::Fit(const vect<HomingSample>& samples,
+                          const std::atomic<bool>* cancel, vect<double>* home_values_ptr,
+                          vect<Pose>* poses_ptr, HomingOptimizerResult* result) const
+{
+  // Levenberg-Marquardt with Schur complement on the block-arrow normal equations
+  vect<double>& home_values = *home_values_ptr;
+  vect<Pose>& poses         = *poses_ptr;
+  const size_t cables_num   = CablesNum();
+  const size_t home_dim     = home_values.size();
+  const size_t rows         = 2 * cables_num + StaticResidualsNum(); // per sample
+  const size_t samples_num  = samples.size();
+  const double weights[2]   = {options_.swivel_weight, options_.length_weight};
+  vect<CableState> cables(cables_num);
+  vect<double> residuals(samples_num * rows);
+  vect<double> new_residuals(samples_num * rows);
+  vect<double> jacobians(samples_num * rows * kPoseDim);     // d residuals / d pose
+  vect<double> hessians(samples_num * kPoseDim * kPoseDim); // pose blocks
+  vect<double> gradients(samples_num * kPoseDim);           // pose blocks
+  vect<double> home_gradient(home_dim);
+  vect<double> coupling(home_dim * kPoseDim); // home-pose block
+  vect<double> inv_coupling(samples_num * kPoseDim * home_dim);
+  vect<double> factors(samples_num * kPoseDim * kPoseDim);
+  vect<double> schur(home_dim * home_dim);
+  vect<double> home_step(home_dim);
+  vect<double> diff_buf[2] = {vect<double>(rows), vect<double>(rows)};
+  vect<Pose> new_poses(samples_num);
+  vect<double> new_home_values(home_dim);
+
+  auto eval_all = [&](const vect<Pose>& ps, const vect<double>& hv,
+                      vect<double>* res) -> bool {
+    for (size_t j = 0; j < samples_num; j++)
+      if (!CalcFitResiduals(ps[j], hv, samples[j], cables.data(), &(*res)[j * rows]))
+        return false;
+    return true;
+  };
+  // Jacobians, pose blocks of the normal equations and gradients at current solution.
+  // Home values only enter pulley angles and cable lengths residuals, linearly, with
+  // derivative -weight, hence their own block of the normal equations is diagonal.
+  auto linearize = [&]() -> bool {
+    std::fill(home_gradient.begin(), home_gradient.end(), 0.0);
+    for (size_t j = 0; j < samples_num; j++)
+    {
+      const double* res = &residuals[j * rows];
+      double* jac       = &jacobians[j * rows * kPoseDim];
+      auto fun          = [&](const Pose& p, double* r) {
+        return CalcFitResiduals(p, home_values, samples[j], cables.data(), r);
+      };
+      if (!CalcPoseJacobian(fun, poses[j], rows, diff_buf, jac))
+        return false;
+      for (size_t h = 0; h < home_dim; h++)
+        home_gradient[h] -= weights[h / cables_num] * res[h];
+      double* hess = &hessians[j * kPoseDim * kPoseDim];
+      double* grad = &gradients[j * kPoseDim];
+      for (size_t a = 0; a < kPoseDim; a++)
+      {
+        grad[a] = 0.0;
+        for (size_t r = 0; r < rows; r++)
+          grad[a] += jac[r * kPoseDim + a] * res[r];
+        for (size_t b = 0; b < kPoseDim; b++)
+        {
+          hess[a * kPoseDim + b] = 0.0;
+          for (size_t r = 0; r < rows; r++)
+            hess[a * kPoseDim + b] += jac[r * kPoseDim + a] * jac[r * kPoseDim + b];
+        }
+      }
+    }
+    return true;
+  };
+  // Schur complement of damped pose blocks, S = Hgg - sum(Hgj * Hjj^-1 * Hjg), factorized
+  // together with reduced right-hand side.
+  auto reduce = [&](const double damping) -> bool {
+    std::fill(schur.begin(), schur.end(), 0.0);
+    for (size_t h = 0; h < home_dim; h++)
+    {
+      const double w          = weights[h / cables_num];
+      schur[h * home_dim + h] = w * w * samples_num * (1.0 + damping);
+      home_step[h]            = -home_gradient[h];
+    }
+    for (size_t j = 0; j < samples_num; j++)
+    {
+      const double* jac = &jacobians[j * rows * kPoseDim];
+      double* factor    = &factors[j * kPoseDim * kPoseDim];
+      for (size_t i = 0; i < kPoseDim * kPoseDim; i++)
+        factor[i] = hessians[j * kPoseDim * kPoseDim + i];
+      for (size_t i = 0; i < kPoseDim; i++)
+        factor[i * kPoseDim + i] =
+          factor[i * kPoseDim + i] * (1.0 + damping) + damping * kDiffStep;
+      if (!CholeskyDecompose(factor, kPoseDim))
+        return false;
+      // Hjg columns are -weight times the jacobian row of the corresponding residual
+      for (size_t h = 0; h < home_dim; h++)
+        for (size_t a = 0; a < kPoseDim; a++)
+          coupling[h * kPoseDim + a] = -weights[h / cables_num] * jac[h * kPoseDim + a];
+      double* inv = &inv_coupling[j * kPoseDim * home_dim]; // Hjj^-1 * Hjg
+      for (size_t h = 0; h < home_dim; h++)
+      {
+        double column[kPoseDim];
+        for (size_t a = 0; a < kPoseDim; a++)
+          column[a] = coupling[h * kPoseDim + a];
+        CholeskySolve(factor, kPoseDim, column);
+        for (size_t a = 0; a < kPoseDim; a++)
+          inv[a * home_dim + h] = column[a];
+      }
+      const double* grad = &gradients[j * kPoseDim];
+      for (size_t h = 0; h < home_dim; h++)
+      {
+        for (size_t k = 0; k < home_dim; k++)
+          for (size_t a = 0; a < kPoseDim; a++)
+            schur[h * home_dim + k] -= coupling[h * kPoseDim + a] * inv[a * home_dim + k];
+        for (size_t a = 0; a < kPoseDim; a++)
+          home_step[h] += inv[a * home_dim + h] * grad[a];
+      }
+    }
+    return CholeskyDecompose(schur.data(), home_dim);
+  };
+
+  if (!eval_all(poses, home_values, &residuals))
+    return;
+  double cost    = SquaredNorm(residuals);
+  double damping = kInitDamping;
+  for (result->iterations = 0; result->iterations < options_.max_iterations;
+       result->iterations++)
+  {
+    if (cancel != NULL && cancel->load(std::memory_order_relaxed))
+      break;
+    if (!linearize())
+      return;
+
+    bool improved          = false;
+    double first_step_norm = HUGE_VAL; // least damped trial of this iteration
+    while (!improved && damping < kMaxDamping)
+    {
+      if (reduce(damping))
+      {
+        CholeskySolve(schur.data(), home_dim, home_step.data());
+        double step_norm = MaxAbs(home_step.data(), home_dim);
+        for (size_t h = 0; h < home_dim; h++)
+          new_home_values[h] = home_values[h] + home_step[h];
+        // Back substitution: dpj = -Hjj^-1 * gj - Hjj^-1 * Hjg * dg
+        for (size_t j = 0; j < samples_num; j++)
+        {
+          double pose_step[kPoseDim];
+          for (size_t a = 0; a < kPoseDim; a++)
+            pose_step[a] = -gradients[j * kPoseDim + a];
+          CholeskySolve(&factors[j * kPoseDim * kPoseDim], kPoseDim, pose_step);
+          const double* inv = &inv_coupling[j * kPoseDim * home_dim];
+          for (size_t a = 0; a < kPoseDim; a++)
+          {
+            for (size_t h = 0; h < home_dim; h++)
+              pose_step[a] -= inv[a * home_dim + h] * home_step[h];
+            new_poses[j][a] = poses[j][a] + pose_step[a];
+          }
+          step_norm = std::max(step_norm, MaxAbs(pose_step, kPoseDim));
+        }
+        if (first_step_norm == HUGE_VAL)
+          first_step_norm = step_norm;
+        if (eval_all(new_poses, new_home_values, &new_residuals))
+        {
+          const double new_cost = SquaredNorm(new_residuals);
+          if (new_cost < cost)
+          {
+            result->converged = cost - new_cost <= options_.tolerance * cost;
+            poses.swap(new_poses);
+            home_values.swap(new_home_values);
+            residuals.swap(new_residuals);
+            cost     = new_cost;
+            damping  = std::max(damping / kDampingScale, kDiffStep);
+            improved = true;
+            continue;
+          }
+        }
+      }
+      damping *= kDampingScale;
+    }
+    if (!improved)
+    {
+      // Cannot improve anymore: same test as SolvePose()
+      bool orthogonal = true;
+      for (size_t h = 0; h < home_dim; h++)
+      {
+        const double w = weights[h / cables_num];
+        orthogonal     = orthogonal && IsOrthogonal(home_gradient[h], w * w * samples_num,
+                                                cost, options_.gradient_tolerance);
+      }
+      for (size_t j = 0; j < samples_num; j++)
+        for (size_t a = 0; a < kPoseDim; a++)
+        {
+          const size_t k = j * kPoseDim + a;
+          orthogonal     = orthogonal && IsOrthogonal(gradients[k],
+                                                  hessians[k * kPoseDim + a], cost,
+                                                  options_.gradient_tolerance);
+        }
+      result->converged = orthogonal || first_step_norm <= options_.step_tolerance;
+    }
+    if (!improved || result->converged)
+      break;
+  }
+
+  result->init_angles.assign(home_values.begin(), home_values.begin() + cables_num);
+  result->init_lengths.assign(home_values.begin() + cables_num, home_values.end());
+  result->poses         = poses;
+  result->residual_norm = sqrt(cost);
+  result->residual_rms  = sqrt(cost / residuals.size());
+
+  // Standard deviation of home values from the covariance of the linearized problem,
+  // whose home block is the inverse of the undamped Schur complement, scaled by the
+  // residual variance.
+  result->init_angles_std.assign(cables_num, HUGE_VAL);
+  result->init_lengths_std.assign(cables_num, HUGE_VAL);
+  const size_t unknowns_num = home_dim + kPoseDim * samples_num;
+  if (residuals.size() <= unknowns_num || !linearize() || !reduce(0.0))
+    return;
+  const double variance = cost / (residuals.size() - unknowns_num);
+  for (size_t h = 0; h < home_dim; h++)
+  {
+    std::fill(home_step.begin(), home_step.end(), 0.0);
+    home_step[h] = 1.0;
+    CholeskySolve(schur.data(), home_dim, home_step.data());
+    const double std_dev = sqrt(variance * home_step[h]);
+    if (h < cables_num)
+      result->init_angles_std[h] = std_dev;
+    else
+      result->init_lengths_std[h - cables_num] = std_dev;
+  }
+}
+
+size_t HomingOptimizer::StaticResidualsNum() const
+{
+  return CablesNum() < kPoseDim ? kPoseDim - CablesNum() : 0;
+}
+
+void HomingOptimizer::CalcCables(const Pose& pose, CableState* cables) const
+{
+  const Mat3 rot      = RotTaitBryan(pose);
+  const Vec3 position = {{pose[0], pose[1], pose[2]}};
+  for (size_t i = 0; i < cables_.size(); i++)
+  {
+    const CableGeometry& cable = cables_[i];
+    CableState& state          = cables[i];
+    state.pos_PA_glob          = Product(rot, cable.pos_PA_loc);
+    const Vec3 pos_DA_glob = Diff(Sum(position, state.pos_PA_glob), cable.pos_OD_glob);
+    // Swivel angle and pulley versors
+    state.swivel_angle =
+      atan2(Dot(cable.vers_j, pos_DA_glob), Dot(cable.vers_i, pos_DA_glob));
+    const Vec3 vers_u = Sum(Scaled(cable.vers_i, cos(state.swivel_angle)),
+                            Scaled(cable.vers_j, sin(state.swivel_angle)));
+    // Tangent angle and cable versors
+    const double radius    = cable.pulley_radius;
+    const double u_DA      = Dot(vers_u, pos_DA_glob);
+    const double app       = Dot(cable.vers_k, pos_DA_glob) / u_DA;
+    const double tan_angle =
+      2.0 * atan(app + sqrt(1.0 - 2.0 * radius / u_DA + app * app));
+    const Vec3 vers_n =
+      Sum(Scaled(vers_u, cos(tan_angle)), Scaled(cable.vers_k, sin(tan_angle)));
+    state.vers_rho =
+      Diff(Scaled(vers_u, sin(tan_angle)), Scaled(cable.vers_k, cos(tan_angle)));
+    // Cable length, i.e. arc wound on the pulley plus straight segment
+    const Vec3 pos_BA_glob = Diff(pos_DA_glob, Scaled(Sum(vers_u, vers_n), radius));
+    state.length = radius * (M_PI - tan_angle) + sqrt(Dot(pos_BA_glob, pos_BA_glob));
+  }
+}
+
+void HomingOptimizer::CalcExtWrench(const Pose& pose, double* wrench) const
+{
+  const Mat3 rot = RotTaitBryan(pose);
+  const Vec3 force =
+    Sum(Scaled(options_.gravity, platform_mass_), Product(rot, ext_force_loc_));
+  const Vec3 torque =
+    Sum(Cross(Product(rot, pos_PG_loc_), force), Product(rot, ext_torque_loc_));
+  for (size_t i = 0; i < 3; i++)
+  {
+    wrench[i]     = force[i];
+    wrench[i + 3] = torque[i];
+  }
+}
+
+bool HomingOptimizer::CalcStaticResiduals(const Pose& pose, const CableState* cables,
+                                          double* residuals) const
+{
+  // With fewer cables than degrees of freedom, tensions are those balancing the first
+  // (actuated) directions of the external wrench, while the remaining (unactuated) ones
+  // must be balanced too at a static equilibrium.
+  const size_t cables_num = CablesNum();
+  if (cables_num >= kPoseDim)
+    return true;
+  double wrench[kPoseDim];
+  CalcExtWrench(pose, wrench);
+  double jacobian_t[kPoseDim * kPoseDim]; // transposed, i.e. a column per cable
+  for (size_t i = 0; i < cables_num; i++)
+  {
+    const Vec3 moment_dir = Cross(cables[i].pos_PA_glob, cables[i].vers_rho);
+    for (size_t k = 0; k < 3; k++)
+    {
+      jacobian_t[k * cables_num + i]       = cables[i].vers_rho[k];
+      jacobian_t[(k + 3) * cables_num + i] = moment_dir[k];
+    }
+  }
+  double tensions[kPoseDim];
+  double actuated_jacobian_t[kPoseDim * kPoseDim];
+  for (size_t k = 0; k < cables_num; k++)
+  {
+    tensions[k] = wrench[k];
+    for (size_t i = 0; i < cables_num; i++)
+      actuated_jacobian_t[k * cables_num + i] = jacobian_t[k * cables_num + i];
+  }
+  if (!SolveLinearSystem(actuated_jacobian_t, tensions, cables_num))
+    return false;
+  for (size_t k = cables_num; k < kPoseDim; k++)
+  {
+    residuals[k - cables_num] = -wrench[k];
+    for (size_t i = 0; i < cables_num; i++)
+      residuals[k - cables_num] += jacobian_t[k * cables_num + i] * tensions[i];
+  }
+  return AllFinite(residuals, kPoseDim - cables_num);
+}
+
+bool HomingOptimizer::CalcFitResiduals(const Pose& pose, const vect<double>& home_values,
+                                       const HomingSample& sample, CableState* cables,
+                                       double* residuals) const
+{
+  const size_t cables_num = CablesNum();
+  CalcCables(pose, cables);
+  for (size_t i = 0; i < cables_num; i++)
+  {
+    const double angle_err =
+      cables[i].swivel_angle - (home_values[i] + sample.pulley_angles[i]);
+    residuals[i] = options_.swivel_weight * remainder(angle_err, 2.0 * M_PI);
+    residuals[cables_num + i] =
+      options_.length_weight *
+      (cables[i].length - (home_values[cables_num + i] + sample.cable_lengths[i]));
+  }
+  return AllFinite(residuals, 2 * cables_num) &&
+         CalcStaticResiduals(pose, cables, &residuals[2 * cables_num]);
+}
+
+bool HomingOptimizer::FindHomePose(Pose* pose) const
+{
+  // Start right below the pulleys centroid, with a level platform
+  pose->fill(0.0);
+  const double gravity_norm = sqrt(Dot(options_.gravity, options_.gravity));
+  for (const CableGeometry& cable : cables_)
+    for (size_t k = 0; k < 3; k++)
+      (*pose)[k] += cable.pos_OD_glob[k] / CablesNum();
+  for (size_t k = 0; k < 3; k++)
+    (*pose)[k] += options_.home_drop * options_.gravity[k] / gravity_norm;
+
+  // Static equilibrium with all cables equally tensioned
+  vect<CableState> cables(CablesNum());
+  auto fun = [&](const Pose& p, double* residuals) {
+    CalcCables(p, cables.data());
+    CalcExtWrench(p, residuals);
+    for (size_t k = 0; k < kPoseDim; k++)
+      residuals[k] = -residuals[k];
+    for (const CableState& cable : cables)
+    {
+      const Vec3 moment_dir = Cross(cable.pos_PA_glob, cable.vers_rho);
+      for (size_t k = 0; k < 3; k++)
+      {
+        residuals[k] += options_.home_tension * cable.vers_rho[k];
+        residuals[k + 3] += options_.home_tension * moment_dir[k];
+      }
+    }
+    return AllFinite(residuals, kPoseDim);
+  };
+  return SolvePose(fun, kPoseDim, options_, pose);
+}
+
+void HomingOptimizer::PerturbPose(const size_t start_idx, Pose* pose) const
+{
+  if (start_idx == 0)
+    return;
+  // Seeded with start index, so that each starting point is repeatable
+  std::mt19937 generator(static_cast<std::mt19937::result_type>(start_idx));
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+  for (size_t k = 0; k < 3; k++)
+    (*pose)[k] += options_.start_position_spread * distribution(generator);
+  for (size_t k = 3; k < kPoseDim; k++)
+    (*pose)[k] += options_.start_angle_spread * distribution(generator);
+}
+
+bool HomingOptimizer::FindPose(const vect<double>& lengths, Pose* pose) const
+{
+  // Cable lengths and, if any, static equilibrium of unactuated directions
+  const size_t cables_num = CablesNum();
+  vect<CableState> cables(cables_num);
+  auto fun = [&](const Pose& p, double* residuals) {
+    CalcCables(p, cables.data());
+    for (size_t i = 0; i < cables_num; i++)
+      residuals[i] = cables[i].length - lengths[i];
+    return AllFinite(residuals, cables_num) &&
+           CalcStaticResiduals(p, cables.data(), &residuals[cables_num]);
+  };
+  return SolvePose(fun, cables_num + StaticResidualsNum(), options_, pose);
+}
@@ -7,6 +7,9 @@
 
 #include "homing/homing_proprioceptive.h"
 
+#include <QDateTime>
+#include <QDir>
+
 //------------------------------------------------------------------------------------//
 //--------- Homing Proprioceptive Data classes ---------------------------------------//
 //------------------------------------------------------------------------------------//
@@ -52,11 +55,14 @@ std::ostream& operator<<(std::ostream& stream, const HomingProprioceptiveHomeDat
 
 // For static constexpr passed by reference we need a dummy definition no matter what
 constexpr double HomingProprioceptive::kCutoffFreq_;
+constexpr size_t HomingProprioceptive::kNumMeasConfident_;
 constexpr char* HomingProprioceptive::kStatesStr[];
 
 HomingProprioceptive::HomingProprioceptive(QObject* parent, CableRobot* robot)
   : QObject(parent), StateMachine(ST_MAX_STATES), robot_ptr_(robot),
-    controller_(robot->GetRtCycleTimeNsec()), optimization_progess_timer_(this)
+    controller_(robot->GetRtCycleTimeNsec()),
+    uncoiling_controller_(robot->GetRtCycleTimeNsec()),
+    optimizer_thread_(this, robot->GetConfig(), robot->GetHomingOptimizerOptions())
 {
   // Initialize with default values
   num_meas_   = kNumMeasMin_;
@@ -64,17 +70,25 @@ HomingProprioceptive::HomingProprioceptive(QObject* parent, CableRobot* robot)
   ExternalEvent(ST_IDLE);
   prev_state_ = ST_IDLE;
   controller_.SetMotorTorqueSsErrTol(kTorqueSsErrTol_);
+  optimizer_thread_.SetCpus(robot_ptr_->GetWorkerCpus());
 
   // Setup connection to track robot status
-  active_actuators_id_ = robot_ptr_->GetActiveMotorsID();
+  active_actuators_id_    = robot_ptr_->GetActiveMotorsID();
+  active_actuators_index_ = robot_ptr_->GetActiveMotorsIndex();
   actuators_status_.resize(active_actuators_id_.size());
   connect(robot_ptr_, SIGNAL(actuatorStatus(ActuatorStatus)), this,
           SLOT(handleActuatorStatusUpdate(ActuatorStatus)));
   connect(this, SIGNAL(stopWaitingCmd()), robot_ptr_, SLOT(stopWaiting()));
 
-  // Setup timer for optimization progress
-  connect(&optimization_progess_timer_, SIGNAL(timeout()), this,
-          SLOT(updateOptimizationProgress()));
+  // Setup native homing optimization
+  connect(&optimizer_thread_, SIGNAL(resultsReady()), this,
+          SLOT(handleOptimizationResultsReady()));
+  connect(&optimizer_thread_, SIGNAL(estimateReady(HomingOptimizerResult, bool)), this,
+          SLOT(handleOptimizationEstimateReady(HomingOptimizerResult, bool)));
+  connect(&optimizer_thread_, SIGNAL(printToQConsole(QString)), this,
+          SIGNAL(printToQConsole(QString)));
+  connect(&optimizer_thread_, SIGNAL(progressUpdate(int, double)), this,
+          SIGNAL(optimizationProgress(int, double)));
 }
 
 HomingProprioceptive::~HomingProprioceptive()
@@ -82,8 +96,16 @@ HomingProprioceptive::~HomingProprioceptive()
   disconnect(robot_ptr_, SIGNAL(actuatorStatus(ActuatorStatus)), this,
              SLOT(handleActuatorStatusUpdate(ActuatorStatus)));
   disconnect(this, SIGNAL(stopWaitingCmd()), robot_ptr_, SLOT(stopWaiting()));
-  disconnect(&optimization_progess_timer_, SIGNAL(timeout()), this,
-             SLOT(updateOptimizationProgress()));
+  disconnect(&optimizer_thread_, SIGNAL(resultsReady()), this,
+             SLOT(handleOptimizationResultsReady()));
+  disconnect(&optimizer_thread_, SIGNAL(estimateReady(HomingOptimizerResult, bool)),
+             this, SLOT(handleOptimizationEstimateReady(HomingOptimizerResult, bool)));
+  disconnect(&optimizer_thread_, SIGNAL(printToQConsole(QString)), this,
+             SIGNAL(printToQConsole(QString)));
+  disconnect(&optimizer_thread_, SIGNAL(progressUpdate(int, double)), this,
+             SIGNAL(optimizationProgress(int, double)));
+  optimizer_thread_.Cancel();
+  optimizer_thread_.wait();
 }
 
 //--------- Public functions ---------------------------------------------------------//
@@ -111,16 +133,37 @@ bool HomingProprioceptive::IsCollectingData()
 ActuatorStatus HomingProprioceptive::GetActuatorStatus(const id_t id)
 {
   ActuatorStatus status;
-  for (size_t i = 0; i < active_actuators_id_.size(); i++)
+  const size_t idx = active_actuators_index_->Find(id);
+  if (idx == IdIndexMap::kNotFound)
+    return status;
+  qmutex_.lock();
+  status = actuators_status_[idx];
+  qmutex_.unlock();
+  return status;
+}
+
+bool HomingProprioceptive::LoadDataset(const QString& filepath)
+{
+  if (IsCollectingData() || GetCurrentState() == ST_OPTIMIZING)
   {
-    if (active_actuators_id_[i] != id)
-      continue;
-    qmutex_.lock();
-    status = actuators_status_[i];
-    qmutex_.unlock();
-    break;
+    emit printToQConsole("WARNING: Cannot replace homing measurements now");
+    return false;
   }
-  return status;
+  emit printToQConsole("Loading homing measurements from '" + filepath + "'...");
+  HomingDataset dataset;
+  if (!dataset.Load(filepath.toStdString()))
+  {
+    emit printToQConsole("ERROR: Invalid homing measurements file '" + filepath + "'");
+    return false;
+  }
+  if (dataset.ActuatorsID() != active_actuators_id_)
+  {
+    emit printToQConsole("ERROR: Measurements do not refer to current active actuators");
+    return false;
+  }
+  dataset_ = dataset;
+  emit printToQConsole(QString("%1 homing measurements loaded").arg(dataset_.Size()));
+  return true;
 }
 
 //--------- External events ----------------------------------------------------------//
@@ -246,44 +289,63 @@ void HomingProprioceptive::FaultReset()
 void HomingProprioceptive::handleActuatorStatusUpdate(
   const ActuatorStatus& actuator_status)
 {
-  for (size_t i = 0; i < active_actuators_id_.size(); i++)
+  const size_t idx = active_actuators_index_->Find(actuator_status.id);
+  if (idx == IdIndexMap::kNotFound)
+    return;
+  if (actuator_status.state == Actuator::ST_FAULT)
   {
-    if (active_actuators_id_[i] != actuator_status.id)
-      continue;
-    if (actuator_status.state == Actuator::ST_FAULT)
-    {
-      FaultTrigger();
-      return;
-    }
-    qmutex_.lock();
-    actuators_status_[i] = actuator_status;
-    qmutex_.unlock();
-    break;
+    FaultTrigger();
+    return;
   }
+  qmutex_.lock();
+  actuators_status_[idx] = actuator_status;
+  qmutex_.unlock();
 }
 
-void HomingProprioceptive::handleMatlabResultsReady()
+void HomingProprioceptive::handleOptimizationResultsReady()
 {
-  optimization_progess_timer_.stop();
-  // Read results from json file generated by matlab script
-  HomingProprioceptiveHomeData* home_data = new HomingProprioceptiveHomeData;
-  const QString results_location = QString(SRCDIR) + "matlab/homing/results.json";
-  if (ParseExtFile(results_location, home_data))
+  if (GetCurrentState() != ST_OPTIMIZING)
+    return; // optimization was aborted in the meanwhile
+
+  const HomingOptimizerResult& result = optimizer_thread_.GetResult();
+  if (result.converged)
   {
-    emit progressValue(100);
+    HomingProprioceptiveHomeData* home_data = new HomingProprioceptiveHomeData;
+    home_data->init_lengths                 = result.init_lengths;
+    home_data->init_angles                  = result.init_angles;
+    emit optimizationProgress(100, result.residual_rms);
     emit printToQConsole("Optimization complete");
     ExternalEvent(ST_HOME, home_data);
     return;
   }
-  delete home_data;
   emit printToQConsole("WARNING: Optimization failed");
   ExternalEvent(ST_ENABLED);
 }
 
-void HomingProprioceptive::updateOptimizationProgress()
+void HomingProprioceptive::handleOptimizationEstimateReady(
+  const HomingOptimizerResult& estimate, const bool& confident)
 {
-  optimization_progress_counter_ = std::min(optimization_progress_counter_ + 1, 95);
-  emit progressValue(optimization_progress_counter_);
+  if (!IsCollectingData() || estimate_confident_)
+    return;
+
+  if (estimate.init_lengths_std.empty())
+    return;
+  const double max_length_std =
+    *std::max_element(estimate.init_lengths_std.begin(), estimate.init_lengths_std.end());
+  const double max_angle_std =
+    *std::max_element(estimate.init_angles_std.begin(), estimate.init_angles_std.end());
+  emit printToQConsole(QString("Home estimate from %1 measurements: cable lengths ±%2 "
+                               "mm, pulley angles ±%3 mrad")
+                         .arg(estimate.poses.size())
+                         .arg(1e3 * max_length_std, 0, 'g', 3)
+                         .arg(1e3 * max_angle_std, 0, 'g', 3));
+  if (confident)
+  {
+    estimate_confident_ = true;
+    emit printToQConsole(QString("Home estimate is confident: next cables will be swept "
+                                 "in %1 steps only")
+                           .arg(std::min(num_meas_, kNumMeasConfident_)));
+  }
 }
 
 //--------- States actions -----------------------------------------------------------//
@@ -325,6 +387,7 @@ STATE_DEFINE(HomingProprioceptive, Idle, NoEventData)
   prev_state_ = ST_IDLE;
   emit stateChanged(ST_IDLE);
 
+  optimizer_thread_.Cancel(); // in case optimization was aborted
   if (robot_ptr_->AnyMotorEnabled())
     robot_ptr_->DisableMotors();
 
@@ -381,6 +444,11 @@ STATE_DEFINE(HomingProprioceptive, StartUp, HomingProprioceptiveStartData)
   max_torques_ = data->max_torques;
   torques_.resize(num_meas_);
   reg_pos_.resize(num_meas_);
+  dataset_.Reset(active_actuators_id_, num_tot_meas_);
+  optimizer_thread_.Cancel();
+  optimizer_thread_.wait();
+  optimizer_thread_.ResetEstimate();
+  estimate_confident_ = false;
 
   RetVal ret = RetVal::OK;
   robot_ptr_->SetController(&controller_);
@@ -427,6 +495,7 @@ GUARD_DEFINE(HomingProprioceptive, GuardSwitch, NoEventData)
   }
   pthread_mutex_unlock(&robot_ptr_->Mutex());
 
+  SaveDataset();
   InternalEvent(ST_ENABLED);
   emit acquisitionComplete();
   return false;
@@ -439,13 +508,18 @@ STATE_DEFINE(HomingProprioceptive, SwitchCable, NoEventData)
   PrintStateTransition(prev_state_, ST_SWITCH_CABLE);
   prev_state_ = ST_SWITCH_CABLE;
 
+  // Once home estimate is confident, every further cable is still excited over the full
+  // torque range, only in fewer steps, so that it is not left out of the final fit.
+  cable_num_meas_ = estimate_confident_ ? std::min(num_meas_, kNumMeasConfident_)
+                                        : num_meas_;
   // Compute sequence of torque setpoints for i-th actuator
   qint16 delta_torque =
     (max_torques_[working_actuator_idx_] - init_torques_[working_actuator_idx_]) /
-    (static_cast<qint16>(num_meas_) - 1);
-  for (quint8 i = 0; i < num_meas_ - 1; ++i)
+    (static_cast<qint16>(cable_num_meas_) - 1);
+  for (quint8 i = 0; i < cable_num_meas_ - 1; ++i)
     torques_[i] = init_torques_[working_actuator_idx_] + i * delta_torque;
-  torques_.back() = max_torques_[working_actuator_idx_]; // last element = max torque
+  // Last element = max torque
+  torques_[cable_num_meas_ - 1] = max_torques_[working_actuator_idx_];
 
   // Setup first setpoint of the sequence
   pthread_mutex_lock(&robot_ptr_->Mutex());
@@ -483,7 +557,7 @@ STATE_DEFINE(HomingProprioceptive, Coiling, NoEventData)
   PrintStateTransition(prev_state_, ST_COILING);
   prev_state_ = ST_COILING;
 
-  if (meas_step_ == num_meas_)
+  if (meas_step_ == cable_num_meas_)
   {
     InternalEvent(ST_UNCOILING);
     return;
@@ -516,13 +590,14 @@ STATE_DEFINE(HomingProprioceptive, Uncoiling, NoEventData)
   PrintStateTransition(prev_state_, ST_UNCOILING);
   prev_state_ = ST_UNCOILING;
 
-  if (meas_step_ == (2 * num_meas_ - 1))
+  if (meas_step_ == (2 * cable_num_meas_ - 1))
   {
     // At the end of uncoiling phase, restore torque control before moving to next cable
     pthread_mutex_lock(&robot_ptr_->Mutex());
     controller_.SetMode(ControlMode::MOTOR_TORQUE);
     controller_.SetMotorTorqueTarget(torques_.front());
     pthread_mutex_unlock(&robot_ptr_->Mutex());
+    robot_ptr_->SetController(&controller_);
     if (robot_ptr_->WaitUntilTargetReached() == RetVal::OK &&
         WaitUntilPlatformSteady() == RetVal::OK)
     {
@@ -534,13 +609,18 @@ STATE_DEFINE(HomingProprioceptive, Uncoiling, NoEventData)
     return;
   }
 
-  const ulong kOffset = num_tot_meas_ / active_actuators_id_.size() - 1;
+  const ulong kOffset = 2 * cable_num_meas_ - 2;
   // Uncoiling done in position control to return to previous steps. In torque control
-  // this wouldn't happen due to friction.
+  // this wouldn't happen due to friction. Only working cable is targeted, all others are
+  // left in torque control.
   pthread_mutex_lock(&robot_ptr_->Mutex());
-  controller_.SetMode(ControlMode::MOTOR_POSITION);
-  controller_.SetMotorPosTarget(reg_pos_[kOffset - meas_step_], true, 3.0);
+  uncoiling_controller_.SetMotorsID(
+    vect<id_t>(1, active_actuators_id_[working_actuator_idx_]));
+  uncoiling_controller_.SetMode(ControlMode::MOTOR_POSITION);
+  uncoiling_controller_.SetMotorsPosTarget(
+    vect<int32_t>(1, reg_pos_[kOffset - meas_step_]), 3.0);
   pthread_mutex_unlock(&robot_ptr_->Mutex());
+  robot_ptr_->SetController(&uncoiling_controller_);
   emit printToQConsole(
     QString("Next position setpoint = %1").arg(reg_pos_[kOffset - meas_step_]));
 
@@ -567,16 +647,12 @@ STATE_DEFINE(HomingProprioceptive, Optimizing, NoEventData)
   PrintStateTransition(prev_state_, ST_OPTIMIZING);
   prev_state_ = ST_OPTIMIZING;
   emit stateChanged(ST_OPTIMIZING);
-  // Run matlab optimization script from shell command
-  const QString script_loc    = QString(SRCDIR) + "matlab/homing/ExternalHomingScript.m";
-  MatlabThread* matlab_thread = new MatlabThread(this, script_loc);
-  connect(matlab_thread, SIGNAL(resultsReady()), this, SLOT(handleMatlabResultsReady()));
-  connect(matlab_thread, SIGNAL(printToQConsole(QString)), this->parent(),
-          SLOT(appendText2Browser(QString)));
-  connect(matlab_thread, &MatlabThread::finished, matlab_thread, &QObject::deleteLater);
-  matlab_thread->start();
-  optimization_progress_counter_ = 0;
-  optimization_progess_timer_.start(kOptProgressIntervalMsec_);
+  // Run native optimization on measurements collected in memory, dropping any
+  // incremental estimate still in progress
+  optimizer_thread_.Cancel();
+  optimizer_thread_.wait();
+  optimizer_thread_.SetSamples(dataset_.Samples());
+  optimizer_thread_.start();
 }
 
 STATE_DEFINE(HomingProprioceptive, Home, HomingProprioceptiveHomeData)
@@ -591,9 +667,10 @@ STATE_DEFINE(HomingProprioceptive, Home, HomingProprioceptiveHomeData)
   if (robot_ptr_->GoHome()) // (position control)
   {
     // ...which is done here.
-    for (id_t motor_id : robot_ptr_->GetActiveMotorsID())
-      robot_ptr_->UpdateHomeConfig(motor_id, data->init_lengths[motor_id],
-                                   data->init_angles[motor_id]);
+    // Homing data follow active actuators order
+    for (size_t i = 0; i < active_actuators_id_.size(); i++)
+      robot_ptr_->UpdateHomeConfig(active_actuators_id_[i], data->init_lengths[i],
+                                   data->init_angles[i]);
     emit homingComplete();
   }
   else
@@ -608,68 +685,101 @@ STATE_DEFINE(HomingProprioceptive, Fault, NoEventData)
   PrintStateTransition(prev_state_, ST_FAULT);
   prev_state_ = ST_FAULT;
   emit stateChanged(ST_FAULT);
+
+  optimizer_thread_.Cancel(); // in case optimization was aborted
 }
 
 //--------- Private functions --------------------------------------------------------//
 
 RetVal HomingProprioceptive::WaitUntilPlatformSteady()
 {
-  // Compute these once for all
-  static constexpr size_t kBuffSize =
-    static_cast<size_t>(kBufferingTimeSec_ / CableRobot::kCycleWaitTimeSec);
+  // Pulley angles are sampled at every RT cycle
+  const double sampling_time_sec = robot_ptr_->GetRtCycleTimeNsec() * 1e-9;
+  const size_t buff_size = static_cast<size_t>(kBufferingTimeSec_ / sampling_time_sec);
+  const size_t min_buff_size =
+    static_cast<size_t>(kMinSteadyTimeSec_ / sampling_time_sec);
   // LP filters setup
-  static std::vector<grabnum::LowPassFilter> lp_filters(
-    active_actuators_id_.size(),
-    grabnum::LowPassFilter(kCutoffFreq_, CableRobot::kCycleWaitTimeSec));
-  for (size_t i = 0; i < active_actuators_id_.size(); i++)
-    lp_filters[i].Reset();
+  std::vector<grabnum::LowPassFilter> lp_filters(
+    active_actuators_id_.size(), grabnum::LowPassFilter(kCutoffFreq_, sampling_time_sec));
 
   // Init
+  RetVal ret    = RetVal::OK;
   bool swinging = true;
-  std::vector<RingBufferD> pulleys_angles(active_actuators_id_.size(),
-                                          RingBufferD(kBuffSize));
+  std::vector<SlidingWindowStats> pulleys_angles(active_actuators_id_.size(),
+                                                 SlidingWindowStats(buff_size));
+  ActuatorSample samples[kSamplesBatchSize_];
+  robot_ptr_->StreamActuatorSamples(true);
   grabrt::ThreadClock clock(grabrt::Sec2NanoSec(CableRobot::kCycleWaitTimeSec));
   // Start waiting
   while (swinging)
   {
+    QCoreApplication::processEvents();
+    qmutex_.lock();
+    // Check if external abort signal is received
+    const bool abort = stop_cmd_recv_ || disable_cmd_recv_;
+    qmutex_.unlock();
+    if (abort)
+    {
+      ret = RetVal::EINT;
+      break;
+    }
+    // Process all samples streamed by the RT thread since last check
+    swinging = false;
     for (size_t i = 0; i < active_actuators_id_.size(); i++)
     {
-      QCoreApplication::processEvents();
-      qmutex_.lock();
-      // Check if external abort signal is received
-      if (stop_cmd_recv_ || disable_cmd_recv_)
-      {
-        qmutex_.unlock();
-        return RetVal::EINT;
-      }
-      pulleys_angles[i].Add(
-        lp_filters[i].Filter(actuators_status_[i].pulley_angle)); // add filtered angle
-      qmutex_.unlock();
-      if (!pulleys_angles[i].IsFull()) // wait at least until buffer is full
-        continue;
-      // Condition to detect steadyness
-      swinging = grabnum::Std(pulleys_angles[i].Data()) > kMaxAngleDeviation_;
-      if (swinging)
-        break;
+      SlidingWindowStats& angle_stats = pulleys_angles[i];
+      size_t samples_num;
+      while ((samples_num = robot_ptr_->PopActuatorSamples(i, samples,
+                                                           kSamplesBatchSize_)) > 0)
+        for (size_t k = 0; k < samples_num; k++)
+        {
+          const double angle = lp_filters[i].Filter(samples[k].status.pulley_angle);
+          // A clear jump means pulley is still moving: forget older samples
+          if (angle_stats.Size() > 0 &&
+              fabs(angle - angle_stats.Mean()) > kMotionAngleThreshold_)
+            angle_stats.Reset();
+          angle_stats.Add(angle);
+        }
+      // Condition to detect steadyness: enough samples, neither scattered nor drifting
+      swinging = swinging || angle_stats.Size() < min_buff_size ||
+                 angle_stats.Std() > kMaxAngleDeviation_ ||
+                 fabs(angle_stats.Drift()) > kMaxAngleDeviation_;
     }
+    if (!swinging)
+      break;
     // Check if timeout expired (safety feature to prevent hanging in forever)
     if (clock.ElapsedFromStart() > CableRobot::kMaxWaitTimeSec)
     {
       emit printToQConsole(
         "WARNING: Platform is taking too long to stabilize: operation aborted");
-      return RetVal::ETIMEOUT;
+      ret = RetVal::ETIMEOUT;
+      break;
     }
     clock.WaitUntilNext();
   }
-  return RetVal::OK;
+  robot_ptr_->StreamActuatorSamples(false);
+  if (ret == RetVal::OK)
+    emit printToQConsole(
+      QString("Platform steady after %1 sec").arg(clock.ElapsedFromStart(), 0, 'f', 2));
+  return ret;
 }
 
 void HomingProprioceptive::DumpMeasAndMoveNext()
 {
   robot_ptr_->CollectMeas();
-  emit printToQConsole("Measurements collected");
+  if (dataset_.Add(working_actuator_idx_, robot_ptr_->GetMeas()))
+    emit printToQConsole("Measurements collected");
+  else
+    emit printToQConsole("WARNING: Inconsistent measurements discarded");
+  // Refine home estimate in background, unless still busy with previous measurements
+  if (!optimizer_thread_.isRunning())
+  {
+    optimizer_thread_.SetIncrementalSamples(dataset_.Samples());
+    optimizer_thread_.start();
+  }
+  // Data log is only kept for external tools: it is written asynchronously and nothing
+  // in the homing procedure reads it back
   robot_ptr_->DumpMeas();
-  emit printToQConsole("Measurements dumped onto log file");
   meas_step_++;
   double normalized_value = round(
     100. * (static_cast<double>(working_actuator_idx_) / active_actuators_id_.size() +
@@ -715,6 +825,21 @@ bool HomingProprioceptive::ParseExtFile(const QString& filepath,
   return true;
 }
 
+void HomingProprioceptive::SaveDataset()
+{
+  const std::string& dirname = robot_ptr_->GetHomingDatasetDir();
+  if (dirname.empty())
+    return;
+  const QDir dir(QString::fromStdString(dirname));
+  const QString filename = dir.filePath(
+    QDateTime::currentDateTime().toString("'homing_'yyyyMMdd_hhmmss'.bin'"));
+  dir.mkpath(".");
+  if (dataset_.Save(filename.toStdString()))
+    emit printToQConsole("Homing measurements saved onto " + filename);
+  else
+    emit printToQConsole("WARNING: Could not save homing measurements onto " + filename);
+}
+
 void HomingProprioceptive::PrintStateTransition(const States current_state,
                                                 const States new_state) const
 {
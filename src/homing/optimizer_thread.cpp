@@ -0,0 +1,76 @@
+/**
+ * @file optimizer_thread.cpp
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief This file includes definitions of class present in optimizer_thread.h.
+ */
+
+#include "homing/optimizer_thread.h"
+
+#include <QElapsedTimer>
+
+#include "utils/rt_profile.h"
+
+void OptimizerThread::SetSamples(const vect<HomingSample>& samples)
+{
+  samples_     = samples;
+  incremental_ = false;
+  cancel_.store(false);
+}
+
+void OptimizerThread::SetIncrementalSamples(const vect<HomingSample>& samples)
+{
+  samples_     = samples;
+  incremental_ = true;
+  cancel_.store(false);
+}
+
+void OptimizerThread::ResetEstimate() { estimate_ = HomingOptimizerResult(); }
+
+void OptimizerThread::run()
+{
+  if (!cpus_.empty())
+    SetThreadCpus(pthread_self(), cpus_); // best effort, optimization works anyway
+
+  if (incremental_)
+    RunIncremental();
+  else
+    RunMultiStart();
+}
+
+void OptimizerThread::RunMultiStart()
+{
+  const size_t starts_num  = optimizer_.GetOptions().starts_num;
+  const size_t threads_num = static_cast<size_t>(QThread::idealThreadCount());
+  emit printToQConsole(QString("Running homing optimization on %1 measurements of %2 "
+                               "cables, from %3 starting points on %4 threads")
+                         .arg(samples_.size())
+                         .arg(optimizer_.CablesNum())
+                         .arg(starts_num)
+                         .arg(threads_num));
+  QElapsedTimer timer;
+  timer.start();
+  // Invoked by worker threads, one at a time
+  auto progress_cb = [&](const size_t completed_num, const HomingOptimizerResult& best) {
+    emit progressUpdate(static_cast<int>(100 * completed_num / starts_num),
+                        best.residual_rms);
+  };
+  result_ = optimizer_.OptimizeMultiStart(samples_, threads_num, &cancel_, progress_cb);
+  emit printToQConsole(QString("Homing optimization completed in %1 ms: best start is "
+                               "#%2, after %3 iterations, residual RMS = %4")
+                         .arg(timer.elapsed())
+                         .arg(result_.start_idx)
+                         .arg(result_.iterations)
+                         .arg(result_.residual_rms));
+  emit resultsReady();
+}
+
+void OptimizerThread::RunIncremental()
+{
+  result_ = optimizer_.Refine(samples_, estimate_, &cancel_);
+  if (cancel_.load())
+    return; // partial outcome, do not use it as next warm start
+  const bool confident = optimizer_.IsConfident(result_, estimate_);
+  estimate_            = result_;
+  emit estimateReady(estimate_, confident);
+}
@@ -1,15 +1,21 @@
 #include <QApplication>
 #include <QtDebug>
+#include <signal.h>
 
 #include "gui/login_window.h"
+#include "homing/optimizer_thread.h"
 #include "lib/easyloggingpp/src/easylogging++.h"
 #include "utils/easylog_wrapper.h"
+#include "utils/rt_timing.h"
 
 INITIALIZE_EASYLOGGINGPP
 
 // static el::Logger *logger = el::Loggers::getLogger("default");
 // static LogBuffer buffer(logger);
 
+// Dump RT timing statistics on stdout upon request, e.g. `kill -USR1 <pid>`
+static void RtTimingStatsDumpHandler(int) { RtTimingStats::RequestDump(); }
+
 int main(int argc, char* argv[])
 {
   START_EASYLOGGINGPP(argc, argv);
@@ -20,8 +26,15 @@ int main(int argc, char* argv[])
   qRegisterMetaType<grabec::GSWDriveInPdos>("grabec::GSWDriveInPdos");
   qRegisterMetaType<Bitfield8>("Bitfield8");
   qRegisterMetaType<id_t>("id_t");
+  qRegisterMetaType<HomingOptimizerResult>("HomingOptimizerResult");
   CLOG(INFO, "event") << "App START";
 
+  struct sigaction sig_action;
+  sigemptyset(&sig_action.sa_mask);
+  sig_action.sa_flags   = SA_RESTART;
+  sig_action.sa_handler = RtTimingStatsDumpHandler;
+  sigaction(SIGUSR1, &sig_action, NULL);
+
   LoginWindow w;
   w.show();
   CLOG(INFO, "event") << "Prompt login window";
@@ -0,0 +1,77 @@
+/**
+ * @file actuators_core.cpp
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing definitions of functions and class declared in
+ * actuators_core.h.
+ */
+
+#include "robot/actuators_core.h"
+
+// Common numbers of actuators, i.e. planar and spatial robots
+template class ActuatorsCoreFixed<3>;
+template class ActuatorsCoreFixed<4>;
+template class ActuatorsCoreFixed<6>;
+template class ActuatorsCoreFixed<8>;
+
+//--------- Public functions ---------------------------------------------------------//
+
+void ActuatorsCoreBase::ApplyCtrlActions(const ControlActions& ctrl_actions,
+                                         const IdIndexMap& index_map,
+                                         vect<ControlAction>* applied_ctrl_actions)
+{
+  for (const ControlAction& ctrl_action : ctrl_actions)
+  {
+    // Safety check to see if given motor id is valid
+    const size_t idx = index_map.Find(ctrl_action.motor_id);
+    if (idx == IdIndexMap::kNotFound)
+      continue;
+
+    Actuator* actuator_ptr = actuators_ptrs_[idx];
+    if (!actuator_ptr->IsEnabled()) // safety check
+      continue;
+    (*applied_ctrl_actions)[idx] = ctrl_action;
+
+    switch (ctrl_action.ctrl_mode)
+    {
+      case CABLE_LENGTH:
+        actuator_ptr->SetCableLength(ctrl_action.cable_length);
+        break;
+      case MOTOR_POSITION:
+        actuator_ptr->SetMotorPos(ctrl_action.motor_position);
+        break;
+      case MOTOR_SPEED:
+        actuator_ptr->SetMotorSpeed(ctrl_action.motor_speed);
+        break;
+      case MOTOR_TORQUE:
+        actuator_ptr->SetMotorTorque(ctrl_action.motor_torque);
+        break;
+      case NONE:
+        break;
+    }
+  }
+}
+
+void ActuatorsCoreDynamic::UpdateState(ActuatorsState* state)
+{
+  for (size_t i = 0; i < actuators_ptrs_.size(); i++)
+    actuators_ptrs_[i]->LoadCounts(i, state);
+  state->ConvertCounts();
+}
+
+ActuatorsCoreBase* MakeActuatorsCore(const vect<Actuator*>& actuators_ptrs)
+{
+  switch (actuators_ptrs.size())
+  {
+    case 3:
+      return new ActuatorsCoreFixed<3>(actuators_ptrs);
+    case 4:
+      return new ActuatorsCoreFixed<4>(actuators_ptrs);
+    case 6:
+      return new ActuatorsCoreFixed<6>(actuators_ptrs);
+    case 8:
+      return new ActuatorsCoreFixed<8>(actuators_ptrs);
+    default:
+      return new ActuatorsCoreDynamic(actuators_ptrs);
+  }
+}
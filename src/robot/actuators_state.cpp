@@ -0,0 +1,67 @@
+/**
+ * @file actuators_state.cpp
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing definitions of functions and class declared in
+ * actuators_state.h.
+ */
+
+#include "robot/actuators_state.h"
+
+//--------- Public functions ---------------------------------------------------------//
+
+void ActuatorsState::Setup(const std::vector<id_t>& ids)
+{
+  const size_t size = ids.size();
+
+  ids_ = ids;
+  op_modes_.assign(size, 0);
+  states_.assign(size, 0);
+  motor_positions_.assign(size, 0);
+  motor_speeds_.assign(size, 0);
+  motor_torques_.assign(size, 0);
+  aux_positions_.assign(size, 0);
+  cable_lengths_.assign(size, 0.0);
+  pulley_angles_.assign(size, 0.0);
+
+  motor_home_positions_.assign(size, 0);
+  home_lengths_.assign(size, 0.0);
+  counts_to_length_.assign(size, 0.0);
+  aux_home_positions_.assign(size, 0);
+  home_angles_.assign(size, 0.0);
+  counts_to_angle_.assign(size, 0.0);
+}
+
+void ActuatorsState::SetCalibration(const size_t slot, const double counts_to_length,
+                                    const double counts_to_angle)
+{
+  counts_to_length_[slot] = counts_to_length;
+  counts_to_angle_[slot]  = counts_to_angle;
+}
+
+void ActuatorsState::SetHomeConfig(const size_t slot, const int32_t motor_home_pos,
+                                   const double home_length, const int32_t aux_home_pos,
+                                   const double home_angle)
+{
+  motor_home_positions_[slot] = motor_home_pos;
+  home_lengths_[slot]         = home_length;
+  aux_home_positions_[slot]   = aux_home_pos;
+  home_angles_[slot]          = home_angle;
+}
+
+void ActuatorsState::ConvertCounts()
+{
+  // Plain loop over contiguous arrays, with no calls nor branches, so that it is
+  // vectorized. See Winch::UpdateConfig() and PulleysSystem::UpdateConfig().
+  for (size_t i = 0; i < ids_.size(); i++)
+    ConvertSlot(i);
+}
+
+ActuatorStatus ActuatorsState::GetStatus(const size_t slot) const
+{
+  ActuatorStatus status(ids_[slot], op_modes_[slot], motor_positions_[slot],
+                        motor_speeds_[slot], motor_torques_[slot], cable_lengths_[slot],
+                        aux_positions_[slot], pulley_angles_[slot]);
+  status.state = states_[slot];
+  return status;
+}
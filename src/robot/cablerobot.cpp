@@ -7,19 +7,55 @@
 
 #include "robot/cablerobot.h"
 
+#include <QDateTime>
+#include <QDir>
+#include <QFileInfo>
+
+#include <iostream>
+
 constexpr double CableRobot::kMaxWaitTimeSec;
 constexpr double CableRobot::kCycleWaitTimeSec;
 constexpr char* CableRobot::kStatesStr[];
 
-CableRobot::CableRobot(QObject* parent, const grabcdpr::Params& config)
-  : QObject(parent), StateMachine(ST_MAX_STATES), platform_(grabcdpr::TILT_TORSION),
-    log_buffer_(el::Loggers::getLogger("data")), prev_state_(ST_MAX_STATES)
+CableRobot::CableRobot(QObject* parent, const grabcdpr::Params& config,
+                       const AppSettings& settings /*= AppSettings()*/)
+  : QObject(parent), StateMachine(ST_MAX_STATES), config_(config),
+    platform_(grabcdpr::TILT_TORSION), forward_kinematics_(config, ANGLES_TILT_TORSION),
+    log_buffer_(el::Loggers::getLogger("data"), 2048, OverflowPolicy::BLOCK),
+    streaming_actuator_samples_(false), prev_state_(ST_MAX_STATES)
 {
   PrintStateTransition(prev_state_, ST_IDLE);
   prev_state_ = ST_IDLE;
 
   cdpr_status_.platform = &platform_;
 
+  // Harden real time execution as configured and flag any mismatch with the system
+  rt_profile_ = settings.rt_profile;
+  CLOG(INFO, "event") << RtProfileReport(rt_profile_);
+  for (const std::string& warning : CheckRtProfile(rt_profile_))
+    CLOG(WARNING, "event") << "RT profile: " << warning;
+  if (rt_profile_.lock_memory && !LockProcessMemory())
+    CLOG(WARNING, "event") << "Could not lock process memory";
+  if (rt_profile_.prefault_heap_size > 0)
+    PrefaultHeap(rt_profile_.prefault_heap_size);
+  if (!rt_profile_.gui_cpus.empty())
+  {
+    // Threads started by the GUI one inherit its CPUs, so the others must be explicitly
+    // given back the CPUs the process started on, unless configured otherwise.
+    if (GetThreadCpus(pthread_self(), &worker_cpus_))
+    {
+      if (rt_profile_.rt_cpus.empty())
+        rt_profile_.rt_cpus = worker_cpus_;
+      if (rt_profile_.log_cpus.empty())
+        rt_profile_.log_cpus = worker_cpus_;
+    }
+    else
+      CLOG(WARNING, "event") << "Could not read process CPUs";
+    if (!SetThreadCpus(pthread_self(), rt_profile_.gui_cpus))
+      CLOG(WARNING, "event") << "Could not restrict GUI thread to CPUs "
+                             << FormatCpuList(rt_profile_.gui_cpus);
+  }
+
   // Setup EtherCAT network
   max_shutdown_wait_time_sec_ = 3.0; // [sec]
   quint8 slave_pos            = 0;
@@ -43,26 +79,81 @@ CableRobot::CableRobot(QObject* parent, const grabcdpr::Params& config)
               SLOT(forwardPrintToQConsole(QString)));
     }
   }
+  // Dense index of active actuators, shared with controllers and apps
+  active_actuators_index_ = std::make_shared<const IdIndexMap>(active_actuators_id_);
+
   num_slaves_ = slaves_ptrs_.size();
   for (grabec::EthercatSlave* slave_ptr : slaves_ptrs_)
     num_domain_elements_ += slave_ptr->GetDomainEntriesNum();
+  if (settings.ethercat_backend == ETHERCAT_SIMULATED)
+    SetupSimNetwork(config, settings.sim_drive_params);
+
+  // Setup RT cycle timing instrumentation
+  rt_timing_.Setup(GetRtCycleTimeNsec(), slaves_ptrs_.size());
+  overrun_policy_.Setup(GetRtCycleTimeNsec(), settings.overrun_budget);
+
+  // Setup state of active actuators, updated at every cycle without allocations
+  actuators_state_.Setup(active_actuators_id_);
+  for (size_t i = 0; i < active_actuators_ptrs_.size(); i++)
+    active_actuators_ptrs_[i]->LoadCalibration(i, &actuators_state_);
+  // Actuators number is fixed from now on: pick the matching RT core once and for all
+  actuators_core_.reset(MakeActuatorsCore(active_actuators_ptrs_));
+
+  // Setup lock-free snapshot of actuators state (sized once, never reallocated)
+  actuators_snapshot_.Unsafe().actuators.resize(active_actuators_id_.size());
+  for (size_t i = 0; i < active_actuators_id_.size(); i++)
+    actuators_snapshot_.Unsafe().actuators[i].status.id = active_actuators_id_[i];
+
+  // Setup per-cycle actuator samples streaming (off until requested)
+  const size_t samples_capacity =
+    static_cast<size_t>(kActuatorSamplesBufferSec_ * 1e9 / GetRtCycleTimeNsec());
+  for (size_t i = 0; i < active_actuators_id_.size(); i++)
+    actuator_samples_.emplace_back(new SpscRing<ActuatorSample>(
+      samples_capacity, OverflowPolicy::OVERWRITE_OLDEST));
+
+  // Setup control actions buffer, so that control step never allocates memory
+  ctrl_actions_.SetCapacity(active_actuators_id_.size());
 
   // Setup data logging
   meas_.resize(active_actuators_id_.size());
+  if (settings.data_log_format == DATA_LOG_BINARY)
+  {
+    const QString filename = QString::fromStdString(settings.data_log_binary_filename);
+    QDir().mkpath(QFileInfo(filename).absolutePath());
+    if (!log_buffer_.SetBinaryOutput(settings.data_log_binary_filename))
+      CLOG(WARNING, "event") << "Could not open binary data log file "
+                             << settings.data_log_binary_filename
+                             << ": falling back to text format";
+  }
   connect(this, SIGNAL(sendMsg(QByteArray)), &log_buffer_, SLOT(collectMsg(QByteArray)));
+  log_buffer_.SetCpus(rt_profile_.log_cpus);
   log_buffer_.start();
 
+  // Setup continuous telemetry recording (off until requested)
+  telemetry_dir_ = settings.telemetry_dir;
+  telemetry_recorder_.SetCpus(worker_cpus_);
+  applied_ctrl_actions_.resize(active_actuators_id_.size());
+  homing_dataset_dir_ = settings.homing_dataset_dir; // homing snapshots, off if empty
+  homing_optimizer_options_ = settings.homing_optimizer;
+
   // Setup timers for components' status update
   motor_status_timer_ = new QTimer(this);
   connect(motor_status_timer_, SIGNAL(timeout()), this, SLOT(emitMotorStatus()));
-  active_actuators_status_.resize(active_actuators_id_.size());
   actuator_status_timer_ = new QTimer(this);
   connect(actuator_status_timer_, SIGNAL(timeout()), this, SLOT(emitActuatorStatus()));
+
+  // Setup timer to serve external dump requests of RT timing statistics (always on)
+  rt_stats_dump_timer_ = new QTimer(this);
+  connect(rt_stats_dump_timer_, SIGNAL(timeout()), this,
+          SLOT(dumpRtTimingStatsOnRequest()));
+  connect(rt_stats_dump_timer_, SIGNAL(timeout()), this, SLOT(checkOverrunPolicy()));
+  rt_stats_dump_timer_->start(kRtStatsDumpPollIntervalMsec_);
 }
 
 CableRobot::~CableRobot()
 {
   // Close data logging
+  telemetry_recorder_.Stop();
   log_buffer_.Stop();
   disconnect(this, SIGNAL(sendMsg(QByteArray)), &log_buffer_,
              SLOT(collectMsg(QByteArray)));
@@ -73,9 +164,20 @@ CableRobot::~CableRobot()
   disconnect(actuator_status_timer_, SIGNAL(timeout()), this, SLOT(emitActuatorStatus()));
   delete motor_status_timer_;
   delete actuator_status_timer_;
+  rt_stats_dump_timer_->stop();
+  disconnect(rt_stats_dump_timer_, SIGNAL(timeout()), this,
+             SLOT(dumpRtTimingStatsOnRequest()));
+  disconnect(rt_stats_dump_timer_, SIGNAL(timeout()), this, SLOT(checkOverrunPolicy()));
+  delete rt_stats_dump_timer_;
 
   // Stop RT thread before removing slaves
-  thread_rt_.Stop();
+  if (IsSimulated())
+  {
+    StopSimNetwork();
+    delete sim_network_;
+  }
+  else
+    thread_rt_.Stop();
 
   // Delete robot components (i.e. ethercat slaves)
 #if INCLUDE_EASYCAT
@@ -95,24 +197,81 @@ CableRobot::~CableRobot()
 
 //--------- Public Functions --------------------------------------------------------//
 
+void CableRobot::StartNetwork()
+{
+  rt_profile_applied_.store(false, std::memory_order_relaxed); // new RT thread
+  if (IsSimulated())
+    StartSimNetwork();
+  else
+    Start();
+}
+
+void CableRobot::ResetNetwork()
+{
+  rt_profile_applied_.store(false, std::memory_order_relaxed); // possibly new RT thread
+  if (IsSimulated())
+  {
+    StopSimNetwork();
+    StartSimNetwork();
+  }
+  else
+    Reset();
+}
+
 const ActuatorStatus CableRobot::GetActuatorStatus(const id_t motor_id)
 {
+  ActuatorStatus status;
+  const size_t active_idx = active_actuators_index_->Find(motor_id);
+  if (active_idx != IdIndexMap::kNotFound)
+  {
+    actuators_snapshot_.Read([&](const ActuatorsSnapshot& snapshot) {
+      status = snapshot.actuators[active_idx].status;
+    });
+    return status;
+  }
+  // Inactive actuators are not published by the RT thread.
   pthread_mutex_lock(&mutex_);
-  ActuatorStatus status = actuators_ptrs_[motor_id]->GetStatus();
+  status = actuators_ptrs_[motor_id]->GetStatus();
   pthread_mutex_unlock(&mutex_);
   return status;
 }
 
+uint64_t CableRobot::GetActuatorsSnapshot(ActuatorsSnapshot* snapshot) const
+{
+  return actuators_snapshot_.Load(snapshot);
+}
+
+uint64_t CableRobot::GetPlatformPose(PlatformPose* pose) const
+{
+  return platform_pose_snapshot_.Load(pose);
+}
+
 void CableRobot::UpdateHomeConfig(const double cable_len, const double pulley_angle)
 {
-  for (Actuator* actuator_ptr : active_actuators_ptrs_)
-    actuator_ptr->UpdateHomeConfig(cable_len, pulley_angle);
+  // Home configuration is the reference of counts conversion in the RT thread
+  pthread_mutex_lock(&mutex_);
+  for (size_t i = 0; i < active_actuators_ptrs_.size(); i++)
+  {
+    active_actuators_ptrs_[i]->UpdateHomeConfig(cable_len, pulley_angle);
+    active_actuators_ptrs_[i]->LoadCalibration(i, &actuators_state_);
+  }
+  RepublishActuatorsSnapshot();
+  pthread_mutex_unlock(&mutex_);
 }
 
 void CableRobot::UpdateHomeConfig(const id_t motor_id, const double cable_len,
                                   const double pulley_angle)
 {
+  // Home configuration is the reference of counts conversion in the RT thread
+  pthread_mutex_lock(&mutex_);
   actuators_ptrs_[motor_id]->UpdateHomeConfig(cable_len, pulley_angle);
+  const size_t active_idx = active_actuators_index_->Find(motor_id);
+  if (active_idx != IdIndexMap::kNotFound)
+  {
+    actuators_ptrs_[motor_id]->LoadCalibration(active_idx, &actuators_state_);
+    RepublishActuatorsSnapshot();
+  }
+  pthread_mutex_unlock(&mutex_);
 }
 
 bool CableRobot::MotorEnabled(const id_t motor_id)
@@ -205,13 +364,13 @@ void CableRobot::ClearFaults()
 
 void CableRobot::CollectMeas()
 {
-  pthread_mutex_lock(&mutex_);
-  for (size_t i = 0; i < active_actuators_ptrs_.size(); i++)
-  {
-    meas_[i].body             = active_actuators_ptrs_[i]->GetStatus();
-    meas_[i].header.timestamp = clock_.Elapsed();
-  }
-  pthread_mutex_unlock(&mutex_);
+  actuators_snapshot_.Read([&](const ActuatorsSnapshot& snapshot) {
+    for (size_t i = 0; i < meas_.size(); i++)
+    {
+      meas_[i].body             = snapshot.actuators[i].status;
+      meas_[i].header.timestamp = snapshot.timestamp;
+    }
+  });
 }
 
 void CableRobot::DumpMeas() const
@@ -220,6 +379,64 @@ void CableRobot::DumpMeas() const
     emit sendMsg(msg.serialized());
 }
 
+bool CableRobot::StartRecording()
+{
+  if (IsRecording())
+    return true;
+  const QDir dir(QString::fromStdString(telemetry_dir_));
+  const QString filename = dir.filePath(
+    QDateTime::currentDateTime().toString("'telemetry_'yyyyMMdd_hhmmss'.bin'"));
+  dir.mkpath(".");
+  if (!telemetry_recorder_.Start(filename.toStdString()))
+  {
+    emit printToQConsole("WARNING: Could not start telemetry recording onto " + filename);
+    CLOG(WARNING, "event") << "Could not start telemetry recording onto " << filename;
+    return false;
+  }
+  emit printToQConsole("Telemetry recording started: " + filename);
+  CLOG(INFO, "event") << "Telemetry recording started: " << filename;
+  return true;
+}
+
+void CableRobot::StopRecording()
+{
+  if (!IsRecording())
+    return;
+  telemetry_recorder_.Stop();
+  const TelemetryRecorder::Stats stats = telemetry_recorder_.GetStats();
+  const QString report = QString("Telemetry recording stopped: %1 samples recorded, %2 "
+                                 "dropped (buffer peak %3/%4)")
+                           .arg(stats.recorded)
+                           .arg(stats.dropped)
+                           .arg(stats.high_water_mark)
+                           .arg(stats.capacity);
+  emit printToQConsole(report);
+  CLOG(INFO, "event") << report;
+}
+
+void CableRobot::StreamActuatorSamples(const bool enable)
+{
+  if (!enable)
+  {
+    streaming_actuator_samples_.store(false, std::memory_order_release);
+    return;
+  }
+  // Discard any sample left behind by a previous session
+  ActuatorSample stale_samples[32];
+  for (size_t i = 0; i < actuator_samples_.size(); i++)
+    while (actuator_samples_[i]->Pop(stale_samples, 32) > 0)
+      continue;
+  streaming_actuator_samples_.store(true, std::memory_order_release);
+}
+
+size_t CableRobot::PopActuatorSamples(const size_t active_idx, ActuatorSample* samples,
+                                      const size_t max_samples)
+{
+  if (active_idx >= actuator_samples_.size())
+    return 0;
+  return actuator_samples_[active_idx]->Pop(samples, max_samples);
+}
+
 bool CableRobot::GoHome()
 {
   if (!MotorsEnabled())
@@ -229,26 +446,27 @@ bool CableRobot::GoHome()
   }
   emit printToQConsole("Moving to home position...");
 
-  ControllerSingleDrive controller(GetRtCycleTimeNsec());
+  // All cables at once, along synchronized trajectories
+  vect<int32_t> home_pos;
+  for (Actuator* actuator_ptr : active_actuators_ptrs_)
+    home_pos.push_back(actuator_ptr->GetWinch().GetServoHomePos());
+  ControllerMultiDrive controller(active_actuators_id_, GetRtCycleTimeNsec());
+  controller.SetMode(ControlMode::MOTOR_POSITION);
+  controller.SetMotorsPosTarget(home_pos, 3.0);
+
   // Temporarly switch to local controller for moving to home pos
+  pthread_mutex_lock(&mutex_);
   ControllerBase* prev_controller = controller_;
-  controller_                     = &controller;
+  pthread_mutex_unlock(&mutex_);
+  SetController(&controller); // also binds it to active actuators indices
 
-  for (Actuator* actuator_ptr : active_actuators_ptrs_)
+  const RetVal ret = WaitUntilTargetReached();
+  SetController(prev_controller); // restore original controller
+  if (ret != RetVal::OK)
   {
-    pthread_mutex_lock(&mutex_);
-    controller.SetMotorID(actuator_ptr->ID());
-    controller.SetMode(ControlMode::MOTOR_POSITION);
-    controller.SetMotorPosTarget(actuator_ptr->GetWinch().GetServoHomePos(), true, 3.0);
-    pthread_mutex_unlock(&mutex_);
-
-    if (WaitUntilTargetReached() != RetVal::OK)
-    {
-      emit printToQConsole("WARNING: Transition to home position interrupted");
-      return false;
-    }
+    emit printToQConsole("WARNING: Transition to home position interrupted");
+    return false;
   }
-  controller_ = prev_controller; // restore original controller
 
   emit printToQConsole("Daddy, I'm home!");
   return true;
@@ -258,6 +476,8 @@ void CableRobot::SetController(ControllerBase* controller)
 {
   pthread_mutex_lock(&mutex_);
   controller_ = controller;
+  if (controller_ != NULL)
+    controller_->SetActuatorsIndex(active_actuators_index_);
   pthread_mutex_unlock(&mutex_);
 }
 
@@ -397,6 +617,8 @@ STATE_DEFINE(CableRobot, Enabled, NoEventData)
   PrintStateTransition(prev_state_, ST_ENABLED);
   prev_state_ = ST_ENABLED;
 
+  // Any failure was handled: overruns are accounted from scratch
+  overrun_policy_.RequestReset();
   StopTimers();
   motor_status_timer_->start(kMotorStatusIntervalMsec_);
 }
@@ -451,15 +673,13 @@ void CableRobot::emitMotorStatus()
   if (!(ec_network_valid_ && rt_thread_active_))
     return;
 
-  id_t id = active_actuators_id_[counter++];
-  if (pthread_mutex_trylock(&mutex_) != 0)
-    return;
+  const size_t idx = counter++;
+  grabec::GSWDriveInPdos motor_status;
+  actuators_snapshot_.Read([&](const ActuatorsSnapshot& snapshot) {
+    motor_status = snapshot.actuators[idx].drive_pdos;
+  });
 
-  grabec::GSWDriveInPdos motor_status(
-    actuators_ptrs_[id]->GetWinch().GetServo()->GetDriveStatus());
-  pthread_mutex_unlock(&mutex_);
-
-  emit motorStatus(id, motor_status);
+  emit motorStatus(active_actuators_id_[idx], motor_status);
   if (counter >= active_actuators_id_.size())
     counter = 0;
 }
@@ -471,18 +691,78 @@ void CableRobot::emitActuatorStatus()
   if (!(ec_network_valid_ && rt_thread_active_))
     return;
 
-  if (pthread_mutex_trylock(&mutex_) != 0)
-    return;
-  active_actuators_status_[idx] = active_actuators_ptrs_[idx]->GetStatus();
-  pthread_mutex_unlock(&mutex_);
+  ActuatorStatus actuator_status;
+  actuators_snapshot_.Read([&](const ActuatorsSnapshot& snapshot) {
+    actuator_status = snapshot.actuators[idx].status;
+  });
 
-  emit actuatorStatus(active_actuators_status_[idx++]);
+  emit actuatorStatus(actuator_status);
+  idx++;
   if (idx >= active_actuators_id_.size())
     idx = 0;
 }
 
+void CableRobot::dumpRtTimingStatsOnRequest() const
+{
+  if (RtTimingStats::TakeDumpRequest())
+    rt_timing_.Dump(std::cout);
+}
+
+void CableRobot::checkOverrunPolicy()
+{
+  const OverrunPolicy::States state = overrun_policy_.GetState();
+  if (state != overrun_state_)
+  {
+    PrintOverrunPolicyTransition(state);
+    // Holding set points does not stop position and torque targets from being tracked,
+    // hence once escalated drives are brought to a safe state (disabled, i.e. braked).
+    // This is not done by the RT thread, since disabling drives is not real time safe.
+    if (state == OverrunPolicy::ST_ESCALATED)
+      DisableMotors();
+  }
+  if (state != OverrunPolicy::ST_ESCALATED)
+    return;
+
+  // Checked at every call, not only on transitions, since the robot may be operated
+  // again while set points are still frozen
+  switch (GetCurrentState())
+  {
+    case ST_CALIBRATION:
+    case ST_HOMING:
+    case ST_OPERATIONAL:
+      eventFailure();
+      break;
+    default:
+      break;
+  }
+}
+
 //--------- Miscellaneous private ---------------------------------------------------//
 
+void CableRobot::PrintOverrunPolicyTransition(const OverrunPolicy::States state)
+{
+  const QString msg =
+    QString("RT cycle overrun policy: %1 --> %2 (late cycles: %3, skipped cycles: %4, "
+            "lost cycles: %5, holds: %6)")
+      .arg(OverrunPolicy::StateName(overrun_state_), OverrunPolicy::StateName(state))
+      .arg(overrun_policy_.LateCount())
+      .arg(overrun_policy_.SkippedCount())
+      .arg(overrun_policy_.LostCyclesCount())
+      .arg(overrun_policy_.HoldsCount());
+  overrun_state_ = state;
+  if (state == OverrunPolicy::ST_NOMINAL)
+  {
+    CLOG(INFO, "event") << msg;
+    emit printToQConsole(msg);
+    return;
+  }
+  CLOG(WARNING, "event") << msg;
+  emit printToQConsole("WARNING: " + msg);
+  if (state == OverrunPolicy::ST_ESCALATED)
+    emit printToQConsole("WARNING: Motors are disabled and set points are frozen until "
+                         "overruns are reset or robot is enabled again");
+}
+
 void CableRobot::PrintStateTransition(const States current_state,
                                       const States new_state) const
 {
@@ -539,61 +819,239 @@ void CableRobot::EcRtThreadStatusChanged(const bool active)
   emit rtThreadStatusChanged(active);
 }
 
+void CableRobot::SetupSimNetwork(const grabcdpr::Params& config,
+                                 const SimDriveParams& params)
+{
+  sim_network_ = new SimEthercatNetwork(GetRtCycleTimeNsec());
+  for (size_t i = 0; i < actuators_ptrs_.size(); i++)
+  {
+    SimDriveParams drive_params    = params;
+    drive_params.motor_encoder_res = config.actuators[i].winch.motor_encoder_res;
+    sim_network_->AddSlave(actuators_ptrs_[i]->GetWinch().GetServo(), drive_params);
+  }
+  if (!sim_network_->Configure())
+    CLOG(WARNING, "event") << "Some process data are not handled by simulated EtherCAT "
+                              "network and will be left at zero";
+}
+
+void CableRobot::StartSimNetwork()
+{
+  if (sim_network_->IsRunning())
+    return;
+  // The simulated network has no master stack: bring the network up at once, i.e.
+  // master, domain and slaves all operational, like the physical one after Start().
+  Bitfield8 ec_state;
+  ec_state.ClearAll();
+  ec_state.Set(0);
+  ec_state.Set(1);
+  ec_state.Set(2);
+  EcStateChangedCb(ec_state);
+  sim_network_->Start([this]() {
+    pthread_mutex_lock(&mutex_);
+    EcWorkFun();
+    pthread_mutex_unlock(&mutex_);
+  });
+  EcPrintCb("Simulated EtherCAT network started");
+  EcRtThreadStatusChanged(true);
+}
+
+void CableRobot::StopSimNetwork()
+{
+  if (!sim_network_->IsRunning())
+    return;
+  sim_network_->Stop();
+  EcRtThreadStatusChanged(false);
+}
+
 void CableRobot::EcWorkFun()
 {
-  for (grabec::EthercatSlave* slave_ptr : slaves_ptrs_)
-    slave_ptr->ReadInputs(); // read pdos
+  if (!rt_profile_applied_.load(std::memory_order_relaxed))
+  {
+    // Spend the first wake-up of a new RT thread hardening it, out of the cyclic
+    // schedule: its (long) duration must not be taken as an overrun, so neither this
+    // cycle nor the gap before the next one are accounted.
+    if (!ApplyRtThreadProfile(rt_profile_))
+      CLOG(WARNING, "event") << "Could not fully apply RT profile to RT thread";
+    rt_timing_.RestartSchedule();
+    last_cycle_work_nsec_ = 0;
+    rt_profile_applied_.store(true, std::memory_order_relaxed);
+    return;
+  }
 
-  if (controller_ != NULL)
-    ControlStep();
+  const uint64_t t_begin = rt_timing_.BeginCycle();
+  uint64_t t             = t_begin;
 
-  for (grabec::EthercatSlave* slave_ptr : slaves_ptrs_)
-    slave_ptr->WriteOutputs(); // write all the necessary pdos
+  const uint64_t missed_cycles = rt_timing_.CycleMissedWakeups();
+  const OverrunPolicy::States overrun_state =
+    overrun_policy_.Update(last_cycle_work_nsec_, missed_cycles);
+
+  for (size_t i = 0; i < slaves_ptrs_.size(); i++)
+  {
+    slaves_ptrs_[i]->ReadInputs(); // read pdos
+    t = rt_timing_.RecordSlave(RtTimingStats::READ_PHASE, i, t);
+  }
+  t = rt_timing_.RecordPhase(RtTimingStats::READ_PHASE, t_begin);
+
+  {
+    // No heap allocation allowed from here on (checked in debug builds only).
+    RtAllocGuard::Scope alloc_guard;
+
+    UpdateActuatorsStatus();
+    EstimatePlatformPose();
+    const double timestamp = clock_.Elapsed();
+    PublishActuatorsSnapshot(timestamp);
+    PushActuatorSamples(timestamp);
+
+    if (overrun_state != OverrunPolicy::ST_NOMINAL)
+      HoldStep(timestamp);
+    else if (controller_ != NULL)
+    {
+      if (missed_cycles > 0)
+        controller_->OnCyclesSkipped(missed_cycles);
+      ControlStep(timestamp);
+    }
+    RecordTelemetry(timestamp);
+  }
+  t = rt_timing_.RecordPhase(RtTimingStats::CONTROL_PHASE, t);
+
+  const uint64_t t_write = t;
+  for (size_t i = 0; i < slaves_ptrs_.size(); i++)
+  {
+    slaves_ptrs_[i]->WriteOutputs(); // write all the necessary pdos
+    t = rt_timing_.RecordSlave(RtTimingStats::WRITE_PHASE, i, t);
+  }
+  rt_timing_.RecordPhase(RtTimingStats::WRITE_PHASE, t_write);
+  last_cycle_work_nsec_ = rt_timing_.EndCycle();
 }
 
 void CableRobot::EcEmergencyFun() {}
 
-//--------- Control related private functions ---------------------------------------//
+void CableRobot::UpdateActuatorsStatus()
+{
+  actuators_core_->UpdateState(&actuators_state_);
+}
 
-void CableRobot::ControlStep()
+void CableRobot::EstimatePlatformPose()
 {
-  for (size_t i = 0; i < active_actuators_status_.size(); i++)
-    active_actuators_status_[i] = active_actuators_ptrs_[i]->GetStatus();
+  if (!forward_kinematics_.IsObservable())
+    return;
+  // Warm started from previous cycle estimate, with a fixed budget of iterations
+  forward_kinematics_.Update(actuators_state_);
+  forward_kinematics_.WriteTo(&cdpr_status_);
+
+  const ForwardKinematics::Pose& pose = forward_kinematics_.GetPose();
+  platform_pose_.position_x           = pose[0];
+  platform_pose_.position_y           = pose[1];
+  platform_pose_.position_z           = pose[2];
+  platform_pose_.angle_x              = pose[3];
+  platform_pose_.angle_y              = pose[4];
+  platform_pose_.angle_z              = pose[5];
+  platform_pose_.residual_norm        = forward_kinematics_.GetResidualNorm();
+  platform_pose_.iterations           = forward_kinematics_.GetIterations();
+  platform_pose_.converged            = forward_kinematics_.IsConverged();
+  platform_pose_snapshot_.Store(platform_pose_);
+}
 
-  std::vector<ControlAction> ctrl_actions =
-    controller_->CalcCtrlActions(cdpr_status_, active_actuators_status_);
-  for (const ControlAction& ctrl_action : ctrl_actions)
-  {
-    // Safety check to see if given motor id is valid
-    bool valid_id = false;
-    for (const id_t& actuator_id : active_actuators_id_)
-      if (ctrl_action.motor_id == actuator_id)
-      {
-        valid_id = true;
-        break;
-      }
-    if (!valid_id)
-      continue;
+void CableRobot::PublishActuatorsSnapshot(const double timestamp)
+{
+  actuators_snapshot_.Write([&](ActuatorsSnapshot& snapshot) {
+    snapshot.cycle     = rt_cycle_counter_;
+    snapshot.timestamp = timestamp;
+    for (size_t i = 0; i < actuators_state_.Size(); i++)
+    {
+      snapshot.actuators[i].status = actuators_state_.GetStatus(i);
+      snapshot.actuators[i].drive_pdos =
+        active_actuators_ptrs_[i]->GetWinch().GetServo()->GetDriveStatus();
+    }
+  });
+  rt_cycle_counter_++;
+}
 
-    if (!actuators_ptrs_[ctrl_action.motor_id]->IsEnabled()) // safety check
-      continue;
+void CableRobot::RepublishActuatorsSnapshot()
+{
+  // Same cycle as latest snapshot, but converted with current home configuration. The
+  // RT thread only writes snapshots while holding the robot mutex, so there is still a
+  // single writer at a time.
+  UpdateActuatorsStatus();
+  actuators_snapshot_.Write([&](ActuatorsSnapshot& snapshot) {
+    for (size_t i = 0; i < actuators_state_.Size(); i++)
+      snapshot.actuators[i].status = actuators_state_.GetStatus(i);
+  });
+}
 
-    switch (ctrl_action.ctrl_mode)
+void CableRobot::PushActuatorSamples(const double timestamp)
+{
+  if (!streaming_actuator_samples_.load(std::memory_order_acquire))
+    return;
+  for (size_t i = 0; i < actuators_state_.Size(); i++)
+    actuator_samples_[i]->Emplace([&](ActuatorSample& sample) {
+      sample.timestamp = timestamp;
+      sample.status    = actuators_state_.GetStatus(i);
+    });
+}
+
+void CableRobot::RecordTelemetry(const double timestamp)
+{
+  if (telemetry_recorder_.IsRecording())
+    for (size_t i = 0; i < actuators_state_.Size(); i++)
     {
-      case CABLE_LENGTH:
-        actuators_ptrs_[ctrl_action.motor_id]->SetCableLength(ctrl_action.cable_length);
-        break;
-      case MOTOR_POSITION:
-        actuators_ptrs_[ctrl_action.motor_id]->SetMotorPos(ctrl_action.motor_position);
-        break;
-      case MOTOR_SPEED:
-        actuators_ptrs_[ctrl_action.motor_id]->SetMotorSpeed(ctrl_action.motor_speed);
-        break;
-      case MOTOR_TORQUE:
-        actuators_ptrs_[ctrl_action.motor_id]->SetMotorTorque(ctrl_action.motor_torque);
-        break;
-      case NONE:
-        break;
+      const ControlAction& action = applied_ctrl_actions_[i];
+      double setpoint             = 0.0;
+      switch (action.ctrl_mode)
+      {
+        case CABLE_LENGTH:
+          setpoint = action.cable_length;
+          break;
+        case MOTOR_POSITION:
+          setpoint = action.motor_position;
+          break;
+        case MOTOR_SPEED:
+          setpoint = action.motor_speed;
+          break;
+        case MOTOR_TORQUE:
+          setpoint = action.motor_torque;
+          break;
+        case NONE:
+          break;
+      }
+      telemetry_recorder_.Record(ActuatorTelemetryMsg(
+        timestamp,
+        ActuatorTelemetry(actuators_state_.GetStatus(i), action.ctrl_mode, setpoint)));
     }
+  if (telemetry_recorder_.IsRecording() && forward_kinematics_.IsObservable())
+    telemetry_recorder_.Record(PlatformPoseMsg(timestamp, platform_pose_));
+  // Actions are applied cycle by cycle
+  for (ControlAction& action : applied_ctrl_actions_)
+    action.ctrl_mode = NONE;
+}
+
+//--------- Control related private functions ---------------------------------------//
+
+void CableRobot::ControlStep(const double timestamp)
+{
+  // Streamed set points first, so that due ones are targeted within this very cycle
+  controller_->ConsumeSetpoints(timestamp);
+  ctrl_actions_.Clear();
+  controller_->CalcCtrlActions(cdpr_status_, actuators_state_, &ctrl_actions_);
+  actuators_core_->ApplyCtrlActions(ctrl_actions_, *active_actuators_index_,
+                                    &applied_ctrl_actions_);
+}
+
+void CableRobot::HoldStep(const double timestamp)
+{
+  // Streamed set points which fall due while holding are lost, not delayed
+  if (controller_ != NULL)
+    controller_->DiscardSetpoints(timestamp);
+  // Position and torque targets are left as they are, while motors in velocity mode are
+  // stopped, so that no cable moves until overruns are over
+  const vect<int8_t>& op_modes = actuators_state_.GetOpModes();
+  for (size_t i = 0; i < active_actuators_ptrs_.size(); i++)
+  {
+    if (op_modes[i] != grabec::CYCLIC_VELOCITY || !active_actuators_ptrs_[i]->IsEnabled())
+      continue;
+    active_actuators_ptrs_[i]->SetMotorSpeed(0);
+    applied_ctrl_actions_[i].motor_id    = active_actuators_id_[i];
+    applied_ctrl_actions_[i].ctrl_mode   = MOTOR_SPEED;
+    applied_ctrl_actions_[i].motor_speed = 0;
   }
 }
@@ -114,6 +114,24 @@ const ActuatorStatus Actuator::GetStatus()
   return status;
 }
 
+void Actuator::LoadCounts(const size_t slot, ActuatorsState* state)
+{
+  grabec::GoldSoloWhistleDrive* servo = winch_.GetServo();
+  state->SetCounts(
+    slot, servo->GetOpMode(),
+    DriveState2ActuatorState(static_cast<GSWDStates>(servo->GetCurrentState())),
+    servo->GetPosition(), servo->GetVelocity(), servo->GetTorque(),
+    servo->GetAuxPosition());
+}
+
+void Actuator::LoadCalibration(const size_t slot, ActuatorsState* state)
+{
+  state->SetCalibration(slot, winch_.GetCountsToLengthFactor(),
+                        pulley_.GetCountsToAngleFactor());
+  state->SetHomeConfig(slot, winch_.GetServoHomePos(), winch_.GetCable()->GetHomeLength(),
+                       pulley_.GetHomeCounts(), pulley_.GetHomeAngle());
+}
+
 void Actuator::SetCableLength(const double target_length)
 {
   if (active_)
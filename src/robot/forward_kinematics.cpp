@@ -0,0 +1,232 @@
+/**
+ * @file forward_kinematics.cpp
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing definitions of functions and class declared in
+ * forward_kinematics.h.
+ */
+
+#include "robot/forward_kinematics.h"
+
+#include <cmath>
+
+namespace {
+
+typedef ForwardKinematics::Pose Pose;
+
+// Solve A x = b in place through Cholesky decomposition of the symmetric positive
+// definite 6x6 matrix A, whose lower triangle is overwritten
+bool SolveCholesky(double A[6][6], const Pose& b, Pose* x)
+{
+  for (uint8_t j = 0; j < 6; j++)
+  {
+    double diag = A[j][j];
+    for (uint8_t k = 0; k < j; k++)
+      diag -= A[j][k] * A[j][k];
+    if (!(diag > 0.0))
+      return false;
+    A[j][j] = sqrt(diag);
+    for (uint8_t i = j + 1; i < 6; i++)
+    {
+      double value = A[i][j];
+      for (uint8_t k = 0; k < j; k++)
+        value -= A[i][k] * A[j][k];
+      A[i][j] = value / A[j][j];
+    }
+  }
+  Pose& y = *x;
+  for (uint8_t i = 0; i < 6; i++)
+  {
+    double value = b[i];
+    for (uint8_t k = 0; k < i; k++)
+      value -= A[i][k] * y[k];
+    y[i] = value / A[i][i];
+  }
+  for (int8_t i = 5; i >= 0; i--)
+  {
+    double value = y[i];
+    for (uint8_t k = i + 1; k < 6; k++)
+      value -= A[k][i] * y[k];
+    y[i] = value / A[i][i];
+  }
+  return true;
+}
+
+} // end namespace
+
+ForwardKinematics::ForwardKinematics(const grabcdpr::Params& params,
+                                     const OrientationAngles angles_type
+                                     /*= ANGLES_TILT_TORSION*/)
+  : inverse_kinematics_(params, angles_type), damping_(kInitDamping_), cost_(0.0),
+    iterations_(0), converged_(false)
+{
+  // First guess below the centroid of active pulleys, with null orientation
+  start_pose_.fill(0.0);
+  size_t active_num = 0;
+  for (const grabcdpr::ActuatorParams& actuator : params.actuators)
+  {
+    if (!actuator.active)
+      continue;
+    for (uint8_t i = 0; i < 3; i++)
+      start_pose_[i] += actuator.pulley.pos_OD_glob(i + 1, 1);
+    active_num++;
+  }
+  if (active_num > 0)
+    for (uint8_t i = 0; i < 3; i++)
+      start_pose_[i] /= active_num;
+  start_pose_[2] -= kStartDrop_;
+  Reset(start_pose_);
+
+  const size_t cables_num = inverse_kinematics_.CablesNum();
+  lengths_.resize(cables_num, 0.0);
+  swivels_.resize(cables_num, 0.0);
+  residuals_.resize(2 * cables_num, 0.0);
+  jacobian_.resize(2 * cables_num, Pose());
+  trial_residuals_.resize(2 * cables_num, 0.0);
+  trial_jacobian_.resize(2 * cables_num, Pose());
+}
+
+//--------- Public functions ---------------------------------------------------------//
+
+void ForwardKinematics::Reset(const Pose& pose)
+{
+  pose_       = pose;
+  damping_    = kInitDamping_;
+  cost_       = 0.0;
+  iterations_ = 0;
+  converged_  = false;
+  inverse_kinematics_.UpdateZeroOrd(pose_);
+}
+
+bool ForwardKinematics::Update(const ActuatorsState& actuators_state)
+{
+  converged_  = false;
+  iterations_ = 0;
+  if (!IsObservable() || actuators_state.Size() != lengths_.size())
+    return false;
+
+  // Same size, hence no allocation
+  lengths_ = actuators_state.GetCableLengths();
+  swivels_ = actuators_state.GetPulleyAngles();
+  // Warm start from previous estimate, unless lost
+  if (!Evaluate(pose_, &residuals_, &jacobian_, &cost_))
+  {
+    Reset(start_pose_);
+    if (!Evaluate(pose_, &residuals_, &jacobian_, &cost_))
+      return false;
+  }
+
+  bool at_estimate = true; // whether inverse kinematics matches current estimate
+  while (iterations_ < kMaxIterations_)
+  {
+    iterations_++;
+    // Damped normal equations (J^T*J + damping*diag(J^T*J)) * step = -J^T*r
+    double normal_mat[6][6];
+    Pose gradient;
+    for (uint8_t i = 0; i < 6; i++)
+    {
+      gradient[i] = 0.0;
+      for (uint8_t j = 0; j <= i; j++)
+        normal_mat[i][j] = 0.0;
+    }
+    for (size_t k = 0; k < residuals_.size(); k++)
+    {
+      const Pose& row = jacobian_[k];
+      for (uint8_t i = 0; i < 6; i++)
+      {
+        gradient[i] -= row[i] * residuals_[k];
+        for (uint8_t j = 0; j <= i; j++)
+          normal_mat[i][j] += row[i] * row[j];
+      }
+    }
+    // Floored, so that a parameter with no effect at current pose (e.g. tilt azimuth at
+    // null tilt) does not make the system singular
+    for (uint8_t i = 0; i < 6; i++)
+      normal_mat[i][i] += damping_ * fmax(normal_mat[i][i], kMinCurvature_);
+
+    Pose step;
+    if (!SolveCholesky(normal_mat, gradient, &step))
+    {
+      damping_ = fmin(10.0 * damping_, kMaxDamping_);
+      continue;
+    }
+    Pose trial;
+    double step_norm = 0.0;
+    for (uint8_t i = 0; i < 6; i++)
+    {
+      trial[i] = pose_[i] + step[i];
+      step_norm += step[i] * step[i];
+    }
+    double trial_cost;
+    if (Evaluate(trial, &trial_residuals_, &trial_jacobian_, &trial_cost) &&
+        trial_cost <= cost_)
+    {
+      pose_ = trial;
+      cost_ = trial_cost;
+      residuals_.swap(trial_residuals_);
+      jacobian_.swap(trial_jacobian_);
+      damping_    = fmax(0.1 * damping_, kMinDamping_);
+      at_estimate = true;
+      if (sqrt(step_norm) < kStepTolerance_)
+      {
+        converged_ = true;
+        break;
+      }
+    }
+    else
+    {
+      damping_    = fmin(10.0 * damping_, kMaxDamping_);
+      at_estimate = false;
+    }
+  }
+  // Leave inverse kinematics at current estimate, for it to be written out
+  if (!at_estimate)
+    Evaluate(pose_, &residuals_, &jacobian_, &cost_);
+  return converged_;
+}
+
+//--------- Private functions --------------------------------------------------------//
+
+bool ForwardKinematics::Evaluate(const Pose& pose, vect<double>* residuals,
+                                 vect<Pose>* jacobian, double* cost)
+{
+  static const Pose kNullPoseDeriv = {{0.0, 0.0, 0.0, 0.0, 0.0, 0.0}};
+
+  // See CalcDirectKinematicsLengthSwivel.m
+  const bool feasible = inverse_kinematics_.UpdateZeroOrd(pose);
+  inverse_kinematics_.UpdateFirstOrd(kNullPoseDeriv);
+  const InverseKinematics::Mat3& h_mat = inverse_kinematics_.GetHMat();
+  const size_t cables_num              = lengths_.size();
+  *cost                                = 0.0;
+  for (size_t i = 0; i < cables_num; i++)
+  {
+    const CableKinematics& cable = inverse_kinematics_.GetCable(i);
+    double& length_res           = (*residuals)[i];
+    double& swivel_res           = (*residuals)[cables_num + i];
+    Pose& length_row             = (*jacobian)[i];
+    Pose& swivel_row             = (*jacobian)[cables_num + i];
+
+    length_res = kLengthWeight_ * (cable.length - lengths_[i]);
+    swivel_res = kSwivelWeight_ * remainder(cable.swivel_ang - swivels_[i], 2.0 * M_PI);
+    *cost += 0.5 * (length_res * length_res + swivel_res * swivel_res);
+
+    // Swivel angle speed is w * (v + omega x PA) / (u * DA), with omega = H * angles_d
+    const double radial =
+      cable.vers_u[0] * cable.pos_DA_glob[0] + cable.vers_u[1] * cable.pos_DA_glob[1] +
+      cable.vers_u[2] * cable.pos_DA_glob[2];
+    const InverseKinematics::Vec3 moment = {
+      {cable.pos_PA_glob[1] * cable.vers_w[2] - cable.pos_PA_glob[2] * cable.vers_w[1],
+       cable.pos_PA_glob[2] * cable.vers_w[0] - cable.pos_PA_glob[0] * cable.vers_w[2],
+       cable.pos_PA_glob[0] * cable.vers_w[1] - cable.pos_PA_glob[1] * cable.vers_w[0]}};
+    const double swivel_gain = kSwivelWeight_ / radial;
+    for (uint8_t j = 0; j < 3; j++)
+    {
+      length_row[j]     = kLengthWeight_ * cable.analitic_jacobian_row[j];
+      length_row[3 + j] = kLengthWeight_ * cable.analitic_jacobian_row[3 + j];
+      swivel_row[j]     = swivel_gain * cable.vers_w[j];
+      swivel_row[3 + j] = swivel_gain * (moment[0] * h_mat[j] + moment[1] * h_mat[3 + j] +
+                                         moment[2] * h_mat[6 + j]);
+    }
+  }
+  return feasible && std::isfinite(*cost);
+}
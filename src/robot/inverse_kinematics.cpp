@@ -0,0 +1,253 @@
+/**
+ * @file inverse_kinematics.cpp
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing definitions of functions and class declared in
+ * inverse_kinematics.h.
+ */
+
+#include "robot/inverse_kinematics.h"
+
+#include <cmath>
+
+namespace {
+
+typedef InverseKinematics::Vec3 Vec3;
+typedef InverseKinematics::Mat3 Mat3;
+
+inline double Dot(const Vec3& a, const Vec3& b)
+{
+  return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+inline Vec3 Cross(const Vec3& a, const Vec3& b)
+{
+  return {{a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2],
+           a[0] * b[1] - a[1] * b[0]}};
+}
+
+inline Vec3 Mul(const Mat3& m, const Vec3& v)
+{
+  return {{m[0] * v[0] + m[1] * v[1] + m[2] * v[2],
+           m[3] * v[0] + m[4] * v[1] + m[5] * v[2],
+           m[6] * v[0] + m[7] * v[1] + m[8] * v[2]}};
+}
+
+Mat3 Mul(const Mat3& a, const Mat3& b)
+{
+  Mat3 c;
+  for (uint8_t i = 0; i < 3; i++)
+    for (uint8_t j = 0; j < 3; j++)
+      c[3 * i + j] = a[3 * i] * b[j] + a[3 * i + 1] * b[3 + j] + a[3 * i + 2] * b[6 + j];
+  return c;
+}
+
+// Elementary rotation about X (axis = 0), Y (axis = 1) or Z (axis = 2)
+Mat3 Rot(const uint8_t axis, const double angle)
+{
+  const double c = cos(angle);
+  const double s = sin(angle);
+  switch (axis)
+  {
+    case 0:
+      return {{1.0, 0.0, 0.0, 0.0, c, -s, 0.0, s, c}};
+    case 1:
+      return {{c, 0.0, s, 0.0, 1.0, 0.0, -s, 0.0, c}};
+    default:
+      return {{c, -s, 0.0, s, c, 0.0, 0.0, 0.0, 1.0}};
+  }
+}
+
+} // end namespace
+
+InverseKinematics::InverseKinematics(const grabcdpr::Params& params,
+                                     const OrientationAngles angles_type
+                                     /*= ANGLES_TILT_TORSION*/)
+  : angles_type_(angles_type)
+{
+  for (size_t k = 0; k < params.actuators.size(); k++)
+  {
+    const grabcdpr::ActuatorParams& actuator = params.actuators[k];
+    if (!actuator.active)
+      continue;
+    CableGeometry cable;
+    cable.actuator_idx = k;
+    for (uint8_t i = 0; i < 3; i++)
+    {
+      cable.pos_OD_glob[i] = actuator.pulley.pos_OD_glob(i + 1, 1);
+      cable.vers_i[i]      = actuator.pulley.vers_i(i + 1, 1);
+      cable.vers_j[i]      = actuator.pulley.vers_j(i + 1, 1);
+      cable.vers_k[i]      = actuator.pulley.vers_k(i + 1, 1);
+      cable.pos_PA_loc[i]  = actuator.winch.pos_PA_loc(i + 1, 1);
+    }
+    cable.pulley_radius = actuator.pulley.radius;
+    geometry_.push_back(cable);
+  }
+  cables_.resize(geometry_.size(), CableKinematics());
+  for (uint8_t i = 0; i < 3; i++)
+    pos_PG_loc_[i] = params.platform.pos_PG_loc(i + 1, 1);
+
+  // Start from null pose, so that results are always well defined
+  pose_.fill(0.0);
+  UpdateZeroOrd(pose_);
+  UpdateFirstOrd(pose_);
+}
+
+//--------- Public functions ---------------------------------------------------------//
+
+bool InverseKinematics::UpdateZeroOrd(const Pose& pose)
+{
+  pose_ = pose;
+  UpdateRotation();
+  pos_PG_glob_ = Mul(rot_mat_, pos_PG_loc_);
+
+  bool feasible = true;
+  for (size_t i = 0; i < cables_.size(); i++)
+  {
+    const CableGeometry& geom = geometry_[i];
+    CableKinematics& cable    = cables_[i];
+    // Attachment point (see UpdatePosA.m)
+    cable.pos_PA_glob = Mul(rot_mat_, geom.pos_PA_loc);
+    for (uint8_t j = 0; j < 3; j++)
+    {
+      cable.pos_OA_glob[j] = pose[j] + cable.pos_PA_glob[j];
+      cable.pos_DA_glob[j] = cable.pos_OA_glob[j] - geom.pos_OD_glob[j];
+    }
+    // Swivel angle and pulley plane (see CalcSviwelAngle.m, CalcPulleyVersors.m)
+    cable.swivel_ang =
+      atan2(Dot(geom.vers_j, cable.pos_DA_glob), Dot(geom.vers_i, cable.pos_DA_glob));
+    const double cos_s = cos(cable.swivel_ang);
+    const double sin_s = sin(cable.swivel_ang);
+    for (uint8_t j = 0; j < 3; j++)
+    {
+      cable.vers_u[j] = geom.vers_i[j] * cos_s + geom.vers_j[j] * sin_s;
+      cable.vers_w[j] = -geom.vers_i[j] * sin_s + geom.vers_j[j] * cos_s;
+    }
+    // Winding angle (see CalcTangentAngle.m)
+    const double radius = geom.pulley_radius;
+    const double radial = Dot(cable.vers_u, cable.pos_DA_glob);
+    const double ratio  = Dot(geom.vers_k, cable.pos_DA_glob) / radial;
+    const double arg    = 1.0 - 2.0 * radius / radial + ratio * ratio;
+    if (radial <= 0.0 || arg < 0.0)
+      feasible = false;
+    cable.tan_ang = 2.0 * atan(ratio + sqrt(arg));
+    // Cable vectors and length (see CalcCableVectors.m, CalcCableLen.m)
+    const double cos_p = cos(cable.tan_ang);
+    const double sin_p = sin(cable.tan_ang);
+    for (uint8_t j = 0; j < 3; j++)
+    {
+      cable.vers_n[j]   = cable.vers_u[j] * cos_p + geom.vers_k[j] * sin_p;
+      cable.vers_rho[j] = cable.vers_u[j] * sin_p - geom.vers_k[j] * cos_p;
+      cable.pos_BA_glob[j] =
+        cable.pos_DA_glob[j] - radius * (cable.vers_u[j] + cable.vers_n[j]);
+    }
+    cable.length =
+      radius * (M_PI - cable.tan_ang) + sqrt(Dot(cable.pos_BA_glob, cable.pos_BA_glob));
+  }
+  return feasible;
+}
+
+void InverseKinematics::UpdateFirstOrd(const Pose& pose_deriv)
+{
+  const Vec3 angles_deriv = {{pose_deriv[3], pose_deriv[4], pose_deriv[5]}};
+  angular_vel_            = Mul(h_mat_, angles_deriv);
+
+  for (size_t i = 0; i < cables_.size(); i++)
+  {
+    CableKinematics& cable = cables_[i];
+    // Attachment point velocity (see UpdateVelA.m)
+    const Vec3 rotation_vel = Cross(angular_vel_, cable.pos_PA_glob);
+    Vec3 vel_OA_glob;
+    for (uint8_t j = 0; j < 3; j++)
+      vel_OA_glob[j] = pose_deriv[j] + rotation_vel[j];
+    // Angles and length speed (see CalcSviwelAngleD.m, CalcTangentAngleD.m,
+    // CalcCableSpeed.m)
+    const double radial   = Dot(cable.vers_u, cable.pos_DA_glob);
+    const double straight = sqrt(Dot(cable.pos_BA_glob, cable.pos_BA_glob));
+    cable.swivel_ang_vel  = Dot(cable.vers_w, vel_OA_glob) / radial;
+    cable.tan_ang_vel     = Dot(cable.vers_n, vel_OA_glob) / straight;
+    cable.speed           = Dot(cable.vers_rho, vel_OA_glob);
+    // Jacobian rows (see CalcPlatformJacobianRow.m)
+    const Vec3 moment = Cross(cable.pos_PA_glob, cable.vers_rho);
+    for (uint8_t j = 0; j < 3; j++)
+    {
+      cable.geometric_jacobian_row[j]     = cable.vers_rho[j];
+      cable.geometric_jacobian_row[3 + j] = moment[j];
+      cable.analitic_jacobian_row[j]      = cable.vers_rho[j];
+      cable.analitic_jacobian_row[3 + j] =
+        moment[0] * h_mat_[j] + moment[1] * h_mat_[3 + j] + moment[2] * h_mat_[6 + j];
+    }
+  }
+}
+
+void InverseKinematics::WriteTo(grabcdpr::Vars* vars) const
+{
+  if (vars->platform != NULL)
+  {
+    grabcdpr::PlatformVars& platform = *vars->platform;
+    for (uint8_t i = 0; i < 3; i++)
+    {
+      platform.position(i + 1, 1)    = pose_[i];
+      platform.orientation(i + 1, 1) = pose_[3 + i];
+      platform.pos_PG_glob(i + 1, 1) = pos_PG_glob_[i];
+      platform.pos_OG_glob(i + 1, 1) = pose_[i] + pos_PG_glob_[i];
+      for (uint8_t j = 0; j < 3; j++)
+        platform.rot_mat(i + 1, j + 1) = rot_mat_[3 * i + j];
+    }
+  }
+  for (size_t k = 0; k < cables_.size(); k++)
+  {
+    if (geometry_[k].actuator_idx >= vars->cables.size())
+      continue;
+    const CableKinematics& cable    = cables_[k];
+    grabcdpr::CableVars& cable_vars = vars->cables[geometry_[k].actuator_idx];
+    cable_vars.length               = cable.length;
+    cable_vars.swivel_ang           = cable.swivel_ang;
+    cable_vars.tan_ang              = cable.tan_ang;
+    cable_vars.speed                = cable.speed;
+    cable_vars.swivel_ang_vel       = cable.swivel_ang_vel;
+    cable_vars.tan_ang_vel          = cable.tan_ang_vel;
+    for (uint8_t i = 0; i < 3; i++)
+    {
+      cable_vars.pos_PA_glob(i + 1, 1) = cable.pos_PA_glob[i];
+      cable_vars.pos_OA_glob(i + 1, 1) = cable.pos_OA_glob[i];
+      cable_vars.pos_DA_glob(i + 1, 1) = cable.pos_DA_glob[i];
+      cable_vars.pos_BA_glob(i + 1, 1) = cable.pos_BA_glob[i];
+      cable_vars.vers_u(i + 1, 1)      = cable.vers_u[i];
+      cable_vars.vers_w(i + 1, 1)      = cable.vers_w[i];
+      cable_vars.vers_n(i + 1, 1)      = cable.vers_n[i];
+      cable_vars.vers_rho(i + 1, 1)    = cable.vers_rho[i];
+    }
+  }
+}
+
+//--------- Private functions --------------------------------------------------------//
+
+void InverseKinematics::UpdateRotation()
+{
+  // See Rot*.m and Htf*.m in matlab/common
+  const double c1 = cos(pose_[3]);
+  const double s1 = sin(pose_[3]);
+  const double c2 = cos(pose_[4]);
+  const double s2 = sin(pose_[4]);
+  switch (angles_type_)
+  {
+    case ANGLES_TAIT_BRYAN:
+      rot_mat_ = Mul(Mul(Rot(0, pose_[3]), Rot(1, pose_[4])), Rot(2, pose_[5]));
+      h_mat_   = {{1.0, 0.0, s2, 0.0, c1, -s1 * c2, 0.0, s1, c1 * c2}};
+      break;
+    case ANGLES_RPY:
+      rot_mat_ = Mul(Mul(Rot(2, pose_[3]), Rot(1, pose_[4])), Rot(0, pose_[5]));
+      h_mat_   = {{0.0, -s1, c1 * c2, 0.0, c1, s1 * c2, 1.0, 0.0, -s2}};
+      break;
+    case ANGLES_EULER_ZYZ:
+      rot_mat_ = Mul(Mul(Rot(2, pose_[3]), Rot(1, pose_[4])), Rot(2, pose_[5]));
+      h_mat_   = {{0.0, -s1, c1 * s2, 0.0, c1, s1 * s2, 1.0, 0.0, c2}};
+      break;
+    case ANGLES_TILT_TORSION:
+      rot_mat_ =
+        Mul(Mul(Rot(2, pose_[3]), Rot(1, pose_[4])), Rot(2, pose_[5] - pose_[3]));
+      h_mat_ = {{-c1 * s2, -s1, c1 * s2, -s1 * s2, c1, s1 * s2, 1.0 - c2, 0.0, c2}};
+      break;
+  }
+}
@@ -0,0 +1,227 @@
+/**
+ * @file sim_ethercat_network.cpp
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing definitions of functions and class declared in
+ * sim_ethercat_network.h.
+ */
+
+#include "robot/sim/sim_ethercat_network.h"
+
+#include <pthread.h>
+
+#include "libgrabrt/inc/clocks.h"
+
+constexpr uint8_t SimEthercatNetwork::kDefaultEntrySize_;
+
+SimEthercatNetwork::SimEthercatNetwork(const uint32_t cycle_time_nsec)
+  : cycle_time_nsec_(cycle_time_nsec), running_(false)
+{}
+
+SimEthercatNetwork::~SimEthercatNetwork() { Stop(); }
+
+//--------- Public functions ---------------------------------------------------------//
+
+void SimEthercatNetwork::AddSlave(grabec::EthercatSlave* slave_ptr,
+                                  const SimDriveParams& drive_params,
+                                  const bool animate /*= true*/)
+{
+  if (configured_)
+    return;
+  SimSlave sim_slave;
+  sim_slave.slave_ptr    = slave_ptr;
+  sim_slave.drive_params = drive_params;
+  sim_slave.animate      = animate;
+  for (uint8_t i = 0; i < PDO_OBJECTS_NUM; i++)
+    sim_slave.offsets[i] = -1;
+  slaves_.push_back(std::move(sim_slave));
+}
+
+bool SimEthercatNetwork::Configure()
+{
+  if (configured_)
+    return true;
+
+  // Lay out all PDO entries of all slaves one after the other, like a real domain does.
+  bool all_known      = true;
+  unsigned int cursor = 0;
+  for (SimSlave& sim_slave : slaves_)
+  {
+    for (uint8_t i = 0; i < sim_slave.slave_ptr->GetDomainEntriesNum(); i++)
+    {
+      ec_pdo_entry_reg_t entry = sim_slave.slave_ptr->GetDomainEntry(i);
+      const PdoObjects object  = LookupObject(entry.index, entry.subindex);
+      if (object == UNKNOWN_OBJECT)
+        all_known = false;
+      else
+        sim_slave.offsets[object] = cursor;
+      *entry.offset = cursor;
+      if (entry.bit_position != NULL)
+        *entry.bit_position = 0;
+      cursor += ObjectSize(object);
+    }
+    if (sim_slave.animate)
+      sim_slave.drive.reset(new SimGoldSoloWhistleDrive(sim_slave.drive_params));
+  }
+
+  // Image is allocated once and for all, since slaves keep pointing at it.
+  process_image_.assign(cursor, 0);
+  for (SimSlave& sim_slave : slaves_)
+  {
+    sim_slave.slave_ptr->Init(process_image_.data());
+    if (sim_slave.drive)
+      WriteInputs(sim_slave);
+  }
+  configured_ = true;
+  return all_known;
+}
+
+bool SimEthercatNetwork::Start(const std::function<void()>& cycle_fun)
+{
+  if (!configured_ || running_.load())
+    return false;
+  cycle_fun_ = cycle_fun;
+  running_.store(true);
+  thread_ = std::thread(&SimEthercatNetwork::Loop, this);
+  // Try to run as a real-time thread like the master does; if this process lacks the
+  // privileges, simulation still works at normal priority.
+  sched_param param;
+  param.sched_priority = sched_get_priority_max(SCHED_FIFO) - 1;
+  pthread_setschedparam(thread_.native_handle(), SCHED_FIFO, &param);
+  return true;
+}
+
+void SimEthercatNetwork::Stop()
+{
+  running_.store(false);
+  if (thread_.joinable())
+    thread_.join();
+}
+
+SimGoldSoloWhistleDrive* SimEthercatNetwork::GetDrive(const size_t slave_idx)
+{
+  if (slave_idx >= slaves_.size())
+    return NULL;
+  return slaves_[slave_idx].drive.get();
+}
+
+//--------- Private functions --------------------------------------------------------//
+
+void SimEthercatNetwork::Loop()
+{
+  const double dt_sec = cycle_time_nsec_ * 1e-9;
+  grabrt::ThreadClock clock(cycle_time_nsec_);
+  clock.Reset();
+  while (running_.load())
+  {
+    clock.WaitUntilNext();
+    for (SimSlave& sim_slave : slaves_)
+    {
+      if (!sim_slave.drive)
+        continue;
+      sim_slave.drive->Step(dt_sec);
+      WriteInputs(sim_slave);
+    }
+    cycle_fun_();
+    for (SimSlave& sim_slave : slaves_)
+      if (sim_slave.drive)
+        ReadOutputs(sim_slave);
+  }
+}
+
+void SimEthercatNetwork::WriteInputs(SimSlave& sim_slave)
+{
+  const SimDriveFeedback& fb = sim_slave.drive->GetFeedback();
+  uint8_t* image             = process_image_.data();
+  const long* offsets        = sim_slave.offsets;
+  if (offsets[STATUS_WORD] >= 0)
+    EC_WRITE_U16(image + offsets[STATUS_WORD], fb.status_word);
+  if (offsets[DISPLAY_OP_MODE] >= 0)
+    EC_WRITE_S8(image + offsets[DISPLAY_OP_MODE], fb.display_op_mode);
+  if (offsets[POS_ACTUAL_VALUE] >= 0)
+    EC_WRITE_S32(image + offsets[POS_ACTUAL_VALUE], fb.pos_actual_value);
+  if (offsets[VEL_ACTUAL_VALUE] >= 0)
+    EC_WRITE_S32(image + offsets[VEL_ACTUAL_VALUE], fb.vel_actual_value);
+  if (offsets[TORQUE_ACTUAL_VALUE] >= 0)
+    EC_WRITE_S16(image + offsets[TORQUE_ACTUAL_VALUE], fb.torque_actual_value);
+  if (offsets[DIGITAL_INPUTS] >= 0)
+    EC_WRITE_U32(image + offsets[DIGITAL_INPUTS], fb.digital_inputs);
+  if (offsets[AUX_POS_ACTUAL_VALUE] >= 0)
+    EC_WRITE_S32(image + offsets[AUX_POS_ACTUAL_VALUE], fb.aux_pos_actual_value);
+}
+
+void SimEthercatNetwork::ReadOutputs(SimSlave& sim_slave)
+{
+  const uint8_t* image = process_image_.data();
+  const long* offsets  = sim_slave.offsets;
+  SimDriveCommand cmd;
+  if (offsets[CONTROL_WORD] >= 0)
+    cmd.control_word = EC_READ_U16(image + offsets[CONTROL_WORD]);
+  if (offsets[OP_MODE] >= 0)
+    cmd.op_mode = EC_READ_S8(image + offsets[OP_MODE]);
+  if (offsets[TARGET_POSITION] >= 0)
+    cmd.target_position = EC_READ_S32(image + offsets[TARGET_POSITION]);
+  if (offsets[TARGET_VELOCITY] >= 0)
+    cmd.target_velocity = EC_READ_S32(image + offsets[TARGET_VELOCITY]);
+  if (offsets[TARGET_TORQUE] >= 0)
+    cmd.target_torque = EC_READ_S16(image + offsets[TARGET_TORQUE]);
+  sim_slave.drive->SetCommand(cmd);
+}
+
+SimEthercatNetwork::PdoObjects SimEthercatNetwork::LookupObject(const uint16_t index,
+                                                                const uint8_t subindex)
+{
+  switch (index)
+  {
+    case 0x6041:
+      return STATUS_WORD;
+    case 0x6061:
+      return DISPLAY_OP_MODE;
+    case 0x6064:
+      return POS_ACTUAL_VALUE;
+    case 0x606C:
+      return VEL_ACTUAL_VALUE;
+    case 0x6077:
+      return TORQUE_ACTUAL_VALUE;
+    case 0x60FD:
+      return DIGITAL_INPUTS;
+    case 0x20A0: // auxiliary position actual value (Elmo specific)
+      return subindex == 0x00 ? AUX_POS_ACTUAL_VALUE : UNKNOWN_OBJECT;
+    case 0x6040:
+      return CONTROL_WORD;
+    case 0x6060:
+      return OP_MODE;
+    case 0x607A:
+      return TARGET_POSITION;
+    case 0x60FF:
+      return TARGET_VELOCITY;
+    case 0x6071:
+      return TARGET_TORQUE;
+    default:
+      return UNKNOWN_OBJECT;
+  }
+}
+
+uint8_t SimEthercatNetwork::ObjectSize(const PdoObjects object)
+{
+  switch (object)
+  {
+    case DISPLAY_OP_MODE:
+    case OP_MODE:
+      return 1;
+    case STATUS_WORD:
+    case CONTROL_WORD:
+    case TORQUE_ACTUAL_VALUE:
+    case TARGET_TORQUE:
+      return 2;
+    case POS_ACTUAL_VALUE:
+    case VEL_ACTUAL_VALUE:
+    case DIGITAL_INPUTS:
+    case AUX_POS_ACTUAL_VALUE:
+    case TARGET_POSITION:
+    case TARGET_VELOCITY:
+      return 4;
+    default:
+      return kDefaultEntrySize_;
+  }
+}
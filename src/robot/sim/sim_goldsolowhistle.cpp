@@ -0,0 +1,249 @@
+/**
+ * @file sim_goldsolowhistle.cpp
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing definitions of functions and class declared in
+ * sim_goldsolowhistle.h.
+ */
+
+#include "robot/sim/sim_goldsolowhistle.h"
+
+#include <algorithm>
+#include <cmath>
+
+constexpr int SimGoldSoloWhistleDrive::kSubStepsNum_;
+constexpr uint16_t SimGoldSoloWhistleDrive::kRemoteBit_;
+constexpr uint16_t SimGoldSoloWhistleDrive::kTargetReachBit_;
+constexpr uint16_t SimGoldSoloWhistleDrive::kFaultResetBit_;
+
+SimGoldSoloWhistleDrive::SimGoldSoloWhistleDrive(
+  const SimDriveParams& params /*= SimDriveParams()*/, const int32_t init_pos /*= 0*/,
+  const int32_t init_aux_pos /*= 0*/)
+  : params_(params), state_(ST_NOT_READY_TO_SWITCH_ON), prev_fault_reset_(false),
+    target_reached_(false), prev_target_position_(init_pos), velocity_(0.0),
+    torque_(0.0), init_pos_(init_pos), init_aux_pos_(init_aux_pos)
+{
+  counts_per_rad_          = params_.motor_encoder_res / (2.0 * M_PI);
+  position_                = init_pos / counts_per_rad_;
+  init_position_           = position_;
+  command_.target_position = init_pos;
+  UpdateFeedback();
+}
+
+//--------- Public functions ---------------------------------------------------------//
+
+void SimGoldSoloWhistleDrive::SetCommand(const SimDriveCommand& command)
+{
+  command_ = command;
+}
+
+void SimGoldSoloWhistleDrive::Step(const double dt_sec)
+{
+  const States prev_state = state_;
+  UpdateStateMachine();
+  if (state_ == ST_OPERATION_ENABLED && prev_state != ST_OPERATION_ENABLED)
+    prev_target_position_ = command_.target_position; // no feedforward spike on enable
+
+  // Following error protection, as on the physical drive
+  if (state_ == ST_OPERATION_ENABLED && command_.op_mode == CYCLIC_POSITION &&
+      std::abs(static_cast<int64_t>(command_.target_position) -
+               feedback_.pos_actual_value) > params_.max_following_err)
+    InjectFault();
+
+  const double dt = dt_sec / kSubStepsNum_;
+  for (int i = 0; i < kSubStepsNum_; i++)
+    IntegrateDynamics(CalcMotorTorque(dt_sec), dt);
+  prev_target_position_ = command_.target_position;
+
+  UpdateFeedback();
+}
+
+void SimGoldSoloWhistleDrive::InjectFault()
+{
+  if (state_ != ST_FAULT)
+    state_ = ST_FAULT_REACTION_ACTIVE;
+}
+
+uint16_t SimGoldSoloWhistleDrive::StateToStatusWord(const States state)
+{
+  switch (state)
+  {
+    case ST_NOT_READY_TO_SWITCH_ON:
+      return 0x0000;
+    case ST_SWITCH_ON_DISABLED:
+      return 0x0040;
+    case ST_READY_TO_SWITCH_ON:
+      return 0x0031;
+    case ST_SWITCHED_ON:
+      return 0x0033;
+    case ST_OPERATION_ENABLED:
+      return 0x0037;
+    case ST_QUICK_STOP_ACTIVE:
+      return 0x0017;
+    case ST_FAULT_REACTION_ACTIVE:
+      return 0x000F;
+    case ST_FAULT:
+      return 0x0008;
+  }
+  return 0x0000;
+}
+
+//--------- Private functions --------------------------------------------------------//
+
+void SimGoldSoloWhistleDrive::UpdateStateMachine()
+{
+  const uint16_t cw          = command_.control_word;
+  const bool fault_reset     = (cw & kFaultResetBit_) != 0;
+  const bool fault_reset_cmd = fault_reset && !prev_fault_reset_; // rising edge
+  prev_fault_reset_          = fault_reset;
+
+  // Decode CiA-402 device control commands
+  const bool shutdown     = (cw & 0x0087) == 0x0006;
+  const bool switch_on    = (cw & 0x008F) == 0x0007;
+  const bool enable_op    = (cw & 0x008F) == 0x000F;
+  const bool disable_volt = (cw & 0x0082) == 0x0000;
+  const bool quick_stop   = (cw & 0x0086) == 0x0002;
+
+  switch (state_)
+  {
+    case ST_NOT_READY_TO_SWITCH_ON:
+      state_ = ST_SWITCH_ON_DISABLED; // self-test always passes
+      break;
+    case ST_SWITCH_ON_DISABLED:
+      if (shutdown)
+        state_ = ST_READY_TO_SWITCH_ON;
+      break;
+    case ST_READY_TO_SWITCH_ON:
+      if (disable_volt || quick_stop)
+        state_ = ST_SWITCH_ON_DISABLED;
+      else if (switch_on)
+        state_ = ST_SWITCHED_ON;
+      break;
+    case ST_SWITCHED_ON:
+      if (disable_volt || quick_stop)
+        state_ = ST_SWITCH_ON_DISABLED;
+      else if (shutdown)
+        state_ = ST_READY_TO_SWITCH_ON;
+      else if (enable_op)
+        state_ = ST_OPERATION_ENABLED;
+      break;
+    case ST_OPERATION_ENABLED:
+      if (disable_volt)
+        state_ = ST_SWITCH_ON_DISABLED;
+      else if (quick_stop)
+        state_ = ST_QUICK_STOP_ACTIVE;
+      else if (shutdown)
+        state_ = ST_READY_TO_SWITCH_ON;
+      else if (switch_on)
+        state_ = ST_SWITCHED_ON;
+      break;
+    case ST_QUICK_STOP_ACTIVE:
+      if (disable_volt || std::abs(velocity_) * counts_per_rad_ < 1.0)
+        state_ = ST_SWITCH_ON_DISABLED;
+      else if (enable_op)
+        state_ = ST_OPERATION_ENABLED;
+      break;
+    case ST_FAULT_REACTION_ACTIVE:
+      state_ = ST_FAULT; // brake engages immediately
+      break;
+    case ST_FAULT:
+      if (fault_reset_cmd)
+        state_ = ST_SWITCH_ON_DISABLED;
+      break;
+  }
+}
+
+double SimGoldSoloWhistleDrive::CalcMotorTorque(const double dt_sec)
+{
+  const double max_torque = params_.max_torque * 0.001 * params_.rated_torque;
+  const double kv         = params_.motor_inertia * params_.vel_loop_bandwidth;
+  const double load       = CalcLoadTorque();
+
+  double torque = 0.0;
+  double vel_ref;
+  switch (state_)
+  {
+    case ST_OPERATION_ENABLED:
+      switch (command_.op_mode)
+      {
+        case CYCLIC_TORQUE:
+          torque = command_.target_torque * 0.001 * params_.rated_torque;
+          break;
+        case CYCLIC_VELOCITY:
+          vel_ref = command_.target_velocity / counts_per_rad_;
+          torque = kv * (vel_ref - velocity_) + params_.viscous_friction * vel_ref + load;
+          break;
+        case CYCLIC_POSITION:
+          vel_ref = (command_.target_position - prev_target_position_) /
+                      (counts_per_rad_ * dt_sec) +
+                    params_.pos_loop_bandwidth *
+                      (command_.target_position / counts_per_rad_ - position_);
+          torque = kv * (vel_ref - velocity_) + params_.viscous_friction * vel_ref + load;
+          break;
+        default:
+          torque = kv * (-velocity_) + load; // hold still
+          break;
+      }
+      break;
+    case ST_QUICK_STOP_ACTIVE:
+      torque = kv * (-velocity_) + load;
+      break;
+    default:
+      return 0.0; // motor not powered
+  }
+  return std::min(std::max(torque, -max_torque), max_torque);
+}
+
+double SimGoldSoloWhistleDrive::CalcLoadTorque() const
+{
+  return params_.load_torque + params_.load_stiffness * (position_ - init_position_);
+}
+
+void SimGoldSoloWhistleDrive::IntegrateDynamics(const double motor_torque,
+                                                const double dt_sec)
+{
+  torque_ = motor_torque;
+  if (state_ != ST_OPERATION_ENABLED && state_ != ST_QUICK_STOP_ACTIVE)
+  {
+    velocity_ = 0.0; // brake engaged
+    return;
+  }
+  // Semi-implicit Euler integration of a rigid motor
+  const double acc =
+    (torque_ - params_.viscous_friction * velocity_ - CalcLoadTorque()) /
+    params_.motor_inertia;
+  velocity_ += acc * dt_sec;
+  position_ += velocity_ * dt_sec;
+}
+
+void SimGoldSoloWhistleDrive::UpdateFeedback()
+{
+  const int32_t pos = static_cast<int32_t>(std::round(position_ * counts_per_rad_));
+  feedback_.pos_actual_value = pos;
+  feedback_.vel_actual_value =
+    static_cast<int32_t>(std::round(velocity_ * counts_per_rad_));
+  feedback_.torque_actual_value =
+    static_cast<int16_t>(std::round(torque_ / params_.rated_torque * 1000.0));
+  feedback_.aux_pos_actual_value =
+    init_aux_pos_ +
+    static_cast<int32_t>(std::round(params_.aux_encoder_coupling * (pos - init_pos_)));
+  feedback_.display_op_mode = command_.op_mode;
+  feedback_.digital_inputs  = 0;
+
+  switch (command_.op_mode)
+  {
+    case CYCLIC_POSITION:
+      target_reached_ = std::abs(command_.target_position - pos) < 100;
+      break;
+    case CYCLIC_VELOCITY:
+      target_reached_ = std::abs(command_.target_velocity - feedback_.vel_actual_value) <
+                        params_.motor_encoder_res / 100;
+      break;
+    default:
+      target_reached_ = true;
+      break;
+  }
+  feedback_.status_word = StateToStatusWord(state_) | kRemoteBit_;
+  if (target_reached_ && state_ == ST_OPERATION_ENABLED)
+    feedback_.status_word |= kTargetReachBit_;
+}
@@ -0,0 +1,288 @@
+/**
+ * @file app_settings.cpp
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing definitions of functions and class declared in app_settings.h.
+ */
+
+#include "utils/app_settings.h"
+
+#include <sched.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+
+using json = nlohmann::json; /**< Alias for json namespace. */
+
+constexpr size_t AppSettingsJsonParser::kMaxPrefaultStackSize_;
+
+bool AppSettingsJsonParser::ParseFile(const std::string& filename, AppSettings* settings)
+{
+  std::ifstream ifile(filename);
+  if (!ifile.is_open())
+  {
+    std::cerr << "[ERROR] Could not open file " << filename << std::endl;
+    return false;
+  }
+
+  json data;
+  try
+  {
+    ifile >> data;
+  }
+  catch (json::parse_error& e)
+  {
+    std::cerr << "[ERROR] " << e.what() << std::endl;
+    return false;
+  }
+  ifile.close();
+
+  *settings = AppSettings();
+  if (data.count("ethercat") > 0 && !ParseEthercat(data["ethercat"], settings))
+    return false;
+  if (data.count("logging") > 0 && !ParseLogging(data["logging"], settings))
+    return false;
+  if (data.count("homing") > 0 &&
+      !ParseHoming(data["homing"], &settings->homing_optimizer))
+    return false;
+  if (data.count("rt_profile") > 0 &&
+      !ParseRtProfile(data["rt_profile"], &settings->rt_profile))
+    return false;
+  if (data.count("overrun_policy") > 0 &&
+      !ParseOverrunPolicy(data["overrun_policy"], &settings->overrun_budget))
+    return false;
+  return true;
+}
+
+bool AppSettingsJsonParser::ParseEthercat(const json& ethercat,
+                                          AppSettings* settings) const
+{
+  try
+  {
+    const std::string backend = ethercat.value("backend", std::string("hardware"));
+    if (backend == "hardware")
+      settings->ethercat_backend = ETHERCAT_HARDWARE;
+    else if (backend == "simulated")
+      settings->ethercat_backend = ETHERCAT_SIMULATED;
+    else
+    {
+      std::cerr << "[ERROR] Invalid ethercat backend: " << backend << std::endl;
+      return false;
+    }
+    if (ethercat.count("simulation") > 0)
+      return ParseSimDriveParams(ethercat["simulation"], &settings->sim_drive_params);
+  }
+  catch (json::type_error& e)
+  {
+    std::cerr << "[ERROR] " << e.what() << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool AppSettingsJsonParser::ParseSimDriveParams(const json& simulation,
+                                                SimDriveParams* params) const
+{
+  try
+  {
+    params->motor_inertia    = simulation.value("motor_inertia", params->motor_inertia);
+    params->viscous_friction =
+      simulation.value("viscous_friction", params->viscous_friction);
+    params->load_torque    = simulation.value("load_torque", params->load_torque);
+    params->load_stiffness = simulation.value("load_stiffness", params->load_stiffness);
+    params->rated_torque   = simulation.value("rated_torque", params->rated_torque);
+    params->max_torque     = simulation.value("max_torque", params->max_torque);
+    params->pos_loop_bandwidth =
+      simulation.value("pos_loop_bandwidth", params->pos_loop_bandwidth);
+    params->vel_loop_bandwidth =
+      simulation.value("vel_loop_bandwidth", params->vel_loop_bandwidth);
+    params->max_following_err =
+      simulation.value("max_following_err", params->max_following_err);
+    params->aux_encoder_coupling =
+      simulation.value("aux_encoder_coupling", params->aux_encoder_coupling);
+  }
+  catch (json::type_error& e)
+  {
+    std::cerr << "[ERROR] " << e.what() << std::endl;
+    return false;
+  }
+  if (params->motor_inertia <= 0.0 || params->rated_torque <= 0.0)
+  {
+    std::cerr << "[ERROR] Simulated drive inertia and rated torque must be positive"
+              << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool AppSettingsJsonParser::ParseLogging(const json& logging, AppSettings* settings) const
+{
+  try
+  {
+    const std::string format = logging.value("data_format", std::string("text"));
+    if (format == "text")
+      settings->data_log_format = DATA_LOG_TEXT;
+    else if (format == "binary")
+      settings->data_log_format = DATA_LOG_BINARY;
+    else
+    {
+      std::cerr << "[ERROR] Invalid data log format: " << format << std::endl;
+      return false;
+    }
+    settings->data_log_binary_filename =
+      logging.value("binary_file", settings->data_log_binary_filename);
+    settings->telemetry_dir = logging.value("telemetry_dir", settings->telemetry_dir);
+    settings->homing_dataset_dir =
+      logging.value("homing_dataset_dir", settings->homing_dataset_dir);
+  }
+  catch (json::type_error& e)
+  {
+    std::cerr << "[ERROR] " << e.what() << std::endl;
+    return false;
+  }
+  if (settings->data_log_binary_filename.empty() || settings->telemetry_dir.empty())
+  {
+    std::cerr << "[ERROR] Data log paths must not be empty" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool AppSettingsJsonParser::ParseHoming(const json& homing,
+                                        HomingOptimizerOptions* options) const
+{
+  try
+  {
+    options->confident_length_std =
+      homing.value("confident_length_std", options->confident_length_std);
+    options->confident_angle_std =
+      homing.value("confident_angle_std", options->confident_angle_std);
+  }
+  catch (json::type_error& e)
+  {
+    std::cerr << "[ERROR] " << e.what() << std::endl;
+    return false;
+  }
+  if (options->confident_length_std <= 0.0 || options->confident_angle_std <= 0.0)
+  {
+    std::cerr << "[ERROR] Homing confidence thresholds must be positive" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool AppSettingsJsonParser::ParseRtProfile(const json& rt_profile,
+                                           RtProfile* profile) const
+{
+  try
+  {
+    if (!ParseCpus(rt_profile, "rt_cpus", &profile->rt_cpus) ||
+        !ParseCpus(rt_profile, "log_cpus", &profile->log_cpus) ||
+        !ParseCpus(rt_profile, "gui_cpus", &profile->gui_cpus))
+      return false;
+    const std::string policy = rt_profile.value("sched_policy", std::string("unchanged"));
+    if (policy == "unchanged")
+      profile->sched_policy = RT_SCHED_UNCHANGED;
+    else if (policy == "fifo")
+      profile->sched_policy = RT_SCHED_FIFO;
+    else if (policy == "rr")
+      profile->sched_policy = RT_SCHED_RR;
+    else if (policy == "other")
+      profile->sched_policy = RT_SCHED_OTHER;
+    else
+    {
+      std::cerr << "[ERROR] Invalid RT scheduling policy: " << policy << std::endl;
+      return false;
+    }
+    profile->sched_priority = rt_profile.value("sched_priority", profile->sched_priority);
+    profile->lock_memory    = rt_profile.value("lock_memory", profile->lock_memory);
+    profile->prefault_stack_size =
+      rt_profile.value("prefault_stack_size", profile->prefault_stack_size);
+    profile->prefault_heap_size =
+      rt_profile.value("prefault_heap_size", profile->prefault_heap_size);
+  }
+  catch (json::type_error& e)
+  {
+    std::cerr << "[ERROR] " << e.what() << std::endl;
+    return false;
+  }
+  if ((profile->sched_policy == RT_SCHED_FIFO || profile->sched_policy == RT_SCHED_RR) &&
+      (profile->sched_priority < sched_get_priority_min(SCHED_FIFO) ||
+       profile->sched_priority > sched_get_priority_max(SCHED_FIFO)))
+  {
+    std::cerr << "[ERROR] RT scheduling priority must be between "
+              << sched_get_priority_min(SCHED_FIFO) << " and "
+              << sched_get_priority_max(SCHED_FIFO) << std::endl;
+    return false;
+  }
+  if (profile->prefault_stack_size > kMaxPrefaultStackSize_)
+  {
+    std::cerr << "[ERROR] RT thread stack to be prefaulted must not exceed "
+              << kMaxPrefaultStackSize_ << " bytes" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool AppSettingsJsonParser::ParseOverrunPolicy(const json& overrun_policy,
+                                               OverrunBudget* budget) const
+{
+  try
+  {
+    budget->enabled = overrun_policy.value("enabled", budget->enabled);
+    if (!ParseCount(overrun_policy, "max_consecutive", &budget->max_consecutive) ||
+        !ParseCount(overrun_policy, "max_total", &budget->max_total) ||
+        !ParseCount(overrun_policy, "recovery_cycles", &budget->recovery_cycles) ||
+        !ParseCount(overrun_policy, "max_holds", &budget->max_holds))
+      return false;
+  }
+  catch (json::type_error& e)
+  {
+    std::cerr << "[ERROR] " << e.what() << std::endl;
+    return false;
+  }
+  if (budget->recovery_cycles == 0)
+  {
+    std::cerr << "[ERROR] Overrun recovery cycles must be positive" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool AppSettingsJsonParser::ParseCount(const json& parent, const std::string& key,
+                                       uint32_t* count) const
+{
+  // Parsed as signed, so that negative values are not silently wrapped around
+  const int64_t value = parent.value(key, static_cast<int64_t>(*count));
+  if (value < 0 || value > UINT32_MAX)
+  {
+    std::cerr << "[ERROR] Invalid count: " << key << std::endl;
+    return false;
+  }
+  *count = static_cast<uint32_t>(value);
+  return true;
+}
+
+bool AppSettingsJsonParser::ParseCpus(const json& parent, const std::string& key,
+                                      std::vector<int>* cpus) const
+{
+  if (parent.count(key) == 0)
+    return true;
+  const json& value = parent[key];
+  if (value.is_string())
+  {
+    if (ParseCpuList(value.get<std::string>(), cpus))
+      return true;
+  }
+  else
+  {
+    *cpus = value.get<std::vector<int>>();
+    std::sort(cpus->begin(), cpus->end());
+    cpus->erase(std::unique(cpus->begin(), cpus->end()), cpus->end());
+    if (cpus->empty() || (cpus->front() >= 0 && cpus->back() < CPU_SETSIZE))
+      return true;
+  }
+  std::cerr << "[ERROR] Invalid CPU list: " << key << std::endl;
+  return false;
+}
@@ -0,0 +1,320 @@
+/**
+ * @file binary_log.cpp
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing definitions of functions and classes declared in binary_log.h.
+ */
+
+#include "utils/binary_log.h"
+
+namespace {
+
+const char kMagic[]      = {'C', 'R', 'B', 'I', 'N', 'L', 'O', 'G'};
+const uint32_t kVersion  = 1;
+const size_t kHeaderSize = sizeof(uint32_t) + sizeof(double); // msg type + timestamp
+// Sanity checks against corrupted headers, way above any actual message set
+const uint32_t kMaxSchemasNum = 256;
+const uint16_t kMaxFieldsNum  = 256; // each field takes at least one byte of a record
+
+uint64_t DecodeLittleEndian(const char* data, const size_t size)
+{
+  uint64_t value = 0;
+  for (size_t i = 0; i < size; i++)
+    value |= static_cast<uint64_t>(static_cast<uint8_t>(data[i])) << (8 * i);
+  return value;
+}
+
+template <typename T> bool WriteValue(FILE* file, const T& value)
+{
+  char data[WireSize<T>()];
+  WireWrite(data, value);
+  return fwrite(data, 1, sizeof(data), file) == sizeof(data);
+}
+
+template <typename T> bool ReadValue(FILE* file, T* value)
+{
+  char data[WireSize<T>()];
+  if (fread(data, 1, sizeof(data), file) != sizeof(data))
+    return false;
+  WireRead(data, value);
+  return true;
+}
+
+bool WriteName(FILE* file, const std::string& name)
+{
+  const uint16_t length = static_cast<uint16_t>(name.size());
+  return WriteValue(file, length) && fwrite(name.data(), 1, length, file) == length;
+}
+
+} // end namespace
+
+size_t BinaryFieldSize(const BinaryFieldType type)
+{
+  switch (type)
+  {
+    case BIN_INT8:
+    case BIN_UINT8:
+      return 1;
+    case BIN_INT16:
+    case BIN_UINT16:
+      return 2;
+    case BIN_INT32:
+    case BIN_UINT32:
+    case BIN_FLOAT32:
+      return 4;
+    case BIN_INT64:
+    case BIN_UINT64:
+    case BIN_FLOAT64:
+      return 8;
+    default:
+      return 0;
+  }
+}
+
+const char* BinaryReadStatusName(const BinaryReadStatus status)
+{
+  switch (status)
+  {
+    case BIN_READ_OK:
+      return "ok";
+    case BIN_READ_EOF:
+      return "end of file";
+    case BIN_READ_TRUNCATED:
+      return "truncated record";
+    case BIN_READ_UNKNOWN_TYPE:
+      return "unknown message type";
+    case BIN_READ_ERROR:
+      return "read error";
+  }
+  return "unknown";
+}
+
+size_t BinaryMsgSchema::RecordSize() const
+{
+  size_t size = kHeaderSize;
+  for (const BinaryMsgField& field : fields)
+    size += BinaryFieldSize(field.type);
+  return size;
+}
+
+//------------------------------------------------------------------------------------//
+//--------- BinaryLogWriter class ----------------------------------------------------//
+//------------------------------------------------------------------------------------//
+
+constexpr size_t BinaryLogWriter::kMaxRecordSize_;
+
+BinaryLogWriter::BinaryLogWriter(const size_t buffer_size /*= 1 << 16*/)
+  : buffer_(buffer_size > kMaxRecordSize_ ? buffer_size : kMaxRecordSize_)
+{}
+
+BinaryLogWriter::~BinaryLogWriter() { Close(); }
+
+//--------- Public functions ---------------------------------------------------------//
+
+bool BinaryLogWriter::Open(const std::string& filename,
+                           const std::vector<BinaryMsgSchema>& schemas)
+{
+  Close();
+  for (const BinaryMsgSchema& schema : schemas)
+    if (schema.RecordSize() > kMaxRecordSize_)
+      return false;
+
+  file_ = fopen(filename.c_str(), "wb");
+  if (file_ == NULL)
+    return false;
+
+  bool ok = fwrite(kMagic, 1, sizeof(kMagic), file_) == sizeof(kMagic) &&
+            WriteValue(file_, kVersion) &&
+            WriteValue(file_, static_cast<uint32_t>(schemas.size()));
+  for (const BinaryMsgSchema& schema : schemas)
+  {
+    ok = ok && WriteValue(file_, schema.msg_type) && WriteName(file_, schema.name) &&
+         WriteValue(file_, static_cast<uint16_t>(schema.fields.size()));
+    for (const BinaryMsgField& field : schema.fields)
+      ok = ok && WriteValue(file_, static_cast<uint8_t>(field.type)) &&
+           WriteName(file_, field.name);
+  }
+  if (!ok || fflush(file_) != 0)
+  {
+    fclose(file_);
+    file_ = NULL;
+    return false;
+  }
+  buffer_len_ = 0;
+  return true;
+}
+
+void BinaryLogWriter::Close()
+{
+  if (!IsOpen())
+    return;
+  Flush();
+  fclose(file_);
+  file_ = NULL;
+}
+
+bool BinaryLogWriter::Flush()
+{
+  if (!IsOpen())
+    return false;
+  const size_t written = fwrite(buffer_.data(), 1, buffer_len_, file_);
+  const bool ok        = written == buffer_len_ && fflush(file_) == 0;
+  buffer_len_          = 0; // records which could not be written are lost anyway
+  return ok;
+}
+
+//------------------------------------------------------------------------------------//
+//--------- BinaryLogReader class ----------------------------------------------------//
+//------------------------------------------------------------------------------------//
+
+BinaryLogReader::~BinaryLogReader() { Close(); }
+
+//--------- Public functions ---------------------------------------------------------//
+
+bool BinaryLogReader::Open(const std::string& filename)
+{
+  Close();
+  file_ = fopen(filename.c_str(), "rb");
+  if (file_ == NULL)
+    return false;
+  if (!ReadHeader())
+  {
+    Close();
+    return false;
+  }
+  return true;
+}
+
+void BinaryLogReader::Close()
+{
+  if (file_ != NULL)
+    fclose(file_);
+  file_ = NULL;
+  schemas_.clear();
+}
+
+BinaryReadStatus BinaryLogReader::ReadRecord(BinaryLogRecord* record)
+{
+  if (file_ == NULL)
+    return BIN_READ_ERROR;
+
+  // Nothing at all past the previous record is the only regular end of file
+  char msg_type_data[WireSize<uint32_t>()];
+  const size_t read_size = fread(msg_type_data, 1, sizeof(msg_type_data), file_);
+  if (read_size != sizeof(msg_type_data))
+  {
+    if (ferror(file_))
+      return BIN_READ_ERROR;
+    return read_size == 0 ? BIN_READ_EOF : BIN_READ_TRUNCATED;
+  }
+  uint32_t msg_type;
+  WireRead(msg_type_data, &msg_type);
+  record->schema = NULL;
+  for (const BinaryMsgSchema& schema : schemas_)
+    if (schema.msg_type == msg_type)
+    {
+      record->schema = &schema;
+      break;
+    }
+  if (record->schema == NULL)
+    return BIN_READ_UNKNOWN_TYPE;
+
+  const size_t body_size = record->schema->RecordSize() - sizeof(msg_type);
+  record_buffer_.resize(body_size);
+  if (fread(record_buffer_.data(), 1, body_size, file_) != body_size)
+    return ferror(file_) ? BIN_READ_ERROR : BIN_READ_TRUNCATED;
+
+  const char* cursor           = record_buffer_.data();
+  const uint64_t raw_timestamp = DecodeLittleEndian(cursor, sizeof(double));
+  memcpy(&record->timestamp, &raw_timestamp, sizeof(double));
+  cursor += sizeof(double);
+
+  record->values.resize(record->schema->fields.size());
+  for (size_t i = 0; i < record->values.size(); i++)
+  {
+    BinaryFieldValue& value = record->values[i];
+    value.type              = record->schema->fields[i].type;
+    const size_t size       = BinaryFieldSize(value.type);
+    const uint64_t raw      = DecodeLittleEndian(cursor, size);
+    cursor += size;
+    switch (value.type)
+    {
+      case BIN_INT8:
+        value.i = static_cast<int8_t>(raw);
+        break;
+      case BIN_INT16:
+        value.i = static_cast<int16_t>(raw);
+        break;
+      case BIN_INT32:
+        value.i = static_cast<int32_t>(raw);
+        break;
+      case BIN_INT64:
+        value.i = static_cast<int64_t>(raw);
+        break;
+      case BIN_FLOAT32:
+      {
+        const uint32_t raw32 = static_cast<uint32_t>(raw);
+        float f;
+        memcpy(&f, &raw32, sizeof(f));
+        value.f = f;
+        break;
+      }
+      case BIN_FLOAT64:
+        memcpy(&value.f, &raw, sizeof(value.f));
+        break;
+      default: // unsigned integers
+        value.u = raw;
+        break;
+    }
+  }
+  return BIN_READ_OK;
+}
+
+//--------- Private functions --------------------------------------------------------//
+
+bool BinaryLogReader::ReadHeader()
+{
+  char magic[sizeof(kMagic)];
+  uint32_t version;
+  uint32_t schemas_num;
+  if (fread(magic, 1, sizeof(magic), file_) != sizeof(magic) ||
+      memcmp(magic, kMagic, sizeof(kMagic)) != 0 || !ReadValue(file_, &version) ||
+      version != kVersion || !ReadValue(file_, &schemas_num))
+    return false;
+
+  if (schemas_num > kMaxSchemasNum)
+    return false;
+
+  // Entries are appended as they are read, so that a truncated file never makes the
+  // reader allocate more than what it actually contains
+  schemas_.clear();
+  for (uint32_t i = 0; i < schemas_num; i++)
+  {
+    BinaryMsgSchema schema;
+    uint16_t fields_num;
+    if (!ReadValue(file_, &schema.msg_type) || !ReadName(&schema.name) ||
+        !ReadValue(file_, &fields_num) || fields_num > kMaxFieldsNum)
+      return false;
+    for (uint16_t j = 0; j < fields_num; j++)
+    {
+      BinaryMsgField field;
+      uint8_t type;
+      if (!ReadValue(file_, &type) || type >= BIN_MAX_FIELD_TYPES ||
+          !ReadName(&field.name))
+        return false;
+      field.type = static_cast<BinaryFieldType>(type);
+      schema.fields.push_back(field);
+    }
+    schemas_.push_back(schema);
+  }
+  return true;
+}
+
+bool BinaryLogReader::ReadName(std::string* name)
+{
+  uint16_t length;
+  if (!ReadValue(file_, &length))
+    return false;
+  name->resize(length);
+  return length == 0 || fread(&(*name)[0], 1, length, file_) == length;
+}
@@ -8,6 +8,8 @@
 
 #include "utils/easylog_wrapper.h"
 
+#include <cstring>
+
 void LogMotorStatusMsg(el::Logger* data_logger, const MotorStatusMsg& msg)
 {
   // clang-format off
@@ -56,103 +58,179 @@ void LogActuatorStatusMsg(el::Logger* data_logger, const ActuatorStatusMsg& msg)
   // clang-format on
 }
 
+void LogActuatorTelemetryMsg(el::Logger* data_logger, const ActuatorTelemetryMsg& msg)
+{
+  // clang-format off
+  data_logger->info("%v,%v,%v,%v,%v,%v,%v,%v,%v,%v,%v,%v,%v",
+                                                      msg.header.msg_type,
+                                                      msg.header.timestamp,
+                                     static_cast<int>(msg.body.status.id),
+                                     static_cast<int>(msg.body.status.op_mode),
+                                                      msg.body.status.motor_position,
+                                                      msg.body.status.motor_speed,
+                                                      msg.body.status.motor_torque,
+                                                      msg.body.status.cable_length,
+                                                      msg.body.status.aux_position,
+                                     static_cast<int>(msg.body.status.state),
+                                                      msg.body.status.pulley_angle,
+                                     static_cast<int>(msg.body.ctrl_mode),
+                                                      msg.body.setpoint);
+  // clang-format on
+}
+
+void LogPlatformPoseMsg(el::Logger* data_logger, const PlatformPoseMsg& msg)
+{
+  // clang-format off
+  data_logger->info("%v,%v,%v,%v,%v,%v,%v,%v,%v,%v,%v",
+                                                      msg.header.msg_type,
+                                                      msg.header.timestamp,
+                                                      msg.body.position_x,
+                                                      msg.body.position_y,
+                                                      msg.body.position_z,
+                                                      msg.body.angle_x,
+                                                      msg.body.angle_y,
+                                                      msg.body.angle_z,
+                                                      msg.body.residual_norm,
+                                     static_cast<int>(msg.body.iterations),
+                                     static_cast<int>(msg.body.converged));
+  // clang-format on
+}
+
 // ... add new message log function definition here
 
 //------------------------------------------------------------------------------------//
 //--------- LogBuffer class ----------------------------------------------------------//
 //------------------------------------------------------------------------------------//
 
+constexpr size_t LogBuffer::kSlotSize_;
+constexpr size_t LogBuffer::kBatchSize_;
+constexpr long LogBuffer::kIdleFlushMsec_;
+
 //--------- Public function/slot -----------------------------------------------------//
 
+bool LogBuffer::SetBinaryOutput(const std::string& filename)
+{
+  // Header carries the schema of every loggable message
+  const std::vector<BinaryMsgSchema> schemas = {MotorStatusMsg::binarySchema(),
+                                                WinchStatusMsg::binarySchema(),
+                                                ActuatorStatusMsg::binarySchema(),
+                                                ActuatorTelemetryMsg::binarySchema(),
+                                                PlatformPoseMsg::binarySchema()};
+  // ... add new message schema here
+  return binary_writer_.Open(filename, schemas);
+}
+
 void LogBuffer::Stop()
 {
-  mutex_.lock();
-  stop_requested_ = true;
-  buffer_not_empty.wakeAll();
-  mutex_.unlock();
+  stop_requested_.store(true, std::memory_order_release);
+  wakeup_.Wake();
   wait();
+
+  const Stats stats = GetStats();
+  if (stats.dropped > 0)
+    CLOG(WARNING, "event") << "Data log lost " << stats.dropped
+                           << " messages (buffer size: " << stats.capacity
+                           << ", high-water mark: " << stats.high_water_mark << ")";
+}
+
+bool LogBuffer::Push(const char* data, const size_t size)
+{
+  static_assert(kSlotSize_ >= kMaxMsgSize, "Log buffer slots too small for messages");
+  if (size > kSlotSize_)
+    return false;
+  const bool pushed = buffer_.Emplace([data, size](Slot& slot) {
+    slot.size = static_cast<quint16>(size);
+    memcpy(slot.data, data, size);
+  });
+  if (pushed)
+    wakeup_.Notify();
+  return pushed;
+}
+
+LogBuffer::Stats LogBuffer::GetStats() const
+{
+  Stats stats;
+  stats.capacity        = buffer_.Capacity();
+  stats.pushed          = buffer_.PushedCount();
+  stats.dropped         = buffer_.DroppedCount();
+  stats.high_water_mark = buffer_.HighWaterMark();
+  return stats;
 }
 
 void LogBuffer::collectMsg(QByteArray msg)
 {
-  static quint64 linear_cnt = 0;
-
-  // Wait until buffer is no longer full
-  mutex_.lock();
-  if (circular_cnt_ == buffer_.size())
-    buffer_not_full.wait(&mutex_);
-  mutex_.unlock();
-
-  // Add cast data to buffer
-  quint16 index = static_cast<quint16>(linear_cnt % buffer_.size());
-  buffer_[index].replace(0, msg.size(), msg);
-  linear_cnt++;
-
-  // Update circular counter and notify buffer is no longer empty
-  mutex_.lock();
-  ++circular_cnt_;
-  buffer_not_empty.wakeAll();
-  mutex_.unlock();
+  Push(msg.constData(), static_cast<size_t>(msg.size()));
 }
 
 //--------- Private functions --------------------------------------------------------//
 
+template <class MsgT>
+void LogBuffer::LogMsg(const MsgT& msg, void (*log_text)(el::Logger*, const MsgT&))
+{
+  if (binary_writer_.IsOpen())
+    binary_writer_.Write(msg);
+  else
+    log_text(logger_, msg);
+}
+
 void LogBuffer::run()
 {
-  quint64 linear_cnt = 0;
+  if (!cpus_.empty() && !SetThreadCpus(pthread_self(), cpus_))
+    CLOG(WARNING, "event") << "Could not restrict log thread to CPUs "
+                           << FormatCpuList(cpus_);
+
   while (1)
   {
-    // If buffer is empty, wait until new data is available or user stop request
-    mutex_.lock();
-    if (circular_cnt_ == 0)
+    // Read stop request first, so that nothing pushed before it is left behind
+    const bool stop_requested = stop_requested_.load(std::memory_order_acquire);
+    const size_t batch_size   = buffer_.Pop(batch_, kBatchSize_);
+    if (batch_size == 0)
     {
-      if (!stop_requested_) // need this is case buffer empties out after a stop request
-        buffer_not_empty.wait(&mutex_);
-      if (stop_requested_)
-      {
-        mutex_.unlock();
+      if (stop_requested)
         break;
-      }
+      // Binary records are written in big batches, unless data flow stops for a while
+      if (!wakeup_.Wait([this]() { return buffer_.Empty(); }, kIdleFlushMsec_))
+        binary_writer_.Flush();
+      QCoreApplication::processEvents();
+      continue;
     }
-    mutex_.unlock();
-
-    QCoreApplication::processEvents();
 
     // Actual logging step
-    quint16 index = static_cast<quint16>(linear_cnt % buffer_.size());
-    LogData(index);
-    linear_cnt++;
-
-    // Update circular counter and notify buffer is no longer full
-    mutex_.lock();
-    --circular_cnt_;
-    buffer_not_full.wakeAll();
-    mutex_.unlock();
+    for (size_t i = 0; i < batch_size; i++)
+      LogData(batch_[i]);
 
     QCoreApplication::processEvents();
   }
+  binary_writer_.Close();
 }
 
-void LogBuffer::LogData(const quint16 index)
+void LogBuffer::LogData(const Slot& slot)
 {
-  QDataStream stream(buffer_[index]);
-  stream.setVersion(QDataStream::Qt_4_5);
-  stream >> header_;
+  // Peek at the header only, bodies are deserialized straight from slot memory
+  WireRead(slot.data, &header_);
   switch (header_.msg_type)
   {
     case NULL_MSG:
       break;
     case MOTOR_STATUS:
-      motor_status_.deserialize(buffer_[index]);
-      LogMotorStatusMsg(logger_, motor_status_);
+      motor_status_.deserialize(slot.data, slot.size);
+      LogMsg(motor_status_, LogMotorStatusMsg);
       break;
     case WINCH_STATUS:
-      winch_status_.deserialize(buffer_[index]);
-      LogWinchStatusMsg(logger_, winch_status_);
+      winch_status_.deserialize(slot.data, slot.size);
+      LogMsg(winch_status_, LogWinchStatusMsg);
       break;
     case ACTUATOR_STATUS:
-      actuator_status_.deserialize(buffer_[index]);
-      LogActuatorStatusMsg(logger_, actuator_status_);
+      actuator_status_.deserialize(slot.data, slot.size);
+      LogMsg(actuator_status_, LogActuatorStatusMsg);
+      break;
+    case ACTUATOR_TELEMETRY:
+      actuator_telemetry_.deserialize(slot.data, slot.size);
+      LogMsg(actuator_telemetry_, LogActuatorTelemetryMsg);
+      break;
+    case PLATFORM_POSE:
+      platform_pose_.deserialize(slot.data, slot.size);
+      LogMsg(platform_pose_, LogPlatformPoseMsg);
       break;
       // ... add new case here
   }
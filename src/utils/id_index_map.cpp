@@ -0,0 +1,23 @@
+/**
+ * @file id_index_map.cpp
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing definitions of functions and class declared in id_index_map.h.
+ */
+
+#include "utils/id_index_map.h"
+
+constexpr size_t IdIndexMap::kNotFound;
+
+IdIndexMap::IdIndexMap(const std::vector<id_t>& ids) : ids_(ids)
+{
+  id_t max_id = 0;
+  for (const id_t id : ids_)
+    if (id > max_id)
+      max_id = id;
+  if (!ids_.empty())
+    slots_.resize(max_id + 1, kNotFound);
+  for (size_t i = 0; i < ids_.size(); i++)
+    if (slots_[ids_[i]] == kNotFound)
+      slots_[ids_[i]] = i;
+}
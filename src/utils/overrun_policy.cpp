@@ -0,0 +1,123 @@
+/**
+ * @file overrun_policy.cpp
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing definitions of functions and class declared in
+ * overrun_policy.h.
+ */
+
+#include "utils/overrun_policy.h"
+
+OverrunPolicy::OverrunPolicy() : period_nsec_(1000000), reset_requested_(false)
+{
+  ResetNow();
+}
+
+void OverrunPolicy::Setup(const uint64_t period_nsec, const OverrunBudget& budget)
+{
+  period_nsec_ = period_nsec;
+  budget_      = budget;
+  ResetNow();
+  reset_requested_.store(false, std::memory_order_relaxed);
+}
+
+//--------- Writer side --------------------------------------------------------------//
+
+OverrunPolicy::States OverrunPolicy::Update(const uint64_t prev_work_nsec,
+                                            const uint64_t missed_cycles)
+{
+  // Exchange, so that a request coming in between check and clear is not lost
+  if (reset_requested_.exchange(false, std::memory_order_relaxed))
+    ResetNow();
+
+  // Single writer: plain load/store pairs are enough and cheaper than read-modify-write.
+  if (missed_cycles > 0)
+  {
+    cycle_overrun_ = SKIPPED;
+    skipped_count_.store(skipped_count_.load(std::memory_order_relaxed) + 1,
+                         std::memory_order_relaxed);
+    lost_cycles_count_.store(
+      lost_cycles_count_.load(std::memory_order_relaxed) + missed_cycles,
+      std::memory_order_relaxed);
+  }
+  else if (prev_work_nsec > period_nsec_)
+  {
+    cycle_overrun_ = LATE;
+    late_count_.store(late_count_.load(std::memory_order_relaxed) + 1,
+                      std::memory_order_relaxed);
+  }
+  else
+    cycle_overrun_ = ON_TIME;
+
+  States state = state_.load(std::memory_order_relaxed);
+  if (!budget_.enabled || state == ST_ESCALATED)
+    return state;
+
+  if (cycle_overrun_ == ON_TIME)
+  {
+    consecutive_ = 0;
+    if (state == ST_HOLD && ++on_time_cycles_ >= budget_.recovery_cycles)
+    {
+      // Recovered: budget is renewed, holds are still accounted for
+      total_ = 0;
+      state  = ST_NOMINAL;
+      state_.store(state, std::memory_order_relaxed);
+    }
+    return state;
+  }
+
+  consecutive_++;
+  total_++;
+  on_time_cycles_ = 0;
+  if (!BudgetExceeded())
+    return state;
+
+  if (state == ST_HOLD || HoldsCount() >= budget_.max_holds)
+    state = ST_ESCALATED;
+  else
+  {
+    state        = ST_HOLD;
+    consecutive_ = 0;
+    total_       = 0;
+    holds_count_.store(HoldsCount() + 1, std::memory_order_relaxed);
+  }
+  state_.store(state, std::memory_order_relaxed);
+  return state;
+}
+
+//--------- Reader side --------------------------------------------------------------//
+
+const char* OverrunPolicy::StateName(const States state)
+{
+  switch (state)
+  {
+    case ST_NOMINAL:
+      return "nominal";
+    case ST_HOLD:
+      return "hold";
+    case ST_ESCALATED:
+      return "escalated";
+  }
+  return "unknown";
+}
+
+//--------- Private functions --------------------------------------------------------//
+
+void OverrunPolicy::ResetNow()
+{
+  state_.store(ST_NOMINAL, std::memory_order_relaxed);
+  late_count_.store(0, std::memory_order_relaxed);
+  skipped_count_.store(0, std::memory_order_relaxed);
+  lost_cycles_count_.store(0, std::memory_order_relaxed);
+  holds_count_.store(0, std::memory_order_relaxed);
+  cycle_overrun_  = ON_TIME;
+  consecutive_    = 0;
+  total_          = 0;
+  on_time_cycles_ = 0;
+}
+
+bool OverrunPolicy::BudgetExceeded() const
+{
+  return consecutive_ > budget_.max_consecutive ||
+         (budget_.max_total > 0 && total_ > budget_.max_total);
+}
@@ -0,0 +1,136 @@
+/**
+ * @file rt_alloc_guard.cpp
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing definitions of functions and class declared in
+ * rt_alloc_guard.h, including the allocator interposition.
+ */
+
+#include "utils/rt_alloc_guard.h"
+
+#ifdef CABLE_ROBOT_RT_ALLOC_GUARD
+
+#include <atomic>
+#include <errno.h>
+#include <signal.h>
+#include <stddef.h>
+#include <unistd.h>
+
+// glibc allocator entry points, used by the wrappers below to forward the requests.
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t num, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void* __libc_memalign(size_t alignment, size_t size);
+}
+
+namespace {
+
+// Initial-exec TLS to make sure no allocation is needed to access these variables from
+// inside the allocator itself.
+__thread bool armed __attribute__((tls_model("initial-exec"))) = false;
+
+std::atomic<uint64_t> violations_count(0);
+std::atomic<bool> trap_on_violation(true);
+std::atomic<bool> report_on_violation(true);
+
+void ReportViolation(const char* func)
+{
+  violations_count.fetch_add(1, std::memory_order_relaxed);
+  if (!report_on_violation.load(std::memory_order_relaxed))
+    return;
+  // Disarm while reporting to avoid recursion, and only use async-signal-safe calls.
+  armed = false;
+  static const char kMsg[] = "[RtAllocGuard] ERROR: heap allocation in RT section: ";
+  ssize_t ret              = write(STDERR_FILENO, kMsg, sizeof(kMsg) - 1);
+  size_t len               = 0;
+  while (func[len] != '\0')
+    len++;
+  ret = write(STDERR_FILENO, func, len);
+  ret = write(STDERR_FILENO, "\n", 1);
+  (void)ret;
+  if (trap_on_violation.load(std::memory_order_relaxed))
+    raise(SIGTRAP);
+  armed = true;
+}
+
+} // end namespace
+
+void RtAllocGuard::Arm() { armed = true; }
+
+void RtAllocGuard::Disarm() { armed = false; }
+
+bool RtAllocGuard::IsArmed() { return armed; }
+
+void RtAllocGuard::SetTrapOnViolation(const bool value)
+{
+  trap_on_violation.store(value, std::memory_order_relaxed);
+}
+
+void RtAllocGuard::SetReportOnViolation(const bool value)
+{
+  report_on_violation.store(value, std::memory_order_relaxed);
+}
+
+uint64_t RtAllocGuard::ViolationsCount()
+{
+  return violations_count.load(std::memory_order_relaxed);
+}
+
+//--------- Allocator interposition ------------------------------------------------//
+
+extern "C" {
+
+void* malloc(size_t size)
+{
+  if (armed)
+    ReportViolation("malloc");
+  return __libc_malloc(size);
+}
+
+void* calloc(size_t num, size_t size)
+{
+  if (armed)
+    ReportViolation("calloc");
+  return __libc_calloc(num, size);
+}
+
+void* realloc(void* ptr, size_t size)
+{
+  if (armed)
+    ReportViolation("realloc");
+  return __libc_realloc(ptr, size);
+}
+
+void* memalign(size_t alignment, size_t size)
+{
+  if (armed)
+    ReportViolation("memalign");
+  return __libc_memalign(alignment, size);
+}
+
+void* aligned_alloc(size_t alignment, size_t size)
+{
+  if (armed)
+    ReportViolation("aligned_alloc");
+  return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void** memptr, size_t alignment, size_t size)
+{
+  if (armed)
+    ReportViolation("posix_memalign");
+  // POSIX requires a power of two multiple of sizeof(void*)
+  if (alignment == 0 || alignment % sizeof(void*) != 0 ||
+      (alignment & (alignment - 1)) != 0)
+    return EINVAL;
+  void* ptr = __libc_memalign(alignment, size);
+  if (ptr == NULL)
+    return ENOMEM;
+  *memptr = ptr;
+  return 0;
+}
+
+} // extern "C"
+
+#endif // CABLE_ROBOT_RT_ALLOC_GUARD
@@ -0,0 +1,296 @@
+/**
+ * @file rt_profile.cpp
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing definitions of functions declared in rt_profile.h.
+ */
+
+#include "utils/rt_profile.h"
+
+#include <alloca.h>
+#include <malloc.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+
+namespace {
+
+int SchedPolicy(const RtSchedPolicy policy)
+{
+  switch (policy)
+  {
+    case RT_SCHED_FIFO:
+      return SCHED_FIFO;
+    case RT_SCHED_RR:
+      return SCHED_RR;
+    default:
+      return SCHED_OTHER;
+  }
+}
+
+const char* SchedPolicyName(const RtSchedPolicy policy)
+{
+  switch (policy)
+  {
+    case RT_SCHED_FIFO:
+      return "SCHED_FIFO";
+    case RT_SCHED_RR:
+      return "SCHED_RR";
+    case RT_SCHED_OTHER:
+      return "SCHED_OTHER";
+    default:
+      return "unchanged";
+  }
+}
+
+size_t PageSize()
+{
+  const long page_size = sysconf(_SC_PAGESIZE);
+  return page_size > 0 ? static_cast<size_t>(page_size) : 4096;
+}
+
+void PrefaultStack(const size_t size)
+{
+  // Touch one byte per page of a frame as big as requested, released upon return.
+  volatile char* stack   = static_cast<volatile char*>(alloca(size));
+  const size_t page_size = PageSize();
+  for (size_t i = 0; i < size; i += page_size)
+    stack[i] = 0;
+}
+
+// Content of a sysfs file, first line only, empty if it cannot be read.
+std::string ReadSysfs(const std::string& filename)
+{
+  std::ifstream ifile(filename);
+  std::string line;
+  if (ifile.is_open())
+    std::getline(ifile, line);
+  return line;
+}
+
+std::vector<int> Intersection(const std::vector<int>& a, const std::vector<int>& b)
+{
+  std::vector<int> common;
+  std::set_intersection(a.begin(), a.end(), b.begin(), b.end(),
+                        std::back_inserter(common));
+  return common;
+}
+
+std::vector<int> Difference(const std::vector<int>& a, const std::vector<int>& b)
+{
+  std::vector<int> diff;
+  std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(diff));
+  return diff;
+}
+
+} // end namespace
+
+//--------- Public functions ---------------------------------------------------------//
+
+bool ParseCpuList(const std::string& list, std::vector<int>* cpus)
+{
+  cpus->clear();
+  std::stringstream stream(list.substr(0, list.find('\n')));
+  std::string range;
+  while (std::getline(stream, range, ','))
+  {
+    if (range.empty())
+      continue;
+    const size_t dash = range.find('-');
+    char* end;
+    const long first = strtol(range.c_str(), &end, 10);
+    if (end == range.c_str() || (dash == std::string::npos && *end != '\0'))
+      return false;
+    long last = first;
+    if (dash != std::string::npos)
+    {
+      const char* last_str = range.c_str() + dash + 1;
+      last                 = strtol(last_str, &end, 10);
+      if (end == last_str || *end != '\0')
+        return false;
+    }
+    if (first < 0 || last < first || last >= CPU_SETSIZE)
+      return false;
+    for (long cpu = first; cpu <= last; cpu++)
+      cpus->push_back(static_cast<int>(cpu));
+  }
+  std::sort(cpus->begin(), cpus->end());
+  cpus->erase(std::unique(cpus->begin(), cpus->end()), cpus->end());
+  return true;
+}
+
+std::string FormatCpuList(const std::vector<int>& cpus)
+{
+  std::stringstream list;
+  for (size_t i = 0; i < cpus.size(); i++)
+  {
+    size_t j = i;
+    while (j + 1 < cpus.size() && cpus[j + 1] == cpus[j] + 1)
+      j++;
+    if (i > 0)
+      list << ",";
+    list << cpus[i];
+    if (j > i)
+      list << "-" << cpus[j];
+    i = j;
+  }
+  return list.str();
+}
+
+bool SetThreadCpus(const pthread_t thread, const std::vector<int>& cpus)
+{
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  for (const int cpu : cpus)
+    if (cpu >= 0 && cpu < CPU_SETSIZE)
+      CPU_SET(cpu, &cpu_set);
+  return pthread_setaffinity_np(thread, sizeof(cpu_set), &cpu_set) == 0;
+}
+
+bool GetThreadCpus(const pthread_t thread, std::vector<int>* cpus)
+{
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  if (pthread_getaffinity_np(thread, sizeof(cpu_set), &cpu_set) != 0)
+    return false;
+  cpus->clear();
+  for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+    if (CPU_ISSET(cpu, &cpu_set))
+      cpus->push_back(cpu);
+  return true;
+}
+
+bool LockProcessMemory() { return mlockall(MCL_CURRENT | MCL_FUTURE) == 0; }
+
+void PrefaultHeap(const size_t size)
+{
+  // Never give freed memory back to the system, nor serve big chunks with separate
+  // mappings, so that the prefaulted chunk is reused by later allocations.
+  mallopt(M_TRIM_THRESHOLD, -1);
+  mallopt(M_MMAP_MAX, 0);
+  if (size == 0)
+    return;
+  volatile char* heap = static_cast<volatile char*>(malloc(size));
+  if (heap == NULL)
+    return;
+  const size_t page_size = PageSize();
+  for (size_t i = 0; i < size; i += page_size)
+    heap[i] = 0;
+  free(const_cast<char*>(heap));
+}
+
+bool ApplyRtThreadProfile(const RtProfile& profile)
+{
+  bool success = true;
+  if (!profile.rt_cpus.empty())
+    success = SetThreadCpus(pthread_self(), profile.rt_cpus) && success;
+  if (profile.sched_policy != RT_SCHED_UNCHANGED)
+  {
+    const int policy = SchedPolicy(profile.sched_policy);
+    sched_param param;
+    param.sched_priority = policy == SCHED_OTHER ? 0 : profile.sched_priority;
+    success = pthread_setschedparam(pthread_self(), policy, &param) == 0 && success;
+  }
+  if (profile.prefault_stack_size > 0)
+    PrefaultStack(profile.prefault_stack_size);
+  return success;
+}
+
+std::string RtProfileReport(const RtProfile& profile)
+{
+  std::stringstream report;
+  report << "RT profile:"
+         << "\n\tRT thread CPUs: "
+         << (profile.rt_cpus.empty() ? "any" : FormatCpuList(profile.rt_cpus))
+         << "\n\tRT thread scheduling: " << SchedPolicyName(profile.sched_policy);
+  if (profile.sched_policy == RT_SCHED_FIFO || profile.sched_policy == RT_SCHED_RR)
+    report << ", priority " << profile.sched_priority;
+  report << "\n\tMemory locking: " << (profile.lock_memory ? "on" : "off")
+         << "\n\tPrefaulted RT thread stack: " << profile.prefault_stack_size / 1024
+         << " KiB"
+         << "\n\tPrefaulted heap: " << profile.prefault_heap_size / 1024 << " KiB"
+         << "\n\tLog thread CPUs: "
+         << (profile.log_cpus.empty() ? "any" : FormatCpuList(profile.log_cpus))
+         << "\n\tGUI thread CPUs: "
+         << (profile.gui_cpus.empty() ? "any" : FormatCpuList(profile.gui_cpus));
+  return report.str();
+}
+
+std::vector<std::string> CheckRtProfile(const RtProfile& profile,
+                                        const std::string& sysfs_cpu_dir)
+{
+  std::vector<std::string> warnings;
+
+  // All given CPUs must exist and be online
+  std::vector<int> online;
+  if (ParseCpuList(ReadSysfs(sysfs_cpu_dir + "/online"), &online) && !online.empty())
+  {
+    const std::pair<const char*, const std::vector<int>*> threads_cpus[] = {
+      {"RT", &profile.rt_cpus}, {"log", &profile.log_cpus}, {"GUI", &profile.gui_cpus}};
+    for (const auto& thread_cpus : threads_cpus)
+    {
+      const std::vector<int> offline = Difference(*thread_cpus.second, online);
+      if (!offline.empty())
+        warnings.push_back(std::string(thread_cpus.first) + " thread CPUs " +
+                           FormatCpuList(offline) + " are not online (online CPUs: " +
+                           FormatCpuList(online) + ")");
+    }
+  }
+  else
+    warnings.push_back("Could not read online CPUs from " + sysfs_cpu_dir + "/online");
+
+  if (!profile.rt_cpus.empty())
+  {
+    // RT CPUs should be isolated from the scheduler (isolcpus) ...
+    std::vector<int> isolated;
+    ParseCpuList(ReadSysfs(sysfs_cpu_dir + "/isolated"), &isolated);
+    const std::vector<int> not_isolated = Difference(profile.rt_cpus, isolated);
+    if (!not_isolated.empty())
+      warnings.push_back("RT thread CPUs " + FormatCpuList(not_isolated) +
+                         " are not isolated (isolated CPUs: " +
+                         (isolated.empty() ? "none" : FormatCpuList(isolated)) + ")");
+    // ... not shared with other threads of this application ...
+    const std::vector<int> shared_log = Intersection(profile.rt_cpus, profile.log_cpus);
+    if (!shared_log.empty())
+      warnings.push_back("RT thread CPUs " + FormatCpuList(shared_log) +
+                         " are shared with log thread");
+    const std::vector<int> shared_gui = Intersection(profile.rt_cpus, profile.gui_cpus);
+    if (!shared_gui.empty())
+      warnings.push_back("RT thread CPUs " + FormatCpuList(shared_gui) +
+                         " are shared with GUI thread");
+    // ... and run at full speed, if frequency scaling is available
+    for (const int cpu : profile.rt_cpus)
+    {
+      const std::string cpu_str  = std::to_string(cpu);
+      const std::string governor =
+        ReadSysfs(sysfs_cpu_dir + "/cpu" + cpu_str + "/cpufreq/scaling_governor");
+      if (!governor.empty() && governor != "performance")
+        warnings.push_back("RT thread CPU " + cpu_str + " frequency governor is " +
+                           governor + " instead of performance");
+    }
+  }
+
+  // Privileges, unless running as root
+  if (geteuid() != 0)
+  {
+    rlimit limit;
+    if (profile.lock_memory && getrlimit(RLIMIT_MEMLOCK, &limit) == 0 &&
+        limit.rlim_cur != RLIM_INFINITY)
+      warnings.push_back("Memory locking is limited to " +
+                         std::to_string(limit.rlim_cur / 1024) +
+                         " KiB (RLIMIT_MEMLOCK): run as root or raise it");
+    if ((profile.sched_policy == RT_SCHED_FIFO || profile.sched_policy == RT_SCHED_RR) &&
+        getrlimit(RLIMIT_RTPRIO, &limit) == 0 &&
+        limit.rlim_cur < static_cast<rlim_t>(profile.sched_priority))
+      warnings.push_back("RT priority is limited to " + std::to_string(limit.rlim_cur) +
+                         " (RLIMIT_RTPRIO): run as root or raise it");
+  }
+  return warnings;
+}
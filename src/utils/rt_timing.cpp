@@ -0,0 +1,322 @@
+/**
+ * @file rt_timing.cpp
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing definitions of functions and class declared in rt_timing.h.
+ */
+
+#include "utils/rt_timing.h"
+
+#include <cstdio>
+#include <limits>
+
+//------------------------------------------------------------------------------------//
+//--------- LogLinearHistogram class -------------------------------------------------//
+//------------------------------------------------------------------------------------//
+
+constexpr int LogLinearHistogram::kSubBucketBits;
+constexpr int LogLinearHistogram::kSubBucketsNum;
+constexpr int LogLinearHistogram::kMaxValueBits;
+constexpr int LogLinearHistogram::kBucketsNum;
+
+//--------- Public functions ---------------------------------------------------------//
+
+void LogLinearHistogram::Record(const uint64_t value)
+{
+  // Single writer: plain load/store pairs are enough and cheaper than read-modify-write.
+  std::atomic<uint32_t>& bucket = buckets_[BucketIndex(value)];
+  bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  count_.store(count_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  sum_.store(sum_.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+  if (value < min_.load(std::memory_order_relaxed))
+    min_.store(value, std::memory_order_relaxed);
+  if (value > max_.load(std::memory_order_relaxed))
+    max_.store(value, std::memory_order_relaxed);
+}
+
+void LogLinearHistogram::ResetNow()
+{
+  for (int i = 0; i < kBucketsNum; i++)
+    buckets_[i].store(0, std::memory_order_relaxed);
+  count_.store(0, std::memory_order_relaxed);
+  sum_.store(0, std::memory_order_relaxed);
+  min_.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+  max_.store(0, std::memory_order_relaxed);
+}
+
+uint64_t LogLinearHistogram::Min() const
+{
+  return Count() > 0 ? min_.load(std::memory_order_relaxed) : 0;
+}
+
+double LogLinearHistogram::Mean() const
+{
+  const uint64_t count = Count();
+  if (count == 0)
+    return 0.0;
+  return static_cast<double>(sum_.load(std::memory_order_relaxed)) / count;
+}
+
+uint64_t LogLinearHistogram::Percentile(const double percentile) const
+{
+  const uint64_t count = Count();
+  if (count == 0)
+    return 0;
+  const double p = std::min(std::max(percentile, 0.0), 100.0);
+  uint64_t target = static_cast<uint64_t>(p / 100.0 * count + 0.5);
+  if (target == 0)
+    target = 1;
+  uint64_t cumulative = 0;
+  for (int i = 0; i < kBucketsNum; i++)
+  {
+    cumulative += buckets_[i].load(std::memory_order_relaxed);
+    if (cumulative >= target)
+      return std::min(BucketUpperBound(i), Max());
+  }
+  return Max();
+}
+
+size_t LogLinearHistogram::BucketIndex(const uint64_t value)
+{
+  static constexpr uint64_t kMaxValue = (1ULL << kMaxValueBits) - 1;
+  const uint64_t v                    = std::min(value, kMaxValue);
+  if (v < static_cast<uint64_t>(kSubBucketsNum))
+    return static_cast<size_t>(v);
+  const int msb   = 63 - __builtin_clzll(v);
+  const int shift = msb - kSubBucketBits;
+  return static_cast<size_t>((shift + 1) * kSubBucketsNum +
+                             static_cast<int>(v >> shift) - kSubBucketsNum);
+}
+
+uint64_t LogLinearHistogram::BucketLowerBound(const size_t idx)
+{
+  if (idx < static_cast<size_t>(kSubBucketsNum))
+    return idx;
+  const size_t shift = idx / kSubBucketsNum - 1;
+  const uint64_t sub = idx % kSubBucketsNum + kSubBucketsNum;
+  return sub << shift;
+}
+
+uint64_t LogLinearHistogram::BucketUpperBound(const size_t idx)
+{
+  if (idx + 1 >= static_cast<size_t>(kBucketsNum))
+    return (1ULL << kMaxValueBits) - 1;
+  return BucketLowerBound(idx + 1) - 1;
+}
+
+//------------------------------------------------------------------------------------//
+//--------- RtTimingStats class ------------------------------------------------------//
+//------------------------------------------------------------------------------------//
+
+std::atomic<bool> RtTimingStats::dump_requested_(false);
+
+RtTimingStats::RtTimingStats(const uint64_t period_nsec /*= 1000000*/,
+                             const size_t slaves_num /*= 0*/)
+{
+  Setup(period_nsec, slaves_num);
+}
+
+//--------- Public functions ---------------------------------------------------------//
+
+void RtTimingStats::Setup(const uint64_t period_nsec, const size_t slaves_num)
+{
+  period_nsec_       = period_nsec;
+  slaves_num_        = slaves_num;
+  slaves_read_cost_  = std::unique_ptr<SlaveCost[]>(new SlaveCost[slaves_num_]);
+  slaves_write_cost_ = std::unique_ptr<SlaveCost[]>(new SlaveCost[slaves_num_]);
+  reset_requested_.store(false, std::memory_order_relaxed);
+  ResetNow();
+}
+
+uint64_t RtTimingStats::BeginCycle()
+{
+  if (reset_requested_.load(std::memory_order_relaxed))
+  {
+    ResetNow();
+    reset_requested_.store(false, std::memory_order_relaxed);
+  }
+
+  cycle_start_nsec_     = NowNsec();
+  cycle_missed_wakeups_ = 0;
+  if (prev_cycle_start_nsec_ > 0)
+  {
+    const uint64_t period = cycle_start_nsec_ - prev_cycle_start_nsec_;
+    Record(CYCLE_PERIOD, period);
+    Record(CYCLE_JITTER,
+           period > period_nsec_ ? period - period_nsec_ : period_nsec_ - period);
+
+    expected_wakeup_nsec_ += period_nsec_;
+    if (cycle_start_nsec_ < expected_wakeup_nsec_)
+      expected_wakeup_nsec_ = cycle_start_nsec_; // earlier than ever: re-anchor
+    else if (cycle_start_nsec_ - expected_wakeup_nsec_ >= period_nsec_)
+    {
+      // Whole periods were lost: move schedule forward and count the misses.
+      const uint64_t missed = (cycle_start_nsec_ - expected_wakeup_nsec_) / period_nsec_;
+      expected_wakeup_nsec_ += missed * period_nsec_;
+      cycle_missed_wakeups_ = missed;
+      missed_wakeups_count_.store(
+        missed_wakeups_count_.load(std::memory_order_relaxed) + missed,
+        std::memory_order_relaxed);
+    }
+    Record(WAKEUP_LATENCY, cycle_start_nsec_ - expected_wakeup_nsec_);
+  }
+  else
+    expected_wakeup_nsec_ = cycle_start_nsec_;
+  prev_cycle_start_nsec_ = cycle_start_nsec_;
+  return cycle_start_nsec_;
+}
+
+void RtTimingStats::RestartSchedule()
+{
+  prev_cycle_start_nsec_ = 0;
+  expected_wakeup_nsec_  = 0;
+  cycle_missed_wakeups_  = 0;
+}
+
+uint64_t RtTimingStats::RecordSlave(const Metrics phase, const size_t slave_idx,
+                                    const uint64_t t_start_nsec)
+{
+  const uint64_t now = NowNsec();
+  if (slave_idx >= slaves_num_)
+    return now;
+  SlaveCost& cost =
+    phase == WRITE_PHASE ? slaves_write_cost_[slave_idx] : slaves_read_cost_[slave_idx];
+  const uint64_t elapsed = now - t_start_nsec;
+  cost.count.store(cost.count.load(std::memory_order_relaxed) + 1,
+                   std::memory_order_relaxed);
+  cost.sum_ns.store(cost.sum_ns.load(std::memory_order_relaxed) + elapsed,
+                    std::memory_order_relaxed);
+  if (elapsed > cost.max_ns.load(std::memory_order_relaxed))
+    cost.max_ns.store(elapsed, std::memory_order_relaxed);
+  return now;
+}
+
+uint64_t RtTimingStats::RecordPhase(const Metrics phase, const uint64_t t_start_nsec)
+{
+  const uint64_t now = NowNsec();
+  Record(phase, now - t_start_nsec);
+  return now;
+}
+
+uint64_t RtTimingStats::EndCycle()
+{
+  const uint64_t work = NowNsec() - cycle_start_nsec_;
+  Record(CYCLE_WORK, work);
+  if (work > period_nsec_)
+    overruns_count_.store(overruns_count_.load(std::memory_order_relaxed) + 1,
+                          std::memory_order_relaxed);
+  cycles_count_.store(cycles_count_.load(std::memory_order_relaxed) + 1,
+                      std::memory_order_relaxed);
+  return work;
+}
+
+const RtTimingStats::SlaveCost& RtTimingStats::GetSlaveCost(const Metrics phase,
+                                                            const size_t slave_idx) const
+{
+  return phase == WRITE_PHASE ? slaves_write_cost_[slave_idx]
+                              : slaves_read_cost_[slave_idx];
+}
+
+void RtTimingStats::Dump(std::ostream& stream) const
+{
+  char line[160];
+  snprintf(line, sizeof(line),
+           "RT timing statistics: %lu cycles, nominal period %.1f us, %lu overruns, "
+           "%lu missed wake-ups\n",
+           static_cast<unsigned long>(CyclesCount()), period_nsec_ * 1e-3,
+           static_cast<unsigned long>(OverrunsCount()),
+           static_cast<unsigned long>(MissedWakeupsCount()));
+  stream << line;
+  snprintf(line, sizeof(line), "%-16s %9s %9s %9s %9s %9s %9s %12s\n", "[us]", "min",
+           "mean", "p50", "p99", "p99.9", "max", "worst cycle");
+  stream << line;
+  for (uint8_t i = 0; i < METRICS_NUM; i++)
+  {
+    const LogLinearHistogram& hist = histograms_[i];
+    snprintf(line, sizeof(line), "%-16s %9.1f %9.1f %9.1f %9.1f %9.1f %9.1f %12lu\n",
+             MetricName(static_cast<Metrics>(i)), hist.Min() * 1e-3, hist.Mean() * 1e-3,
+             hist.Percentile(50.0) * 1e-3, hist.Percentile(99.0) * 1e-3,
+             hist.Percentile(99.9) * 1e-3, hist.Max() * 1e-3,
+             static_cast<unsigned long>(WorstCaseCycle(static_cast<Metrics>(i))));
+    stream << line;
+  }
+  if (slaves_num_ == 0)
+    return;
+  snprintf(line, sizeof(line), "%-16s %9s %9s %9s %9s\n", "slave [us]", "read avg",
+           "read max", "write avg", "write max");
+  stream << line;
+  for (size_t i = 0; i < slaves_num_; i++)
+  {
+    const SlaveCost& rc = slaves_read_cost_[i];
+    const SlaveCost& wc = slaves_write_cost_[i];
+    const uint64_t rn   = std::max<uint64_t>(rc.count.load(std::memory_order_relaxed), 1);
+    const uint64_t wn   = std::max<uint64_t>(wc.count.load(std::memory_order_relaxed), 1);
+    snprintf(line, sizeof(line), "%-16lu %9.2f %9.2f %9.2f %9.2f\n",
+             static_cast<unsigned long>(i),
+             rc.sum_ns.load(std::memory_order_relaxed) * 1e-3 / rn,
+             rc.max_ns.load(std::memory_order_relaxed) * 1e-3,
+             wc.sum_ns.load(std::memory_order_relaxed) * 1e-3 / wn,
+             wc.max_ns.load(std::memory_order_relaxed) * 1e-3);
+    stream << line;
+  }
+}
+
+const char* RtTimingStats::MetricName(const Metrics metric)
+{
+  switch (metric)
+  {
+    case CYCLE_PERIOD:
+      return "cycle period";
+    case CYCLE_JITTER:
+      return "cycle jitter";
+    case WAKEUP_LATENCY:
+      return "wake-up latency";
+    case READ_PHASE:
+      return "read phase";
+    case CONTROL_PHASE:
+      return "control phase";
+    case WRITE_PHASE:
+      return "write phase";
+    case CYCLE_WORK:
+      return "cycle work";
+    case METRICS_NUM:
+      break;
+  }
+  return "unknown";
+}
+
+//--------- Private functions --------------------------------------------------------//
+
+void RtTimingStats::Record(const Metrics metric, const uint64_t value_nsec)
+{
+  if (value_nsec > histograms_[metric].Max())
+    worst_cycles_[metric].store(cycles_count_.load(std::memory_order_relaxed),
+                                std::memory_order_relaxed);
+  histograms_[metric].Record(value_nsec);
+}
+
+void RtTimingStats::ResetNow()
+{
+  for (uint8_t i = 0; i < METRICS_NUM; i++)
+  {
+    histograms_[i].ResetNow();
+    worst_cycles_[i].store(0, std::memory_order_relaxed);
+  }
+  for (size_t i = 0; i < slaves_num_; i++)
+  {
+    SlaveCost* costs[] = {&slaves_read_cost_[i], &slaves_write_cost_[i]};
+    for (SlaveCost* cost : costs)
+    {
+      cost->count.store(0, std::memory_order_relaxed);
+      cost->sum_ns.store(0, std::memory_order_relaxed);
+      cost->max_ns.store(0, std::memory_order_relaxed);
+    }
+  }
+  cycles_count_.store(0, std::memory_order_relaxed);
+  overruns_count_.store(0, std::memory_order_relaxed);
+  missed_wakeups_count_.store(0, std::memory_order_relaxed);
+  cycle_start_nsec_      = 0;
+  prev_cycle_start_nsec_ = 0;
+  expected_wakeup_nsec_  = 0;
+  cycle_missed_wakeups_  = 0;
+}
@@ -0,0 +1,107 @@
+/**
+ * @file sliding_stats.cpp
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing definitions of functions and class declared in
+ * sliding_stats.h.
+ */
+
+#include "utils/sliding_stats.h"
+
+#include <cmath>
+
+SlidingWindowStats::SlidingWindowStats(const size_t window_size)
+  : window_(window_size < 2 ? 2 : window_size)
+{}
+
+//--------- Public functions ---------------------------------------------------------//
+
+void SlidingWindowStats::Add(const double value)
+{
+  if (IsFull())
+  {
+    // Drop oldest sample: remaining ones shift one position back in the window
+    const double oldest = window_[head_];
+    const double n      = static_cast<double>(size_);
+    const double mean   = (n * mean_ - oldest) / (n - 1.0);
+    m2_ -= (oldest - mean_) * (oldest - mean);
+    mean_ = mean;
+    sum_ -= oldest;
+    sum_x_ -= sum_;
+    size_--;
+    window_[head_] = value;
+    head_          = (head_ + 1) % window_.size();
+  }
+  else
+    window_[(head_ + size_) % window_.size()] = value;
+
+  // Welford update with the new sample, which takes the last position
+  const double n     = static_cast<double>(size_ + 1);
+  const double delta = value - mean_;
+  mean_ += delta / n;
+  m2_ += delta * (value - mean_);
+  sum_ += value;
+  sum_x_ += (n - 1.0) * value;
+  size_++;
+
+  if (++adds_since_update_ >= window_.size())
+    Recompute();
+}
+
+void SlidingWindowStats::Reset()
+{
+  head_              = 0;
+  size_              = 0;
+  adds_since_update_ = 0;
+  mean_              = 0.0;
+  m2_                = 0.0;
+  sum_               = 0.0;
+  sum_x_             = 0.0;
+}
+
+double SlidingWindowStats::Variance() const
+{
+  if (size_ < 2)
+    return 0.0;
+  return m2_ > 0.0 ? m2_ / (size_ - 1) : 0.0; // m2 may get slightly negative by round-off
+}
+
+double SlidingWindowStats::Std() const { return sqrt(Variance()); }
+
+double SlidingWindowStats::Slope() const
+{
+  if (size_ < 2)
+    return 0.0;
+  // Positions in the window are 0, 1, ..., n-1
+  const double n        = static_cast<double>(size_);
+  const double sum_pos  = n * (n - 1.0) / 2.0;
+  const double sum_pos2 = (n - 1.0) * n * (2.0 * n - 1.0) / 6.0;
+  return (n * sum_x_ - sum_pos * sum_) / (n * sum_pos2 - sum_pos * sum_pos);
+}
+
+double SlidingWindowStats::Drift() const
+{
+  return size_ < 2 ? 0.0 : Slope() * (size_ - 1);
+}
+
+//--------- Private functions --------------------------------------------------------//
+
+void SlidingWindowStats::Recompute()
+{
+  adds_since_update_ = 0;
+  sum_               = 0.0;
+  sum_x_             = 0.0;
+  for (size_t i = 0; i < size_; i++)
+  {
+    const double value = window_[(head_ + i) % window_.size()];
+    sum_ += value;
+    sum_x_ += i * value;
+  }
+  mean_ = sum_ / size_;
+  m2_   = 0.0;
+  for (size_t i = 0; i < size_; i++)
+  {
+    const double deviation = window_[(head_ + i) % window_.size()] - mean_;
+    m2_ += deviation * deviation;
+  }
+}
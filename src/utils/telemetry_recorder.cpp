@@ -0,0 +1,140 @@
+/**
+ * @file telemetry_recorder.cpp
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing definitions of functions and class declared in
+ * telemetry_recorder.h.
+ */
+
+#include "utils/telemetry_recorder.h"
+
+#include <algorithm>
+
+#include "utils/rt_profile.h"
+
+constexpr size_t TelemetryRecorder::kBatchSize_;
+constexpr long TelemetryRecorder::kIdleWaitMsec_;
+
+TelemetryRecorder::TelemetryRecorder(const size_t buffer_size /*= 1 << 15*/)
+  : recording_(false), stop_requested_(false),
+    buffer_(buffer_size, OverflowPolicy::DROP_NEWEST),
+    pose_buffer_(buffer_size, OverflowPolicy::DROP_NEWEST), writer_(1 << 20)
+{}
+
+TelemetryRecorder::~TelemetryRecorder() { Stop(); }
+
+//--------- Public functions ---------------------------------------------------------//
+
+bool TelemetryRecorder::Start(const std::string& filename)
+{
+  if (IsRecording() || isRunning())
+    return false;
+
+  // Discard any sample left behind by a previous session
+  while (buffer_.Pop(batch_, kBatchSize_) > 0)
+    continue;
+  while (pose_buffer_.Pop(pose_batch_, kBatchSize_) > 0)
+    continue;
+  batch_size_      = 0;
+  batch_pos_       = 0;
+  pose_batch_size_ = 0;
+  pose_batch_pos_  = 0;
+
+  if (!writer_.Open(filename, {ActuatorTelemetryMsg::binarySchema(),
+                               PlatformPoseMsg::binarySchema()}))
+    return false;
+  pushed_at_start_  = buffer_.PushedCount() + pose_buffer_.PushedCount();
+  dropped_at_start_ = buffer_.DroppedCount() + pose_buffer_.DroppedCount();
+  buffer_.ResetHighWaterMark();
+  pose_buffer_.ResetHighWaterMark();
+  stop_requested_.store(false, std::memory_order_release);
+  recording_.store(true, std::memory_order_release);
+  start();
+  return true;
+}
+
+void TelemetryRecorder::Stop()
+{
+  if (!IsRecording())
+    return;
+  recording_.store(false, std::memory_order_release);
+  stop_requested_.store(true, std::memory_order_release);
+  wakeup_.Wake();
+  wait();
+}
+
+TelemetryRecorder::Stats TelemetryRecorder::GetStats() const
+{
+  Stats stats;
+  // Both buffers have the same capacity
+  stats.capacity = buffer_.Capacity();
+  stats.recorded =
+    buffer_.PushedCount() + pose_buffer_.PushedCount() - pushed_at_start_;
+  stats.dropped =
+    buffer_.DroppedCount() + pose_buffer_.DroppedCount() - dropped_at_start_;
+  stats.high_water_mark =
+    std::max(buffer_.HighWaterMark(), pose_buffer_.HighWaterMark());
+  return stats;
+}
+
+//--------- Private functions --------------------------------------------------------//
+
+void TelemetryRecorder::run()
+{
+  if (!cpus_.empty())
+    SetThreadCpus(pthread_self(), cpus_); // best effort, recording works anyway
+
+  while (1)
+  {
+    // Read stop request first, so that nothing recorded before it is left behind
+    const bool stop_requested = stop_requested_.load(std::memory_order_acquire);
+    // A batch is only refilled once written up, since it may be waiting for the other
+    if (batch_pos_ == batch_size_)
+    {
+      batch_size_ = buffer_.Pop(batch_, kBatchSize_);
+      batch_pos_  = 0;
+    }
+    if (pose_batch_pos_ == pose_batch_size_)
+    {
+      pose_batch_size_ = pose_buffer_.Pop(pose_batch_, kBatchSize_);
+      pose_batch_pos_  = 0;
+    }
+    if (batch_size_ == 0 && pose_batch_size_ == 0)
+    {
+      if (stop_requested)
+        break;
+      // Sleep until a full batch is queued, but flush a partial one after a while
+      wakeup_.Wait(
+        [this]() {
+          return buffer_.Size() < kBatchSize_ && pose_buffer_.Size() < kBatchSize_;
+        },
+        kIdleWaitMsec_);
+      continue;
+    }
+    WriteMerged();
+  }
+  writer_.Close();
+}
+
+void TelemetryRecorder::WriteMerged()
+{
+  // Write the earliest sample of both batches, as long as both have any left
+  while (batch_pos_ < batch_size_ && pose_batch_pos_ < pose_batch_size_)
+  {
+    if (pose_batch_[pose_batch_pos_].header.timestamp <
+        batch_[batch_pos_].header.timestamp)
+      writer_.Write(pose_batch_[pose_batch_pos_++]);
+    else
+      writer_.Write(batch_[batch_pos_++]);
+  }
+  // Once a batch is written up, the rest of the other one can only be written if there
+  // was nothing else to pop: samples recorded afterwards are not earlier, since each
+  // cycle records telemetry before pose and cycles are in time order. Otherwise, it waits
+  // for the next batch.
+  if (batch_size_ == 0)
+    while (pose_batch_pos_ < pose_batch_size_)
+      writer_.Write(pose_batch_[pose_batch_pos_++]);
+  if (pose_batch_size_ == 0)
+    while (batch_pos_ < batch_size_)
+      writer_.Write(batch_[batch_pos_++]);
+}
@@ -0,0 +1,25 @@
+# Unit tests of CableRobotApp, built out of the very same sources (see cable_robot.pri).
+# Run with "make check", or launch CableRobotTests directly.
+
+include($$PWD/../cable_robot.pri)
+
+QT += testlib
+
+CONFIG += testcase
+
+HEADERS += \
+    $$PWD/test_binary_log.h \
+    $$PWD/test_forward_kinematics.h \
+    $$PWD/test_homing_optimizer.h
+
+SOURCES += \
+    $$PWD/tests_main.cpp \
+    $$PWD/test_binary_log.cpp \
+    $$PWD/test_forward_kinematics.cpp \
+    $$PWD/test_homing_optimizer.cpp
+
+INCLUDEPATH += $$PWD
+
+TEMPLATE = app
+
+TARGET = CableRobotTests
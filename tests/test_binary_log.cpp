@@ -0,0 +1,131 @@
+/**
+ * @file test_binary_log.cpp
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing definitions of the unit tests declared in test_binary_log.h.
+ */
+
+#include "test_binary_log.h"
+
+#include <unistd.h>
+
+#include <QtTest>
+
+#include "utils/binary_log.h"
+
+namespace {
+
+const uint32_t kTestMsgType = 42;
+
+// Smallest message the writer accepts: a 4-byte type, a timestamp and one field
+struct TestMsg
+{
+  static constexpr size_t kWireSize =
+    WireSize<uint32_t>() + WireSize<double>() + WireSize<int32_t>();
+
+  double timestamp;
+  int32_t value;
+
+  size_t serialize(char* buffer) const
+  {
+    char* cursor = WireWrite(buffer, kTestMsgType);
+    cursor       = WireWrite(cursor, timestamp);
+    cursor       = WireWrite(cursor, value);
+    return static_cast<size_t>(cursor - buffer);
+  }
+
+  static BinaryMsgSchema binarySchema()
+  {
+    BinaryMsgSchema schema(kTestMsgType, "TestMsg");
+    AppendBinaryField<int32_t>(&schema, "value");
+    return schema;
+  }
+};
+
+constexpr size_t TestMsg::kWireSize;
+
+off_t FileSize(const std::string& filename)
+{
+  FILE* file = fopen(filename.c_str(), "rb");
+  if (file == NULL)
+    return -1;
+  fseek(file, 0, SEEK_END);
+  const off_t size = ftell(file);
+  fclose(file);
+  return size;
+}
+
+} // end namespace
+
+void TestBinaryLog::readBack()
+{
+  const std::string filename = WriteLog("read_back.bin", 3);
+  BinaryLogReader reader;
+  QVERIFY(reader.Open(filename));
+  BinaryLogRecord record;
+  for (int32_t i = 0; i < 3; i++)
+  {
+    QCOMPARE(reader.ReadRecord(&record), BIN_READ_OK);
+    QCOMPARE(record.schema->msg_type, kTestMsgType);
+    QCOMPARE(record.timestamp, 0.001 * i);
+    QCOMPARE(record.values.size(), static_cast<size_t>(1));
+    QCOMPARE(record.values[0].i, static_cast<int64_t>(-i));
+  }
+  QCOMPARE(reader.ReadRecord(&record), BIN_READ_EOF);
+  QCOMPARE(reader.ReadRecord(&record), BIN_READ_EOF);
+}
+
+void TestBinaryLog::truncatedRecord()
+{
+  // Bytes cut from the end: in the body of last record, then in its message type
+  const off_t kCuts[] = {1, TestMsg::kWireSize - 2};
+  for (const off_t cut : kCuts)
+  {
+    const std::string filename = WriteLog("truncated.bin", 2);
+    const off_t size           = FileSize(filename);
+    QVERIFY(size > 0);
+    QCOMPARE(truncate(filename.c_str(), size - cut), 0);
+
+    BinaryLogReader reader;
+    QVERIFY(reader.Open(filename));
+    BinaryLogRecord record;
+    QCOMPARE(reader.ReadRecord(&record), BIN_READ_OK);
+    QCOMPARE(reader.ReadRecord(&record), BIN_READ_TRUNCATED);
+  }
+}
+
+void TestBinaryLog::unknownMsgType()
+{
+  const std::string filename = WriteLog("unknown_type.bin", 1);
+  FILE* file                 = fopen(filename.c_str(), "ab");
+  QVERIFY(file != NULL);
+  const TestMsg msg = {0.0, 0};
+  char record[TestMsg::kWireSize];
+  msg.serialize(record);
+  WireWrite(record, kTestMsgType + 1);
+  QCOMPARE(fwrite(record, 1, sizeof(record), file), sizeof(record));
+  fclose(file);
+
+  BinaryLogReader reader;
+  QVERIFY(reader.Open(filename));
+  BinaryLogRecord record_read;
+  QCOMPARE(reader.ReadRecord(&record_read), BIN_READ_OK);
+  QCOMPARE(reader.ReadRecord(&record_read), BIN_READ_UNKNOWN_TYPE);
+}
+
+std::string TestBinaryLog::WriteLog(const char* name, const size_t records_num)
+{
+  const std::string filename = dir_.filePath(name).toStdString();
+  BinaryLogWriter writer;
+  if (!writer.Open(filename, {TestMsg::binarySchema()}))
+    return filename;
+  for (size_t i = 0; i < records_num; i++)
+  {
+    TestMsg msg;
+    msg.timestamp = 0.001 * i;
+    msg.value     = -static_cast<int32_t>(i);
+    writer.Write(msg);
+  }
+  writer.Close();
+  return filename;
+}
@@ -0,0 +1,42 @@
+/**
+ * @file test_binary_log.h
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing the unit tests of BinaryLogWriter and BinaryLogReader.
+ */
+
+#ifndef CABLE_ROBOT_TEST_BINARY_LOG_H
+#define CABLE_ROBOT_TEST_BINARY_LOG_H
+
+#include <QObject>
+#include <QTemporaryDir>
+
+/**
+ * @brief Unit tests of BinaryLogWriter and BinaryLogReader.
+ */
+class TestBinaryLog: public QObject
+{
+  Q_OBJECT
+
+ private slots:
+  /**
+   * @brief Read back all written records, followed by the end of file.
+   */
+  void readBack();
+  /**
+   * @brief Read a file whose last record was cut short, either in its message type or
+   * in its body, as when the application stops while writing.
+   */
+  void truncatedRecord();
+  /**
+   * @brief Read a file with a record whose message type is not in its header.
+   */
+  void unknownMsgType();
+
+ private:
+  QTemporaryDir dir_;
+
+  std::string WriteLog(const char* name, const size_t records_num);
+};
+
+#endif // CABLE_ROBOT_TEST_BINARY_LOG_H
@@ -0,0 +1,91 @@
+/**
+ * @file test_forward_kinematics.cpp
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing definitions of the unit tests declared in
+ * test_forward_kinematics.h.
+ */
+
+#include "test_forward_kinematics.h"
+
+#include <QtTest>
+
+#include "robot/forward_kinematics.h"
+
+namespace {
+
+// 4 pulleys at the top corners of a square frame, each swiveling about the frame side
+// leading to its winch, and cables attached to the top corners of the platform.
+grabcdpr::Params MakeSquareConfig()
+{
+  static const double kSignsX[] = {1.0, -1.0, -1.0, 1.0};
+  static const double kSignsY[] = {1.0, 1.0, -1.0, -1.0};
+
+  grabcdpr::Params params;
+  params.platform.pos_PG_loc(3, 1) = 0.05;
+  for (uint8_t i = 0; i < 4; i++)
+  {
+    grabcdpr::ActuatorParams actuator;
+    actuator.active                   = true;
+    actuator.pulley.pos_OD_glob(1, 1) = 1.5 * kSignsX[i];
+    actuator.pulley.pos_OD_glob(2, 1) = 1.5 * kSignsY[i];
+    actuator.pulley.pos_OD_glob(3, 1) = 2.0;
+    actuator.pulley.vers_i(2, 1)      = kSignsX[i];
+    actuator.pulley.vers_j(3, 1)      = -1.0;
+    actuator.pulley.vers_k(1, 1)      = kSignsX[i];
+    actuator.pulley.radius            = 0.025;
+    actuator.winch.pos_PA_loc(1, 1)   = 0.2 * kSignsX[i];
+    actuator.winch.pos_PA_loc(2, 1)   = 0.2 * kSignsY[i];
+    actuator.winch.pos_PA_loc(3, 1)   = 0.1;
+    params.actuators.push_back(actuator);
+  }
+  return params;
+}
+
+} // end namespace
+
+void TestForwardKinematics::roundTripTiltTorsion()
+{
+  const grabcdpr::Params params = MakeSquareConfig();
+  const InverseKinematics::Pose pose = {{0.1, -0.2, 0.8, 0.2, 0.15, -0.1}};
+
+  // Measurements predicted at given pose, in the convention of the robot platform
+  InverseKinematics inverse_kinematics(params, ANGLES_TILT_TORSION);
+  QVERIFY(inverse_kinematics.UpdateZeroOrd(pose));
+  ActuatorsState actuators_state;
+  actuators_state.Setup(vect<id_t>(inverse_kinematics.CablesNum(), 0));
+  for (size_t i = 0; i < inverse_kinematics.CablesNum(); i++)
+  {
+    const CableKinematics& cable = inverse_kinematics.GetCable(i);
+    actuators_state.SetCalibration(i, 1e-6, 1e-6);
+    actuators_state.SetHomeConfig(i, 0, cable.length, 0, cable.swivel_ang);
+  }
+  actuators_state.ConvertCounts();
+
+  // Estimate from the default first guess, i.e. null orientation
+  ForwardKinematics forward_kinematics(params, ANGLES_TILT_TORSION);
+  QVERIFY(forward_kinematics.IsObservable());
+  bool converged = false;
+  for (size_t i = 0; i < 20 && !converged; i++)
+    converged = forward_kinematics.Update(actuators_state);
+  QVERIFY(converged);
+
+  const ForwardKinematics::Pose& estimate = forward_kinematics.GetPose();
+  for (uint8_t i = 0; i < 3; i++)
+    QVERIFY(fabs(estimate[i] - pose[i]) < 1e-6);
+  for (uint8_t i = 3; i < 6; i++)
+    QVERIFY(fabs(remainder(estimate[i] - pose[i], 2.0 * M_PI)) < 1e-6);
+  const InverseKinematics::Mat3& rot_mat =
+    forward_kinematics.GetInverseKinematics().GetRotMat();
+  for (uint8_t i = 0; i < 9; i++)
+    QVERIFY(fabs(rot_mat[i] - inverse_kinematics.GetRotMat()[i]) < 1e-6);
+
+  // Same orientation angles written onto a tilt-torsion platform state
+  grabcdpr::PlatformVars platform(grabcdpr::TILT_TORSION);
+  grabcdpr::Vars vars;
+  vars.platform = &platform;
+  forward_kinematics.WriteTo(&vars);
+  for (uint8_t i = 0; i < 3; i++)
+    QVERIFY(fabs(remainder(platform.orientation(i + 1, 1) - pose[3 + i], 2.0 * M_PI)) <
+            1e-6);
+}
@@ -0,0 +1,28 @@
+/**
+ * @file test_forward_kinematics.h
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing the unit tests of ForwardKinematics.
+ */
+
+#ifndef CABLE_ROBOT_TEST_FORWARD_KINEMATICS_H
+#define CABLE_ROBOT_TEST_FORWARD_KINEMATICS_H
+
+#include <QObject>
+
+/**
+ * @brief Unit tests of ForwardKinematics.
+ */
+class TestForwardKinematics: public QObject
+{
+  Q_OBJECT
+
+ private slots:
+  /**
+   * @brief Estimate the pose out of the measurements predicted by InverseKinematics at
+   * a tilted and twisted pose, in the same orientation convention as the robot platform.
+   */
+  void roundTripTiltTorsion();
+};
+
+#endif // CABLE_ROBOT_TEST_FORWARD_KINEMATICS_H
@@ -0,0 +1,149 @@
+/**
+ * @file test_homing_optimizer.cpp
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing definitions of the unit tests declared in
+ * test_homing_optimizer.h.
+ */
+
+#include "test_homing_optimizer.h"
+
+#include <random>
+
+#include <QtTest>
+
+#include "homing/homing_optimizer.h"
+
+namespace {
+
+struct PulleyGeometry
+{
+  double pos_OD_glob[3];
+  double vers_i[3];
+  double vers_j[3];
+  double vers_k[3];
+  double radius;
+  double pos_PA_loc[3];
+};
+
+// 3-cable prototype, as calibrated
+const PulleyGeometry kPulleys[] = {
+  {{-2.029594559948216, -0.169642227046553, 0.807595404978923},
+   {0.0376530632838613, 0.994199989295536, -0.100740399592707},
+   {-0.000728275363735027, -0.100784559896304, -0.994908006853651},
+   {-0.999290606600671, 0.037534700894837, -0.00307079605298203},
+   0.025,
+   {0.0199999797457478, -0.286799969179064, 0.250000001206436}},
+  {{0.0656930817427495, 0.91697866302548, 0.757433767882677},
+   {-0.995317964572968, 0.0542445217893429, -0.0799980078137653},
+   {0.0769513066254306, -0.0561052185131007, -0.995455022019697},
+   {-0.0584862873412623, -0.996950217569284, 0.0516683450634194},
+   0.025,
+   {0.2511, 0.1534, 0.25}},
+  {{-2.04307810304978, 2.24106224502955, 0.738167007491344},
+   {0.0164778439711446, -0.999247675918304, 0.0351078741870105},
+   {-0.0367671341137555, 0.0344833421640011, 0.998728730417956},
+   {-0.999187999581222, -0.0177477121080091, -0.0361712621815648},
+   0.025,
+   {-0.2111, 0.1534, 0.25}}};
+
+const double kLengthNoise = 2e-4; // [m]
+const double kAngleNoise  = 5e-4; // [rad]
+
+grabcdpr::Params MakePrototypeConfig()
+{
+  grabcdpr::Params params;
+  params.platform.mass             = 8.0;
+  params.platform.pos_PG_loc(3, 1) = 0.18;
+  for (const PulleyGeometry& pulley : kPulleys)
+  {
+    grabcdpr::ActuatorParams actuator;
+    actuator.active        = true;
+    actuator.pulley.radius = pulley.radius;
+    for (uint8_t k = 0; k < 3; k++)
+    {
+      actuator.pulley.pos_OD_glob(k + 1, 1) = pulley.pos_OD_glob[k];
+      actuator.pulley.vers_i(k + 1, 1)      = pulley.vers_i[k];
+      actuator.pulley.vers_j(k + 1, 1)      = pulley.vers_j[k];
+      actuator.pulley.vers_k(k + 1, 1)      = pulley.vers_k[k];
+      actuator.winch.pos_PA_loc(k + 1, 1)   = pulley.pos_PA_loc[k];
+    }
+    params.actuators.push_back(actuator);
+  }
+  return params;
+}
+
+} // end namespace
+
+void TestHomingOptimizer::convergedOnNoisyData()
+{
+  checkNoisyFit(HomingOptimizerOptions().tolerance);
+}
+
+void TestHomingOptimizer::convergedOnNoisyDataDampingLimited() { checkNoisyFit(0.0); }
+
+void TestHomingOptimizer::checkNoisyFit(const double tolerance)
+{
+  static const size_t kNumMeas   = 10;
+  static const double kMaxCoiled = 0.16; // [m]
+
+  const grabcdpr::Params params = MakePrototypeConfig();
+
+  // Actual home differs from the guess of the optimizer
+  HomingOptimizerOptions truth_options;
+  truth_options.home_tension = 70.0;
+  truth_options.home_drop    = 1.3;
+  const HomingOptimizer truth(params, truth_options);
+  HomingOptimizer::Pose home;
+  QVERIFY(truth.FindHomePose(&home));
+  const size_t cables_num = truth.CablesNum();
+  vect<HomingOptimizer::CableState> cables(cables_num);
+  truth.CalcCables(home, cables.data());
+  vect<double> home_lengths(cables_num);
+  vect<double> home_angles(cables_num);
+  for (size_t i = 0; i < cables_num; i++)
+  {
+    home_lengths[i] = cables[i].length;
+    home_angles[i]  = cables[i].swivel_angle;
+  }
+
+  // Coil and uncoil each cable in turn, as HomingProprioceptive does, adding noise
+  std::mt19937 generator(1);
+  std::normal_distribution<double> length_noise(0.0, kLengthNoise);
+  std::normal_distribution<double> angle_noise(0.0, kAngleNoise);
+  vect<HomingSample> samples;
+  for (size_t c = 0; c < cables_num; c++)
+  {
+    HomingOptimizer::Pose pose = home;
+    for (size_t m = 0; m < 2 * kNumMeas - 1; m++)
+    {
+      const size_t step    = m < kNumMeas ? m : 2 * kNumMeas - 2 - m;
+      vect<double> lengths = home_lengths;
+      lengths[c] -= kMaxCoiled / (kNumMeas - 1) * step;
+      QVERIFY(truth.FindPose(lengths, &pose));
+      truth.CalcCables(pose, cables.data());
+      HomingSample sample;
+      sample.actuator_idx = c;
+      for (size_t i = 0; i < cables_num; i++)
+      {
+        sample.cable_lengths.push_back(cables[i].length - home_lengths[i] +
+                                       length_noise(generator));
+        sample.pulley_angles.push_back(cables[i].swivel_angle - home_angles[i] +
+                                       angle_noise(generator));
+      }
+      samples.push_back(sample);
+    }
+  }
+
+  HomingOptimizerOptions options;
+  options.tolerance = tolerance;
+  const HomingOptimizer optimizer(params, options);
+  const HomingOptimizerResult result = optimizer.OptimizeMultiStart(samples, 1);
+  QVERIFY(result.converged);
+  QVERIFY(result.residual_rms > 0.0);
+  for (size_t i = 0; i < cables_num; i++)
+  {
+    QVERIFY(fabs(result.init_lengths[i] - home_lengths[i]) < 5e-3);
+    QVERIFY(fabs(result.init_angles[i] - home_angles[i]) < 5e-3);
+  }
+}
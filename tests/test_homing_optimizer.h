@@ -0,0 +1,36 @@
+/**
+ * @file test_homing_optimizer.h
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief File containing the unit tests of HomingOptimizer.
+ */
+
+#ifndef CABLE_ROBOT_TEST_HOMING_OPTIMIZER_H
+#define CABLE_ROBOT_TEST_HOMING_OPTIMIZER_H
+
+#include <QObject>
+
+/**
+ * @brief Unit tests of HomingOptimizer.
+ */
+class TestHomingOptimizer: public QObject
+{
+  Q_OBJECT
+
+ private slots:
+  /**
+   * @brief Fit measurements simulated with encoders noise, which leaves residuals far
+   * from null at the solution, and check the outcome is reported as converged.
+   */
+  void convergedOnNoisyData();
+  /**
+   * @brief Same as convergedOnNoisyData(), with no relative cost reduction to stop at,
+   * so that the fit can only end when damping does not improve it anymore.
+   */
+  void convergedOnNoisyDataDampingLimited();
+
+ private:
+  void checkNoisyFit(const double tolerance);
+};
+
+#endif // CABLE_ROBOT_TEST_HOMING_OPTIMIZER_H
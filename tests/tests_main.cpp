@@ -0,0 +1,38 @@
+/**
+ * @file tests_main.cpp
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief Unit tests of cable robot app.
+ *
+ * Usage:
+ * @code{.sh}
+ * CableRobotTests [QTest options]
+ * @endcode
+ * All test cases are run in turn with the given options, and the exit code is the total
+ * number of failed tests.
+ */
+
+#include <QCoreApplication>
+#include <QtTest>
+
+#include "easylogging++.h"
+
+#include "test_binary_log.h"
+#include "test_forward_kinematics.h"
+#include "test_homing_optimizer.h"
+
+INITIALIZE_EASYLOGGINGPP
+
+int main(int argc, char* argv[])
+{
+  QCoreApplication app(argc, argv);
+
+  int failures = 0;
+  TestBinaryLog test_binary_log;
+  failures += QTest::qExec(&test_binary_log, argc, argv);
+  TestForwardKinematics test_forward_kinematics;
+  failures += QTest::qExec(&test_forward_kinematics, argc, argv);
+  TestHomingOptimizer test_homing_optimizer;
+  failures += QTest::qExec(&test_homing_optimizer, argc, argv);
+  return failures;
+}
@@ -0,0 +1,128 @@
+/**
+ * @file binlog2csv.cpp
+ * @author agent
+ * @date 16 Oct 2026
+ * @brief Converter of binary data logs back to CSV text logs.
+ *
+ * Usage:
+ * @code{.sh}
+ * binlog2csv INPUT.bin [OUTPUT.log] [--precision DIGITS]
+ * @endcode
+ * Each record becomes a line with message type, timestamp and message fields separated
+ * by commas, exactly as logged by easylogging++ data logger in text format, so that
+ * _matlab/cable_robot_log_parser/parseCableRobotLogFile.m_ can parse it as is.
+ * If no output is given, it is the input file path with _.log_ extension. Floating point
+ * values are printed with 6 significant digits, as in text logs, unless a different
+ * precision is given. If the input cannot be read to its end, e.g. because it was
+ * truncated, records before the error are still converted, but the error is reported
+ * and the exit code is non-zero.
+ */
+
+#include <fstream>
+#include <iostream>
+#include <limits>
+
+#include "utils/binary_log.h"
+
+namespace {
+
+void PrintValue(std::ostream& os, const BinaryFieldValue& value)
+{
+  switch (value.type)
+  {
+    case BIN_INT8:
+    case BIN_INT16:
+    case BIN_INT32:
+    case BIN_INT64:
+      os << value.i;
+      break;
+    case BIN_FLOAT32:
+    case BIN_FLOAT64:
+      os << value.f;
+      break;
+    default:
+      os << value.u;
+      break;
+  }
+}
+
+std::string DefaultOutputFilename(const std::string& input_filename)
+{
+  const size_t dot_pos   = input_filename.rfind('.');
+  const size_t slash_pos = input_filename.rfind('/');
+  if (dot_pos == std::string::npos ||
+      (slash_pos != std::string::npos && dot_pos < slash_pos))
+    return input_filename + ".log";
+  return input_filename.substr(0, dot_pos) + ".log";
+}
+
+} // end namespace
+
+int main(int argc, char* argv[])
+{
+  std::string input_filename;
+  std::string output_filename;
+  int precision = 6;
+  for (int i = 1; i < argc; i++)
+  {
+    const std::string arg = argv[i];
+    if (arg == "--precision" && i + 1 < argc)
+      precision = std::stoi(argv[++i]);
+    else if (input_filename.empty())
+      input_filename = arg;
+    else if (output_filename.empty())
+      output_filename = arg;
+    else
+      input_filename.clear(); // too many arguments
+  }
+  if (input_filename.empty() || precision <= 0 ||
+      precision > std::numeric_limits<double>::max_digits10)
+  {
+    std::cerr << "Usage: " << argv[0] << " INPUT.bin [OUTPUT.log] [--precision DIGITS]"
+              << std::endl;
+    return -1;
+  }
+  if (output_filename.empty())
+    output_filename = DefaultOutputFilename(input_filename);
+
+  BinaryLogReader reader;
+  if (!reader.Open(input_filename))
+  {
+    std::cerr << "[ERROR] Invalid binary log file " << input_filename << std::endl;
+    return -1;
+  }
+  std::ofstream ofile(output_filename);
+  if (!ofile.is_open())
+  {
+    std::cerr << "[ERROR] Could not open file " << output_filename << std::endl;
+    return -1;
+  }
+  ofile.precision(precision);
+
+  BinaryLogRecord record;
+  size_t records_num = 0;
+  BinaryReadStatus status;
+  while ((status = reader.ReadRecord(&record)) == BIN_READ_OK)
+  {
+    ofile << record.schema->msg_type << ',' << record.timestamp;
+    for (const BinaryFieldValue& value : record.values)
+      PrintValue(ofile << ',', value);
+    ofile << '\n';
+    records_num++;
+  }
+  ofile.close();
+  if (!ofile.good())
+  {
+    std::cerr << "[ERROR] Could not write file " << output_filename << std::endl;
+    return -1;
+  }
+
+  std::cout << records_num << " records converted to " << output_filename << std::endl;
+  if (status != BIN_READ_EOF)
+  {
+    std::cerr << "[ERROR] Could not read record " << records_num + 1 << " of "
+              << input_filename << ": " << BinaryReadStatusName(status) << std::endl;
+    return -1;
+  }
+  return 0;
+}
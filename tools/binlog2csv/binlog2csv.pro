@@ -0,0 +1,19 @@
+# Converter of binary data logs of CableRobotApp back to CSV text logs, as produced by
+# easylogging++ data logger. See binlog2csv.cpp for usage.
+
+CONFIG += c++11 console
+CONFIG -= qt app_bundle
+
+HEADERS += \
+    $$PWD/../../inc/utils/binary_log.h \
+    $$PWD/../../inc/utils/wire_layout.h
+
+SOURCES += \
+    $$PWD/binlog2csv.cpp \
+    $$PWD/../../src/utils/binary_log.cpp
+
+INCLUDEPATH += $$PWD/../../inc
+
+TEMPLATE = app
+
+TARGET = binlog2csv